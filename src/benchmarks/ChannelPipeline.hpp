@@ -0,0 +1,469 @@
+/******************************************************************************
+ * @brief Example file that chains multiple AutonomyThreads together with bounded
+ *      channels, like the camera -> detector -> planner chain on the rover.
+ *
+ * @file ChannelPipeline.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+#include "../util/Channel.hpp"
+
+/// \cond
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief A fake camera frame. The pixel buffer is moved from stage to stage, the
+ *      capture time is used to calculate end to end latency.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct PipelineFrame
+{
+public:
+    // Declare public member variables.
+    int nCameraID = -1;
+    uint64_t nFrameID = 0;
+    uint64_t nDetectionScore = 0;
+    std::chrono::steady_clock::time_point tmCaptured;
+    std::vector<uint8_t> vPixels;
+};
+
+/******************************************************************************
+ * @brief First pipeline stage. Fills a frame buffer and pushes it into the
+ *      detector's input channel.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class PipelineCameraStage : public AutonomyThread<void>
+{
+private:
+    // Declare and define private methods and variables.
+    MPSCChannel<PipelineFrame> *m_pOutput = nullptr;
+    int m_nCameraID = 0;
+    int m_nFrameSize = 640 * 480;
+    int m_nFramesToSend = 1000;
+    int m_nFramesSent = 0;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // "Capture" a new frame.
+        PipelineFrame stFrame;
+        stFrame.nCameraID = m_nCameraID;
+        stFrame.nFrameID = m_nFramesSent;
+        stFrame.vPixels.assign(m_nFrameSize, uint8_t(m_nFramesSent));
+        stFrame.tmCaptured = std::chrono::steady_clock::now();
+
+        // Move the frame into the channel.
+        m_pOutput->Push(std::move(stFrame));
+
+        // Check if we have sent all of our frames.
+        if (++m_nFramesSent >= m_nFramesToSend)
+        {
+            // Request stop of main thread.
+            this->RequestStop();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Any highly parallelizable code that can be used in the main thread
+     *       goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override {}
+
+public:
+    /******************************************************************************
+     * @brief Construct a new Pipeline Camera Stage object.
+     *
+     * @param pOutput - The channel to push frames into.
+     * @param nCameraID - The ID stamped into each frame.
+     * @param nFrameSize - The size of each frame in bytes.
+     * @param nFramesToSend - The number of frames to produce before stopping.
+     * @param nFPS - The max frames per second for this camera. Zero is unlimited.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    PipelineCameraStage(MPSCChannel<PipelineFrame> *pOutput, int nCameraID, int nFrameSize, int nFramesToSend, int nFPS)
+    {
+        // Initialize member variables.
+        m_pOutput = pOutput;
+        m_nCameraID = nCameraID;
+        m_nFrameSize = nFrameSize;
+        m_nFramesToSend = nFramesToSend;
+        this->SetMainThreadIPSLimit(nFPS);
+    }
+};
+
+/******************************************************************************
+ * @brief Second pipeline stage. Waits for frames, runs a fake detector over the
+ *      pixels and forwards the frame to the planner.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class PipelineDetectorStage : public AutonomyThread<void>
+{
+private:
+    // Declare and define private methods and variables.
+    MPSCChannel<PipelineFrame> *m_pInput = nullptr;
+    SPSCChannel<PipelineFrame> *m_pOutput = nullptr;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Create instance variables.
+        PipelineFrame stFrame;
+
+        // Sleep until a frame arrives.
+        if (m_pInput->PopWait(stFrame))
+        {
+            // "Detect" something by touching every pixel.
+            stFrame.nDetectionScore = std::accumulate(stFrame.vPixels.begin(), stFrame.vPixels.end(), uint64_t(0));
+            // Pass the frame on.
+            m_pOutput->Push(std::move(stFrame));
+        }
+        // Check if the cameras are done and everything has been drained.
+        else if (m_pInput->IsClosed() && m_pInput->Empty())
+        {
+            // Pass the close on down the pipeline.
+            m_pOutput->Close();
+            // Request stop of main thread.
+            this->RequestStop();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Any highly parallelizable code that can be used in the main thread
+     *       goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override {}
+
+public:
+    /******************************************************************************
+     * @brief Construct a new Pipeline Detector Stage object.
+     *
+     * @param pInput - The channel the cameras push into.
+     * @param pOutput - The channel to push detections into.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    PipelineDetectorStage(MPSCChannel<PipelineFrame> *pInput, SPSCChannel<PipelineFrame> *pOutput)
+    {
+        // Initialize member variables.
+        m_pInput = pInput;
+        m_pOutput = pOutput;
+    }
+};
+
+/******************************************************************************
+ * @brief Last pipeline stage. Waits for detections and records the latency from
+ *      capture to arrival.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class PipelinePlannerStage : public AutonomyThread<void>
+{
+private:
+    // Declare and define private methods and variables.
+    SPSCChannel<PipelineFrame> *m_pInput = nullptr;
+    std::vector<double> m_vLatencies;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Create instance variables.
+        PipelineFrame stFrame;
+
+        // Sleep until a detection arrives.
+        if (m_pInput->PopWait(stFrame))
+        {
+            // Record end to end latency.
+            std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+            m_vLatencies.emplace_back(std::chrono::duration_cast<std::chrono::nanoseconds>(tmNow - stFrame.tmCaptured).count() / 1000.0);
+        }
+        // Check if the detector is done and everything has been drained.
+        else if (m_pInput->IsClosed() && m_pInput->Empty())
+        {
+            // Request stop of main thread.
+            this->RequestStop();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Any highly parallelizable code that can be used in the main thread
+     *       goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override {}
+
+public:
+    /******************************************************************************
+     * @brief Construct a new Pipeline Planner Stage object.
+     *
+     * @param pInput - The channel the detector pushes into.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    PipelinePlannerStage(SPSCChannel<PipelineFrame> *pInput) { m_pInput = pInput; }
+
+    /******************************************************************************
+     * @brief Accessor for the Latencies private member. Only call this after the
+     *      stage has been joined.
+     *
+     * @return std::vector<double>& - The end to end latency of every received frame in microseconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    std::vector<double> &GetLatencies() { return m_vLatencies; }
+};
+
+/******************************************************************************
+ * @brief This class builds a camera -> detector -> planner pipeline out of
+ *      AutonomyThreads connected by channels and measures throughput and end to
+ *      end latency for a given channel policy.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class ChannelPipelineBenchmark
+{
+private:
+    // Declare and define private methods and variables.
+    ChannelPolicy m_ePolicy = ChannelPolicy::eBlock;
+    int m_nCameraCount = 2;
+    int m_nFramesPerCamera = 1000;
+    int m_nFrameSize = 640 * 480;
+    int m_nCameraFPS = 0;
+    size_t m_nChannelCapacity = 8;
+    double m_dCalculationTime = -1.0;
+    uint64_t m_nFramesReceived = 0;
+    uint64_t m_nFramesDropped = 0;
+    std::vector<double> m_vLatencies;
+
+public:
+    // Declare and define public methods and variables.
+    ChannelPipelineBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Builds the pipeline, pushes all frames through it and waits for every
+     *      stage to drain and stop.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Run()
+    {
+        // Channels are declared first so they outlive the stages that point to them.
+        MPSCChannel<PipelineFrame> stCameraChannel(m_nChannelCapacity, m_ePolicy);
+        SPSCChannel<PipelineFrame> stDetectionChannel(m_nChannelCapacity, m_ePolicy);
+        PipelinePlannerStage stPlanner(&stDetectionChannel);
+        PipelineDetectorStage stDetector(&stCameraChannel, &stDetectionChannel);
+        std::vector<std::unique_ptr<PipelineCameraStage>> vCameras;
+        for (int nIter = 0; nIter < m_nCameraCount; ++nIter)
+        {
+            vCameras.emplace_back(std::make_unique<PipelineCameraStage>(&stCameraChannel, nIter, m_nFrameSize, m_nFramesPerCamera, m_nCameraFPS));
+        }
+
+        // Start from the back of the pipeline so consumers are waiting when data shows up.
+        std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+        stPlanner.Start();
+        stDetector.Start();
+        for (std::unique_ptr<PipelineCameraStage> &pCamera : vCameras)
+        {
+            pCamera->Start();
+        }
+
+        // Wait for the cameras, then close their channel so the close ripples down the pipeline.
+        for (std::unique_ptr<PipelineCameraStage> &pCamera : vCameras)
+        {
+            pCamera->Join();
+        }
+        stCameraChannel.Close();
+        stDetector.Join();
+        stPlanner.Join();
+        std::chrono::steady_clock::time_point tmEndTime = std::chrono::steady_clock::now();
+
+        // Store results.
+        m_dCalculationTime = std::chrono::duration_cast<std::chrono::microseconds>(tmEndTime - tmStartTime).count();
+        m_vLatencies = stPlanner.GetLatencies();
+        m_nFramesReceived = m_vLatencies.size();
+        m_nFramesDropped = stCameraChannel.GetDroppedCount() + stDetectionChannel.GetDroppedCount();
+        std::sort(m_vLatencies.begin(), m_vLatencies.end());
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Policy private member.
+     *
+     * @param ePolicy - What the channels do when they are full.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPolicy(ChannelPolicy ePolicy) { m_ePolicy = ePolicy; }
+
+    /******************************************************************************
+     * @brief Mutator for the Camera Count private member.
+     *
+     * @param nNum - The number of camera stages feeding the detector.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetCameraCount(int nNum) { m_nCameraCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Frames Per Camera private member.
+     *
+     * @param nNum - The number of frames each camera produces.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetFramesPerCamera(int nNum) { m_nFramesPerCamera = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Frame Size private member.
+     *
+     * @param nBytes - The size of each frame in bytes.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetFrameSize(int nBytes) { m_nFrameSize = nBytes; }
+
+    /******************************************************************************
+     * @brief Mutator for the Camera FPS private member.
+     *
+     * @param nFPS - The max frames per second of each camera. Zero is unlimited.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetCameraFPS(int nFPS) { m_nCameraFPS = nFPS; }
+
+    /******************************************************************************
+     * @brief Mutator for the Channel Capacity private member.
+     *
+     * @param nCapacity - The capacity of each channel in the pipeline.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetChannelCapacity(size_t nCapacity) { m_nChannelCapacity = nCapacity; }
+
+    /******************************************************************************
+     * @brief Accessor for the Calculation Time private member.
+     *
+     * @return double - The total time in microseconds from starting the pipeline until it drained.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetCalculationTime() { return m_dCalculationTime; }
+
+    /******************************************************************************
+     * @brief Calculates the number of frames that made it through the pipeline per second.
+     *
+     * @return double - The pipeline throughput in frames per second.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetThroughput() { return m_dCalculationTime > 0 ? m_nFramesReceived / (m_dCalculationTime / 1e6) : 0.0; }
+
+    /******************************************************************************
+     * @brief Accessor for a latency percentile of the last run.
+     *
+     * @param dPercentile - The percentile to get, 0.0 to 1.0.
+     * @return double - The end to end latency at the given percentile in microseconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetLatencyPercentile(double dPercentile)
+    {
+        // Check if there is any history.
+        if (m_vLatencies.empty())
+        {
+            return 0.0;
+        }
+
+        // Latencies are sorted at the end of Run().
+        size_t nIndex = std::min(m_vLatencies.size() - 1, size_t(dPercentile * (m_vLatencies.size() - 1) + 0.5));
+        return m_vLatencies[nIndex];
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Frames Received private member.
+     *
+     * @return uint64_t - The number of frames that reached the planner.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetFramesReceived() { return m_nFramesReceived; }
+
+    /******************************************************************************
+     * @brief Accessor for the Frames Dropped private member.
+     *
+     * @return uint64_t - The number of frames thrown out by the channel policy.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetFramesDropped() { return m_nFramesDropped; }
+};
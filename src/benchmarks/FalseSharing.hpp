@@ -0,0 +1,170 @@
+/******************************************************************************
+ * @brief Benchmark that measures the cost of false sharing between pool threads
+ *      that each write their own counter.
+ *
+ * @file FalseSharing.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+#include "../util/CacheAlignment.hpp"
+
+/// \cond
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <latch>
+#include <memory>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class starts a number of pool writer threads that each increment
+ *      their own counter. The counters are either packed next to each other in
+ *      a single array, so that several of them share a cache line, or padded to
+ *      one counter per cache line. Comparing the two shows how much the cache line
+ *      ping-pong between cores costs the framework's pooled code.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class FalseSharingBenchmark : public AutonomyThread<void>
+{
+private:
+    // Declare and define private methods and variables.
+    int m_nWriterCount = 4;
+    int m_nIterationsPerWriter = 10000000;
+    bool m_bPadded = false;
+    double m_dCalculationTime = -1.0;
+    std::chrono::system_clock::time_point m_tmStartTime = std::chrono::system_clock::time_point::min();
+    std::atomic<int> m_nNextWriterIndex = 0;
+    std::unique_ptr<std::latch> m_pStartLatch;
+    std::vector<std::atomic<uint64_t>> m_vPackedCounters;
+    std::vector<CacheAligned<std::atomic<uint64_t>>> m_vPaddedCounters;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Reset the counters and the writer barrier.
+        m_vPackedCounters = std::vector<std::atomic<uint64_t>>(m_nWriterCount);
+        m_vPaddedCounters = std::vector<CacheAligned<std::atomic<uint64_t>>>(m_nWriterCount);
+        m_nNextWriterIndex = 0;
+        m_pStartLatch = std::make_unique<std::latch>(m_nWriterCount + 1);
+
+        // Start one pool thread per writer.
+        this->RunDetachedPool(m_nWriterCount, m_nWriterCount);
+        // Release all writers at once so thread startup is not part of the measurement.
+        m_tmStartTime = std::chrono::system_clock::now();
+        m_pStartLatch->arrive_and_wait();
+        // Wait for Pool to finish.
+        this->JoinPool();
+        // Store end time.
+        std::chrono::system_clock::time_point tmEndTime = std::chrono::system_clock::now();
+        // Calculate elapsed time.
+        m_dCalculationTime = std::chrono::duration_cast<std::chrono::microseconds>(tmEndTime - m_tmStartTime).count();
+        // Request stop of main thread.
+        this->RequestStop();
+    }
+
+    /******************************************************************************
+     * @brief Each pool task claims one counter and increments it m_nIterationsPerWriter times.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override
+    {
+        // Claim a counter for this writer.
+        int nWriterIndex = m_nNextWriterIndex.fetch_add(1);
+        // Pick the counter from the selected layout.
+        std::atomic<uint64_t> &atCounter = m_bPadded ? m_vPaddedCounters[nWriterIndex].tValue : m_vPackedCounters[nWriterIndex];
+
+        // Wait for the other writers.
+        m_pStartLatch->arrive_and_wait();
+
+        // Hammer the counter. Relaxed ordering, the only cost we want is the cache line ownership.
+        for (int nIter = 0; nIter < m_nIterationsPerWriter; ++nIter)
+        {
+            atCounter.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+public:
+    // Declare and define public methods and variables.
+    FalseSharingBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Mutator for the Writer Count private member.
+     *
+     * @param nNum - The number of pool threads writing to their own counter.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetWriterCount(int nNum) { m_nWriterCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Iterations Per Writer private member.
+     *
+     * @param nNum - The number of increments each writer performs.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetIterationsPerWriter(int nNum) { m_nIterationsPerWriter = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Padded private member.
+     *
+     * @param bPadded - True to give each counter its own cache line, false to pack them.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPadded(bool bPadded) { m_bPadded = bPadded; }
+
+    /******************************************************************************
+     * @brief Sums all counters of the selected layout. Used to make sure every
+     *      writer finished all of its increments.
+     *
+     * @return uint64_t - The total number of increments.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetTotalCount()
+    {
+        // Create instance variables.
+        uint64_t nTotal = 0;
+
+        // Loop through the counters of the selected layout.
+        for (int nIter = 0; nIter < int(m_vPackedCounters.size()); ++nIter)
+        {
+            nTotal += m_bPadded ? m_vPaddedCounters[nIter].tValue.load() : m_vPackedCounters[nIter].load();
+        }
+
+        return nTotal;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Calculation Time private member.
+     *
+     * @return double - The total time in microseconds that it took all writers to finish.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetCalculationTime() { return m_dCalculationTime; }
+};
@@ -0,0 +1,314 @@
+/******************************************************************************
+ * @brief Example file that measures the CPU time and context switches used by
+ *      AutonomyThreads that have nothing to do.
+ *
+ * @file IdleCost.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+#include "../util/ProcessStats.hpp"
+
+/// \cond
+#include "../../external/threadpool/include/BS_thread_pool.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief An AutonomyThread that does almost nothing. When started with a pool
+ *      size, the first iteration runs one batch of pool tasks, joins the pool and
+ *      stops, leaving a grown but idle pool behind.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class IdleCostThread : public AutonomyThread<void>
+{
+private:
+    // Declare and define private methods and variables.
+    int m_nPoolThreads = 0;
+    uint64_t m_nIterations = 0;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        ++m_nIterations;
+
+        // Use the pool once, then leave it idle.
+        if (m_nPoolThreads > 0)
+        {
+            this->RunDetachedPool(m_nPoolThreads, m_nPoolThreads);
+            this->JoinPool();
+            // Request stop of main thread.
+            this->RequestStop();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Each pool task does nothing.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override {}
+
+public:
+    /******************************************************************************
+     * @brief Construct a new Idle Cost Thread object.
+     *
+     * @param nRateHz - The IPS limit of the main loop. 0 for no limit.
+     * @param nPoolThreads - The pool size to use once before stopping. 0 to keep the loop running.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    IdleCostThread(int nRateHz, int nPoolThreads)
+    {
+        // Initialize member variables.
+        m_nPoolThreads = nPoolThreads;
+        this->SetMainThreadIPSLimit(nRateHz);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Iterations private member.
+     *
+     * @return uint64_t - The number of main loop iterations run.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetIterations() const { return m_nIterations; }
+};
+
+/******************************************************************************
+ * @brief This class puts a number of IdleCostThreads into one idle state and
+ *      measures the CPU time and context switches of the whole process while they
+ *      sit there. The numbers are per second of wall time, so a value of 0.01
+ *      means the idle threads keep one core 1% busy.
+ *
+ *      States:
+ *          eStopped - Constructed but never started. Only the parked main thread and pool threads.
+ *          eRateLimited - Running with an IPS limit, sleeping between iterations.
+ *          ePoolIdle - Grew the pool, ran one batch, joined it and stopped.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class IdleCostBenchmark
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // The state the threads are left in.
+    enum IdleState
+    {
+        eStopped,
+        eRateLimited,
+        ePoolIdle
+    };
+
+private:
+    // Declare and define private methods and variables.
+    IdleState m_eState = eStopped;
+    int m_nInstanceCount = 50;
+    int m_nRateHz = 20;
+    int m_nPoolThreads = 4;
+    double m_dDurationSeconds = 1.0;
+    // Results.
+    double m_dCpuSecondsPerSecond = 0.0;
+    double m_dVoluntaryPerSecond = 0.0;
+    double m_dInvoluntaryPerSecond = 0.0;
+    long m_nThreadCount = 0;
+
+public:
+    // Declare and define public methods and variables.
+    IdleCostBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Creates the threads, lets them settle into the idle state, measures
+     *      the process for the configured duration, then destroys them.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Run()
+    {
+        // Create the instances.
+        std::vector<std::unique_ptr<IdleCostThread>> vInstances;
+        for (int nIter = 0; nIter < m_nInstanceCount; ++nIter)
+        {
+            vInstances.emplace_back(std::make_unique<IdleCostThread>(m_nRateHz, m_eState == ePoolIdle ? m_nPoolThreads : 0));
+        }
+
+        // Start() blocks for a whole period, so start them from a helper pool instead of one by one.
+        if (m_eState != eStopped)
+        {
+            BS::thread_pool thStarter(16);
+            thStarter.detach_loop(0, m_nInstanceCount, [&vInstances](int nIndex) { vInstances[nIndex]->Start(); });
+            thStarter.wait();
+        }
+        if (m_eState == ePoolIdle)
+        {
+            for (std::unique_ptr<IdleCostThread> &pInstance : vInstances)
+            {
+                pInstance->Join();
+            }
+        }
+
+        // Let the startup work drain before measuring.
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        // Measure the idle interval.
+        m_nThreadCount = procstats::GetThreadCount();
+        procstats::ResourceUsage stStartUsage = procstats::GetResourceUsage();
+        std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(std::chrono::microseconds(int64_t(m_dDurationSeconds * 1e6)));
+        procstats::ResourceUsage stEndUsage = procstats::GetResourceUsage();
+        double dElapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count();
+
+        // Calculate results.
+        m_dCpuSecondsPerSecond = (stEndUsage.dCpuSeconds - stStartUsage.dCpuSeconds) / dElapsed;
+        m_dVoluntaryPerSecond = double(stEndUsage.nVoluntaryContextSwitches - stStartUsage.nVoluntaryContextSwitches) / dElapsed;
+        m_dInvoluntaryPerSecond = double(stEndUsage.nInvoluntaryContextSwitches - stStartUsage.nInvoluntaryContextSwitches) / dElapsed;
+
+        // Stop all of them before joining any of them.
+        for (std::unique_ptr<IdleCostThread> &pInstance : vInstances)
+        {
+            pInstance->RequestStop();
+        }
+        for (std::unique_ptr<IdleCostThread> &pInstance : vInstances)
+        {
+            pInstance->Join();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the State private member.
+     *
+     * @param eState - The idle state to measure.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetState(IdleState eState) { m_eState = eState; }
+
+    /******************************************************************************
+     * @brief Mutator for the Instance Count private member.
+     *
+     * @param nNum - The number of AutonomyThreads to create.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetInstanceCount(int nNum) { m_nInstanceCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Rate private member.
+     *
+     * @param nRateHz - The IPS limit of the rate limited state.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetRate(int nRateHz) { m_nRateHz = nRateHz; }
+
+    /******************************************************************************
+     * @brief Mutator for the Pool Threads private member.
+     *
+     * @param nNum - The pool size of the pool idle state.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPoolThreads(int nNum) { m_nPoolThreads = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Duration private member.
+     *
+     * @param dSeconds - How long to measure the idle threads.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetDuration(double dSeconds) { m_dDurationSeconds = dSeconds; }
+
+    /******************************************************************************
+     * @brief Accessor for the name of a state.
+     *
+     * @param eState - The state.
+     * @return const char* - A printable name.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static const char *GetStateName(IdleState eState)
+    {
+        switch (eState)
+        {
+            case eStopped: return "Stopped";
+            case eRateLimited: return "Rate Limited";
+            case ePoolIdle: return "Pool Idle";
+            default: return "Unknown";
+        }
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Cpu Seconds Per Second private member.
+     *
+     * @return double - CPU time used by the process per second of wall time.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetCpuSecondsPerSecond() { return m_dCpuSecondsPerSecond; }
+
+    /******************************************************************************
+     * @brief Accessor for the Voluntary Per Second private member.
+     *
+     * @return double - Voluntary context switches per second, threads going to sleep.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetVoluntaryPerSecond() { return m_dVoluntaryPerSecond; }
+
+    /******************************************************************************
+     * @brief Accessor for the Involuntary Per Second private member.
+     *
+     * @return double - Involuntary context switches per second, threads preempted.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetInvoluntaryPerSecond() { return m_dInvoluntaryPerSecond; }
+
+    /******************************************************************************
+     * @brief Accessor for the Thread Count private member.
+     *
+     * @return long - The number of threads in the process while measuring.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    long GetThreadCount() { return m_nThreadCount; }
+};
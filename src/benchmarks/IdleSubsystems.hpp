@@ -0,0 +1,452 @@
+/******************************************************************************
+ * @brief Example file that runs hundreds of mostly idle subsystems, either as
+ *      AutonomyThreads or as coroutine threads sharing a few workers.
+ *
+ * @file IdleSubsystems.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyCoroutine.hpp"
+#include "../interfaces/AutonomyThread.hpp"
+#include "../util/ProcessStats.hpp"
+
+/// \cond
+#include "../../external/threadpool/include/BS_thread_pool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Wake lateness and work done by a single idle subsystem. Both execution
+ *      modes fill one of these so their results can be compared directly.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct IdleSubsystemStats
+{
+public:
+    // Declare public member variables.
+    std::chrono::steady_clock::time_point tmExpectedWake;
+    uint64_t nWakeups = 0;
+    double dLatenessSum = 0.0;
+    double dMaxLateness = 0.0;
+    uint64_t nChecksum = 0;
+
+    /******************************************************************************
+     * @brief Records one wakeup. Measures how late it was compared to when the
+     *      previous iteration asked to be woken, then does a tiny bit of work.
+     *
+     * @param nPeriodMicroseconds - The time between wakeups this subsystem wants.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Wake(int nPeriodMicroseconds)
+    {
+        // Get the wake time.
+        std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+
+        // The first iteration has nothing to be late for.
+        if (nWakeups > 0)
+        {
+            double dLateness = std::max(0.0, std::chrono::duration<double, std::micro>(tmNow - tmExpectedWake).count());
+            dLatenessSum += dLateness;
+            dMaxLateness = std::max(dMaxLateness, dLateness);
+        }
+        ++nWakeups;
+        tmExpectedWake = tmNow + std::chrono::microseconds(nPeriodMicroseconds);
+
+        // "Poll a sensor".
+        for (int nIter = 0; nIter < 64; ++nIter)
+        {
+            nChecksum = nChecksum * 31 + nIter + nWakeups;
+        }
+    }
+};
+
+/******************************************************************************
+ * @brief A mostly idle subsystem in today's model. It owns its own main thread
+ *      and pool, and sleeps through the IPS limit between wakeups.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class IdleSubsystemThread : public AutonomyThread<void>
+{
+private:
+    // Declare and define private methods and variables.
+    int m_nPeriodMicroseconds = 100000;
+    IdleSubsystemStats m_stStats;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override { m_stStats.Wake(m_nPeriodMicroseconds); }
+
+    /******************************************************************************
+     * @brief Any highly parallelizable code that can be used in the main thread
+     *       goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override {}
+
+public:
+    /******************************************************************************
+     * @brief Construct a new Idle Subsystem Thread object.
+     *
+     * @param nRateHz - How many times per second the subsystem wakes up.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    IdleSubsystemThread(int nRateHz)
+    {
+        // Initialize member variables.
+        m_nPeriodMicroseconds = 1000000 / nRateHz;
+        this->SetMainThreadIPSLimit(nRateHz);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Stats private member. Only call this after the
+     *      subsystem has been joined.
+     *
+     * @return const IdleSubsystemStats& - The wakeup stats.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    const IdleSubsystemStats &GetStats() const { return m_stStats; }
+};
+
+/******************************************************************************
+ * @brief The same mostly idle subsystem as a coroutine. Between wakeups it is
+ *      parked on the scheduler's timer and doesn't hold any thread.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class IdleSubsystemCoroutine : public AutonomyCoroutineThread
+{
+private:
+    // Declare and define private methods and variables.
+    int m_nPeriodMicroseconds = 100000;
+    IdleSubsystemStats m_stStats;
+
+    /******************************************************************************
+     * @brief This code will run as a coroutine on the scheduler. Main code goes here.
+     *
+     * @return AutonomyTask - The coroutine for this iteration.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    AutonomyTask ThreadedContinuousCode() override
+    {
+        m_stStats.Wake(m_nPeriodMicroseconds);
+        co_return;
+    }
+
+public:
+    /******************************************************************************
+     * @brief Construct a new Idle Subsystem Coroutine object.
+     *
+     * @param stScheduler - The scheduler to run on.
+     * @param nRateHz - How many times per second the subsystem wakes up.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    IdleSubsystemCoroutine(CoroutineScheduler &stScheduler, int nRateHz) : AutonomyCoroutineThread(stScheduler)
+    {
+        // Initialize member variables.
+        m_nPeriodMicroseconds = 1000000 / nRateHz;
+        this->SetMainThreadIPSLimit(nRateHz);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Stats private member. Only call this after the
+     *      subsystem has been joined.
+     *
+     * @return const IdleSubsystemStats& - The wakeup stats.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    const IdleSubsystemStats &GetStats() const { return m_stStats; }
+};
+
+/******************************************************************************
+ * @brief This class starts a few hundred idle subsystems that wake at 10-20 Hz,
+ *      lets them run for a while and reports how many threads and how much memory
+ *      the process used and how late the wakeups were.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class IdleSubsystemsBenchmark
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // How the subsystems are run.
+    enum ExecutionMode
+    {
+        eThreads,
+        eCoroutines
+    };
+
+private:
+    // Declare and define private methods and variables.
+    ExecutionMode m_eMode = eThreads;
+    int m_nSubsystemCount = 200;
+    int m_nWorkerCount = 4;
+    double m_dDurationSeconds = 2.0;
+    // Results.
+    long m_nPeakThreadCount = 0;
+    long m_nMemoryDeltaKB = 0;
+    double m_dAverageLateness = 0.0;
+    double m_dMaxLateness = 0.0;
+    uint64_t m_nTotalWakeups = 0;
+    uint64_t m_nChecksum = 0;
+
+    /******************************************************************************
+     * @brief Samples the thread count and resident memory until the duration is
+     *      up and keeps the peak of each.
+     *
+     * @param nBaseMemoryKB - The resident memory before any subsystem existed.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SampleProcess(long nBaseMemoryKB)
+    {
+        // Sample ten times per second.
+        std::chrono::steady_clock::time_point tmEndTime = std::chrono::steady_clock::now() + std::chrono::microseconds(int64_t(m_dDurationSeconds * 1e6));
+        while (std::chrono::steady_clock::now() < tmEndTime)
+        {
+            m_nPeakThreadCount = std::max(m_nPeakThreadCount, procstats::GetThreadCount());
+            m_nMemoryDeltaKB = std::max(m_nMemoryDeltaKB, procstats::GetResidentMemoryKB() - nBaseMemoryKB);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+
+    /******************************************************************************
+     * @brief Merges the stats of one joined subsystem into the results.
+     *
+     * @param stStats - The subsystem's stats.
+     * @param dLatenessSum - The running sum of lateness of all subsystems.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void MergeStats(const IdleSubsystemStats &stStats, double &dLatenessSum)
+    {
+        // The first wakeup of each subsystem isn't measured.
+        m_nTotalWakeups += stStats.nWakeups > 0 ? stStats.nWakeups - 1 : 0;
+        dLatenessSum += stStats.dLatenessSum;
+        m_dMaxLateness = std::max(m_dMaxLateness, stStats.dMaxLateness);
+        m_nChecksum += stStats.nChecksum;
+    }
+
+public:
+    // Declare and define public methods and variables.
+    IdleSubsystemsBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Creates and starts all subsystems, samples the process while they run,
+     *      then stops them and gathers their wakeup stats.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Run()
+    {
+        // Reset results.
+        m_nPeakThreadCount = 0;
+        m_nMemoryDeltaKB = 0;
+        m_dMaxLateness = 0.0;
+        m_nTotalWakeups = 0;
+        double dLatenessSum = 0.0;
+
+        // Measure the process before anything is created.
+        long nBaseMemoryKB = procstats::GetResidentMemoryKB();
+
+        if (m_eMode == eThreads)
+        {
+            // Create subsystems, spreading their rates between 10 and 20 Hz.
+            std::vector<std::unique_ptr<IdleSubsystemThread>> vSubsystems;
+            for (int nIter = 0; nIter < m_nSubsystemCount; ++nIter)
+            {
+                vSubsystems.emplace_back(std::make_unique<IdleSubsystemThread>(10 + nIter % 11));
+            }
+
+            // Start() blocks for a whole period, so start them from a helper pool instead of one by one.
+            {
+                BS::thread_pool thStarter(16);
+                thStarter.detach_loop(0, m_nSubsystemCount, [&vSubsystems](int nIndex) { vSubsystems[nIndex]->Start(); });
+                thStarter.wait();
+            }
+
+            // Let them idle.
+            this->SampleProcess(nBaseMemoryKB);
+
+            // Stop all of them before joining any of them.
+            for (std::unique_ptr<IdleSubsystemThread> &pSubsystem : vSubsystems)
+            {
+                pSubsystem->RequestStop();
+            }
+            for (std::unique_ptr<IdleSubsystemThread> &pSubsystem : vSubsystems)
+            {
+                pSubsystem->Join();
+                this->MergeStats(pSubsystem->GetStats(), dLatenessSum);
+            }
+        }
+        else
+        {
+            // The scheduler is declared first so it outlives the subsystems.
+            CoroutineScheduler stScheduler(m_nWorkerCount, 1);
+            std::vector<std::unique_ptr<IdleSubsystemCoroutine>> vSubsystems;
+            for (int nIter = 0; nIter < m_nSubsystemCount; ++nIter)
+            {
+                vSubsystems.emplace_back(std::make_unique<IdleSubsystemCoroutine>(stScheduler, 10 + nIter % 11));
+            }
+
+            // Start() only blocks until the first iteration ran, so this is quick.
+            for (std::unique_ptr<IdleSubsystemCoroutine> &pSubsystem : vSubsystems)
+            {
+                pSubsystem->Start();
+            }
+
+            // Let them idle.
+            this->SampleProcess(nBaseMemoryKB);
+
+            // Stop all of them before joining any of them.
+            for (std::unique_ptr<IdleSubsystemCoroutine> &pSubsystem : vSubsystems)
+            {
+                pSubsystem->RequestStop();
+            }
+            for (std::unique_ptr<IdleSubsystemCoroutine> &pSubsystem : vSubsystems)
+            {
+                pSubsystem->Join();
+                this->MergeStats(pSubsystem->GetStats(), dLatenessSum);
+            }
+        }
+
+        // Calculate results.
+        m_dAverageLateness = m_nTotalWakeups > 0 ? dLatenessSum / m_nTotalWakeups : 0.0;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Mode private member.
+     *
+     * @param eMode - Whether subsystems run as threads or as coroutines.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMode(ExecutionMode eMode) { m_eMode = eMode; }
+
+    /******************************************************************************
+     * @brief Mutator for the Subsystem Count private member.
+     *
+     * @param nNum - The number of idle subsystems to run.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetSubsystemCount(int nNum) { m_nSubsystemCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Worker Count private member.
+     *
+     * @param nNum - The number of worker threads coroutines are resumed on.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetWorkerCount(int nNum) { m_nWorkerCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Duration private member.
+     *
+     * @param dSeconds - How long the subsystems idle for.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetDuration(double dSeconds) { m_dDurationSeconds = dSeconds; }
+
+    /******************************************************************************
+     * @brief Accessor for the Peak Thread Count private member.
+     *
+     * @return long - The most threads the process had while the subsystems ran.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    long GetPeakThreadCount() { return m_nPeakThreadCount; }
+
+    /******************************************************************************
+     * @brief Accessor for the Memory Delta private member.
+     *
+     * @return long - The most resident memory the subsystems added to the process in kB.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    long GetMemoryDeltaKB() { return m_nMemoryDeltaKB; }
+
+    /******************************************************************************
+     * @brief Accessor for the Average Lateness private member.
+     *
+     * @return double - How late a wakeup was on average in microseconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetAverageLateness() { return m_dAverageLateness; }
+
+    /******************************************************************************
+     * @brief Accessor for the Max Lateness private member.
+     *
+     * @return double - The latest any wakeup was in microseconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetMaxLateness() { return m_dMaxLateness; }
+
+    /******************************************************************************
+     * @brief Accessor for the Total Wakeups private member.
+     *
+     * @return uint64_t - The number of measured wakeups of all subsystems.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetTotalWakeups() { return m_nTotalWakeups; }
+};
@@ -0,0 +1,313 @@
+/******************************************************************************
+ * @brief Example file that shares the newest camera frame between a producer
+ *      and many readers, either through a shared mutex or a latest-value mailbox.
+ *
+ * @file MailboxSharing.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+#include "../util/Mailbox.hpp"
+
+/// \cond
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief A fake camera frame shared between the producer and readers.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct MailboxFrame
+{
+public:
+    // Declare public member variables.
+    uint64_t nSequence = 0;
+    std::vector<uint8_t> vPixels;
+};
+
+/******************************************************************************
+ * @brief This class runs a frame producer in the main thread and a number of
+ *      readers in the pool. Readers hold on to the newest frame while they
+ *      "process" it. In mutex mode they hold a shared lock the whole time, so the
+ *      producer's rate depends on them. In mailbox mode the producer never waits.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class MailboxSharingBenchmark : public AutonomyThread<void>
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // How the frame is shared between the producer and the readers.
+    enum SharingMode
+    {
+        eSharedMutex,
+        eMailbox
+    };
+
+private:
+    // Declare and define private methods and variables.
+    SharingMode m_eMode = eSharedMutex;
+    int m_nReaderCount = 4;
+    int m_nFrameSize = 640 * 480 * 3;
+    double m_dDurationSeconds = 1.0;
+    // Results.
+    double m_dProducerIPS = 0.0;
+    double m_dAverageStaleness = 0.0;
+    uint64_t m_nMaxStaleness = 0;
+    uint64_t m_nTotalReads = 0;
+    // Mutex mode frame.
+    std::shared_mutex m_muFrameMutex;
+    MailboxFrame m_stSharedFrame;
+    // Mailbox mode frame.
+    std::unique_ptr<LatestValueMailbox<MailboxFrame>> m_pMailbox;
+    // Shared between producer and readers.
+    alignas(cachealign::nDestructiveSize) std::atomic<uint64_t> m_nPublished = 0;
+    alignas(cachealign::nDestructiveSize) std::atomic_bool m_bReadersStop = false;
+    alignas(cachealign::nDestructiveSize) std::mutex m_muResultsMutex;
+    uint64_t m_nStalenessSum = 0;
+    uint64_t m_nChecksum = 0;
+    std::chrono::steady_clock::time_point m_tmStartTime;
+
+    /******************************************************************************
+     * @brief The main thread is the producer. Every iteration writes and publishes
+     *      one frame. On the first iteration the readers are started.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Start the readers on the first iteration.
+        if (m_nPublished.load() == 0)
+        {
+            m_tmStartTime = std::chrono::steady_clock::now();
+            this->RunDetachedPool(m_nReaderCount, m_nReaderCount);
+        }
+
+        // Produce the next frame.
+        uint64_t nSequence = m_nPublished.load(std::memory_order_relaxed) + 1;
+        if (m_eMode == eSharedMutex)
+        {
+            // Readers holding the shared lock block us here.
+            std::unique_lock<std::shared_mutex> lkWriteLock(m_muFrameMutex);
+            m_stSharedFrame.nSequence = nSequence;
+            m_stSharedFrame.vPixels.assign(m_nFrameSize, uint8_t(nSequence));
+            // Count it before unlocking, so no reader sees a frame newer than the published count.
+            m_nPublished.store(nSequence, std::memory_order_release);
+        }
+        else
+        {
+            // Fill a free buffer in place, its memory is reused from an older frame.
+            MailboxFrame &stFrame = m_pMailbox->BeginWrite();
+            stFrame.nSequence = nSequence;
+            stFrame.vPixels.assign(m_nFrameSize, uint8_t(nSequence));
+            m_pMailbox->Publish();
+            m_nPublished.store(nSequence, std::memory_order_release);
+        }
+
+        // Check if the test is over.
+        double dElapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_tmStartTime).count();
+        if (dElapsed >= m_dDurationSeconds)
+        {
+            // Stop the readers.
+            m_bReadersStop = true;
+            this->JoinPool();
+            // Calculate results.
+            m_dProducerIPS = m_nPublished.load() / dElapsed;
+            m_dAverageStaleness = m_nTotalReads > 0 ? double(m_nStalenessSum) / m_nTotalReads : 0.0;
+            // Request stop of main thread.
+            this->RequestStop();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Each pool task is one reader. It grabs the newest frame, processes it
+     *      while holding it, and records how many frames behind it was.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override
+    {
+        // Create instance variables.
+        uint64_t nReads = 0;
+        uint64_t nStalenessSum = 0;
+        uint64_t nMaxStaleness = 0;
+        uint64_t nChecksum = 0;
+
+        // Loop until the producer is done. Readers also watch the clock, a reader-preferring
+        // shared mutex can starve the producer so it may never get to tell us to stop.
+        while (!m_bReadersStop.load(std::memory_order_relaxed) &&
+               std::chrono::duration<double>(std::chrono::steady_clock::now() - m_tmStartTime).count() < m_dDurationSeconds)
+        {
+            // Create instance variables.
+            uint64_t nSequence = 0;
+
+            if (m_eMode == eSharedMutex)
+            {
+                // Hold the shared lock for the whole time the frame is processed.
+                std::shared_lock<std::shared_mutex> lkReadLock(m_muFrameMutex);
+                nSequence = m_stSharedFrame.nSequence;
+                nChecksum += std::accumulate(m_stSharedFrame.vPixels.begin(), m_stSharedFrame.vPixels.end(), uint64_t(0));
+            }
+            else
+            {
+                // Pin the newest frame for the whole time it is processed.
+                LatestValueMailbox<MailboxFrame>::ReadHandle stHandle = m_pMailbox->Read();
+                if (stHandle.IsValid())
+                {
+                    nSequence = stHandle.GetSequence();
+                    nChecksum += std::accumulate(stHandle.Get().vPixels.begin(), stHandle.Get().vPixels.end(), uint64_t(0));
+                }
+            }
+
+            // Record how far behind the newest frame the processed frame was once we were done with it.
+            if (nSequence > 0)
+            {
+                // The mailbox publishes the frame before the count, so the frame can be one ahead.
+                uint64_t nPublished = m_nPublished.load(std::memory_order_acquire);
+                uint64_t nStaleness = nPublished > nSequence ? nPublished - nSequence : 0;
+                nStalenessSum += nStaleness;
+                nMaxStaleness = std::max(nMaxStaleness, nStaleness);
+                ++nReads;
+            }
+        }
+
+        // Merge results.
+        std::lock_guard<std::mutex> lkResultsLock(m_muResultsMutex);
+        m_nTotalReads += nReads;
+        m_nStalenessSum += nStalenessSum;
+        m_nMaxStaleness = std::max(m_nMaxStaleness, nMaxStaleness);
+        // Keep the checksum so the processing isn't optimized out.
+        m_nChecksum += nChecksum;
+    }
+
+public:
+    // Declare and define public methods and variables.
+    MailboxSharingBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Resets the results and shared frame state before a new run.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ClearResults()
+    {
+        // Reset shared state.
+        m_pMailbox = std::make_unique<LatestValueMailbox<MailboxFrame>>(m_nReaderCount);
+        m_stSharedFrame = MailboxFrame();
+        m_nPublished = 0;
+        m_bReadersStop = false;
+        // Reset results.
+        m_dProducerIPS = 0.0;
+        m_dAverageStaleness = 0.0;
+        m_nMaxStaleness = 0;
+        m_nTotalReads = 0;
+        m_nStalenessSum = 0;
+        m_nChecksum = 0;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Mode private member.
+     *
+     * @param eMode - How the frame is shared with the readers.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMode(SharingMode eMode) { m_eMode = eMode; }
+
+    /******************************************************************************
+     * @brief Mutator for the Reader Count private member.
+     *
+     * @param nNum - The number of pool threads reading the newest frame.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetReaderCount(int nNum) { m_nReaderCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Frame Size private member.
+     *
+     * @param nBytes - The size of each frame in bytes.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetFrameSize(int nBytes) { m_nFrameSize = nBytes; }
+
+    /******************************************************************************
+     * @brief Mutator for the Duration private member.
+     *
+     * @param dSeconds - How long the producer runs for.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetDuration(double dSeconds) { m_dDurationSeconds = dSeconds; }
+
+    /******************************************************************************
+     * @brief Accessor for the Producer IPS private member.
+     *
+     * @return double - The number of frames the producer published per second.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetProducerIPS() { return m_dProducerIPS; }
+
+    /******************************************************************************
+     * @brief Accessor for the Average Staleness private member.
+     *
+     * @return double - How many frames behind the newest frame a reader was on average when it finished processing.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetAverageStaleness() { return m_dAverageStaleness; }
+
+    /******************************************************************************
+     * @brief Accessor for the Max Staleness private member.
+     *
+     * @return uint64_t - The most frames behind the newest frame any reader was.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetMaxStaleness() { return m_nMaxStaleness; }
+
+    /******************************************************************************
+     * @brief Accessor for the Total Reads private member.
+     *
+     * @return uint64_t - The number of frames processed by all readers.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetTotalReads() { return m_nTotalReads; }
+};
@@ -0,0 +1,236 @@
+/******************************************************************************
+ * @brief Example file that sums and prefix sums a large array with the
+ *      AutonomyThread reduce and scan helpers, a mutex guarded total, and the
+ *      standard parallel algorithms.
+ *
+ * @file ParallelReduction.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <execution>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class runs one reduction or scan method per run over the same
+ *      array of integers. The reductions sum the squares of the values, the scans
+ *      compute the inclusive prefix sum. Integer sums wrap the same way in any
+ *      order, so every reduction must give the same result and every scan the same
+ *      checksum.
+ *
+ *      Methods:
+ *          eMutexReduce - ParallelizeLoop adding each square to one total under a mutex.
+ *          eParallelReduce - ParallelReduce with one accumulator per block.
+ *          eStdReduce - std::transform_reduce with std::execution::par.
+ *          eSequentialScan - std::inclusive_scan on one thread.
+ *          eParallelScan - ParallelScan, two passes over the blocks.
+ *          eStdScan - std::inclusive_scan with std::execution::par.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class ParallelReductionBenchmark : public AutonomyThread<void>
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // The method to run.
+    enum ReductionMethod
+    {
+        eMutexReduce,
+        eParallelReduce,
+        eStdReduce,
+        eSequentialScan,
+        eParallelScan,
+        eStdScan
+    };
+
+private:
+    // Declare and define private methods and variables.
+    ReductionMethod m_eMethod = eParallelReduce;
+    int m_nThreads = 4;
+    size_t m_nElementCount = 1 << 23;
+    std::vector<uint64_t> m_vValues;
+    std::vector<uint64_t> m_vScanned;
+    std::mutex m_muTotalMutex;
+    uint64_t m_nResult = 0;
+    double m_dCalculationTime = -1.0;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Build the input once per size, outside of the timing.
+        if (m_vValues.size() != m_nElementCount)
+        {
+            m_vValues.resize(m_nElementCount);
+            m_vScanned.resize(m_nElementCount);
+            uint64_t nState = 0x9E3779B97F4A7C15ULL;
+            for (uint64_t &nValue : m_vValues)
+            {
+                nState ^= nState << 13;
+                nState ^= nState >> 7;
+                nState ^= nState << 17;
+                nValue = nState >> 40;
+            }
+        }
+        m_nResult = 0;
+
+        // Run the method.
+        std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+        switch (m_eMethod)
+        {
+            case eMutexReduce:
+                this->ParallelizeLoop(m_nThreads,
+                                      int(m_vValues.size()),
+                                      [this](const int nStart, const int nEnd)
+                                      {
+                                          for (int nIter = nStart; nIter < nEnd; ++nIter)
+                                          {
+                                              std::lock_guard<std::mutex> lkTotalLock(m_muTotalMutex);
+                                              m_nResult += m_vValues[nIter] * m_vValues[nIter];
+                                          }
+                                      });
+                break;
+            case eParallelReduce:
+                m_nResult = this->ParallelReduce(
+                    m_nThreads,
+                    m_vValues.size(),
+                    uint64_t(0),
+                    [this](const size_t nIter) { return m_vValues[nIter] * m_vValues[nIter]; },
+                    std::plus<uint64_t>());
+                break;
+            case eStdReduce:
+                m_nResult = std::transform_reduce(std::execution::par,
+                                                  m_vValues.begin(),
+                                                  m_vValues.end(),
+                                                  uint64_t(0),
+                                                  std::plus<uint64_t>(),
+                                                  [](const uint64_t nValue) { return nValue * nValue; });
+                break;
+            case eSequentialScan: std::inclusive_scan(m_vValues.begin(), m_vValues.end(), m_vScanned.begin()); break;
+            case eParallelScan:
+                this->ParallelScan(m_nThreads, m_vValues.begin(), m_vValues.end(), m_vScanned.begin(), uint64_t(0), std::plus<uint64_t>());
+                break;
+            case eStdScan: std::inclusive_scan(std::execution::par, m_vValues.begin(), m_vValues.end(), m_vScanned.begin()); break;
+        }
+        m_dCalculationTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count();
+
+        // Checksum the scan output outside of the timing.
+        if (m_eMethod == eSequentialScan || m_eMethod == eParallelScan || m_eMethod == eStdScan)
+        {
+            m_nResult = std::accumulate(m_vScanned.begin(), m_vScanned.end(), uint64_t(0), [](uint64_t nSum, uint64_t nValue) { return nSum * 31 + nValue; });
+        }
+
+        // Request stop of main thread.
+        this->RequestStop();
+    }
+
+    /******************************************************************************
+     * @brief Not used, every method runs its own pool.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override {}
+
+public:
+    // Declare and define public methods and variables.
+    ParallelReductionBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Mutator for the Method private member.
+     *
+     * @param eMethod - The reduction or scan to run.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMethod(ReductionMethod eMethod) { m_eMethod = eMethod; }
+
+    /******************************************************************************
+     * @brief Mutator for the Threads private member. The standard parallel
+     *      algorithms pick their own thread count.
+     *
+     * @param nNum - The number of threads for the AutonomyThread helpers.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetThreads(int nNum) { m_nThreads = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Element Count private member.
+     *
+     * @param nNum - The number of values in the array.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetElementCount(size_t nNum) { m_nElementCount = nNum; }
+
+    /******************************************************************************
+     * @brief Accessor for the name of a method.
+     *
+     * @param eMethod - The method.
+     * @return const char* - A printable name.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static const char *GetMethodName(ReductionMethod eMethod)
+    {
+        switch (eMethod)
+        {
+            case eMutexReduce: return "Mutex Reduce";
+            case eParallelReduce: return "ParallelReduce";
+            case eStdReduce: return "std::transform_reduce(par)";
+            case eSequentialScan: return "Sequential Scan";
+            case eParallelScan: return "ParallelScan";
+            case eStdScan: return "std::inclusive_scan(par)";
+            default: return "Unknown";
+        }
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Calculation Time private member.
+     *
+     * @return double - The time the method took in seconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetCalculationTime() { return m_dCalculationTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the Result private member.
+     *
+     * @return uint64_t - The sum of squares for reductions, a checksum of the output for scans.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetResult() { return m_nResult; }
+};
@@ -0,0 +1,288 @@
+/******************************************************************************
+ * @brief Example file that keeps the pool busy while switching it between two
+ *      sizes, with the live resize or by rebuilding the pool like older versions
+ *      of AutonomyThread did.
+ *
+ * @file PoolResize.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include "../../external/threadpool/include/BS_thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class queues a batch of tasks every iteration and switches the
+ *      pool between a small and a large size before each batch, so there is always
+ *      queued and running work when the size changes.
+ *
+ *      Modes:
+ *          eLiveResize - RunDetachedPool() with the new size, workers are added or retired in place.
+ *          eRebuild - A BS::thread_pool paused, purged and reset on every size change.
+ *
+ *      Rebuilding waits for every running task and throws away the queue, so it
+ *      loses tasks and its resize time grows with the task length. The live resize
+ *      should lose nothing and take about the same time whatever the task length.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class PoolResizeBenchmark : public AutonomyThread<void>
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // How the pool size is changed.
+    enum ResizeMode
+    {
+        eLiveResize,
+        eRebuild
+    };
+
+private:
+    // Declare and define private methods and variables.
+    ResizeMode m_eMode = eLiveResize;
+    int m_nIterationCount = 100;
+    int m_nTasksPerIteration = 16;
+    int m_nSmallPoolThreads = 2;
+    int m_nLargePoolThreads = 8;
+    int m_nTaskWork = 20000;
+    int m_nIterationsDone = 0;
+    uint64_t m_nTasksQueued = 0;
+    alignas(cachealign::nDestructiveSize) std::atomic<uint64_t> m_nTasksCompleted = 0;
+    BS::thread_pool m_thRebuildPool = BS::thread_pool(2);
+    // Results.
+    std::chrono::steady_clock::time_point m_tmStartTime;
+    double m_dResizeTimeSum = 0.0;
+    double m_dMaxResizeTime = 0.0;
+    double m_dTotalTime = 0.0;
+
+    /******************************************************************************
+     * @brief Stand-in for a pooled task. Spins for a fixed amount of work.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void RunTask()
+    {
+        // Xorshift, each step depends on the last so it can't be skipped.
+        uint64_t nState = 0x9E3779B97F4A7C15ULL;
+        for (int nIter = 0; nIter < m_nTaskWork; ++nIter)
+        {
+            nState ^= nState << 13;
+            nState ^= nState >> 7;
+            nState ^= nState << 17;
+        }
+        m_nTasksCompleted.fetch_add(nState != 0 ? 1 : 0, std::memory_order_relaxed);
+    }
+
+    /******************************************************************************
+     * @brief Changes the pool size the way the current mode does it.
+     *
+     * @param nNumThreads - The new pool size.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ResizePool(int nNumThreads)
+    {
+        if (m_eMode == eLiveResize)
+        {
+            // Queueing nothing just applies the size.
+            this->RunDetachedPool(0, nNumThreads);
+        }
+        else
+        {
+            // What PreparePool() used to do.
+            m_thRebuildPool.pause();
+            m_thRebuildPool.purge();
+            m_thRebuildPool.reset(nNumThreads);
+            m_thRebuildPool.unpause();
+        }
+    }
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Set up on the first iteration.
+        if (m_nIterationsDone == 0)
+        {
+            m_nTasksQueued = 0;
+            m_nTasksCompleted = 0;
+            m_dResizeTimeSum = 0.0;
+            m_dMaxResizeTime = 0.0;
+            m_tmStartTime = std::chrono::steady_clock::now();
+        }
+
+        // Switch size while the last batch is still queued and running.
+        int nNumThreads = m_nIterationsDone % 2 == 0 ? m_nLargePoolThreads : m_nSmallPoolThreads;
+        std::chrono::steady_clock::time_point tmResizeStart = std::chrono::steady_clock::now();
+        this->ResizePool(nNumThreads);
+        double dResizeTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmResizeStart).count();
+        m_dResizeTimeSum += dResizeTime;
+        m_dMaxResizeTime = std::max(m_dMaxResizeTime, dResizeTime);
+
+        // Queue the next batch.
+        if (m_eMode == eLiveResize)
+        {
+            this->RunDetachedPool(m_nTasksPerIteration, nNumThreads);
+        }
+        else
+        {
+            for (int nTask = 0; nTask < m_nTasksPerIteration; ++nTask)
+            {
+                m_thRebuildPool.detach_task([this]() { this->RunTask(); });
+            }
+        }
+        m_nTasksQueued += m_nTasksPerIteration;
+
+        // Check if every iteration is done.
+        if (++m_nIterationsDone >= m_nIterationCount)
+        {
+            // Let the last batch finish.
+            if (m_eMode == eLiveResize)
+            {
+                this->JoinPool();
+            }
+            else
+            {
+                m_thRebuildPool.wait();
+            }
+
+            // Calculate results.
+            m_dTotalTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_tmStartTime).count();
+            m_nIterationsDone = 0;
+            // Request stop of main thread.
+            this->RequestStop();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Each pool task runs one unit of work.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override { this->RunTask(); }
+
+public:
+    // Declare and define public methods and variables.
+    PoolResizeBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Mutator for the Mode private member.
+     *
+     * @param eMode - Whether the pool is resized live or rebuilt.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMode(ResizeMode eMode) { m_eMode = eMode; }
+
+    /******************************************************************************
+     * @brief Mutator for the Iteration Count private member.
+     *
+     * @param nNum - The number of batches, one resize before each.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetIterationCount(int nNum) { m_nIterationCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Tasks Per Iteration private member.
+     *
+     * @param nNum - The number of tasks in each batch.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetTasksPerIteration(int nNum) { m_nTasksPerIteration = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the two pool sizes.
+     *
+     * @param nSmall - The small pool size.
+     * @param nLarge - The large pool size.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPoolSizes(int nSmall, int nLarge)
+    {
+        // Assign member variables.
+        m_nSmallPoolThreads = nSmall;
+        m_nLargePoolThreads = nLarge;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Task Work private member.
+     *
+     * @param nIterations - How long each task spins.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetTaskWork(int nIterations) { m_nTaskWork = nIterations; }
+
+    /******************************************************************************
+     * @brief Accessor for the average resize time.
+     *
+     * @return double - The average time a size change blocked the main loop in seconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetAverageResizeTime() { return m_nIterationCount > 0 ? m_dResizeTimeSum / m_nIterationCount : 0.0; }
+
+    /******************************************************************************
+     * @brief Accessor for the Max Resize Time private member.
+     *
+     * @return double - The longest a size change blocked the main loop in seconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetMaxResizeTime() { return m_dMaxResizeTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the number of queued tasks that never ran.
+     *
+     * @return uint64_t - Tasks dropped by resizes.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetTasksLost() { return m_nTasksQueued - m_nTasksCompleted; }
+
+    /******************************************************************************
+     * @brief Accessor for the task throughput of the last run.
+     *
+     * @return double - Tasks completed per second.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetTasksPerSecond() { return m_dTotalTime > 0.0 ? m_nTasksCompleted / m_dTotalTime : 0.0; }
+};
@@ -0,0 +1,310 @@
+/******************************************************************************
+ * @brief Example file that runs batches of pooled work from the main loop, either
+ *      blocking until each batch is done or chaining the follow-up logic onto
+ *      the batch as a continuation.
+ *
+ * @file PooledContinuation.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+#include "../util/PoolFuture.hpp"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class runs a rate limited main loop that also launches batches of
+ *      prime counting tasks in the pool. In blocking mode the main loop waits for
+ *      each batch and sums its results itself, so it stalls for the whole batch. In
+ *      continuation mode the sum is chained onto the batch with Then() and the main
+ *      loop keeps iterating while the pool works.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class PooledContinuationBenchmark : public AutonomyThread<uint64_t>
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // How the main loop waits for a batch.
+    enum WaitStyle
+    {
+        eBlocking,
+        eContinuation
+    };
+
+private:
+    // Declare and define private methods and variables.
+    WaitStyle m_eStyle = eBlocking;
+    int m_nBatchCount = 50;
+    int m_nTasksPerBatch = 8;
+    int m_nPoolThreads = 4;
+    int m_nChunkSize = 20000;
+    // Results.
+    double m_dMainLoopIPS = 0.0;
+    double m_dTotalTime = 0.0;
+    double m_dAverageBatchLatency = 0.0;
+    uint64_t m_nPrimesFound = 0;
+    // Main thread only.
+    std::chrono::steady_clock::time_point m_tmStartTime;
+    uint64_t m_nMainIterations = 0;
+    uint64_t m_nControlChecksum = 0;
+    int m_nBatchesLaunched = 0;
+    // Handed from the pool back to the main thread.
+    alignas(cachealign::nDestructiveSize) std::atomic<int> m_nNextChunk = 0;
+    alignas(cachealign::nDestructiveSize) std::atomic<int> m_nBatchesCompleted = 0;
+    std::atomic_bool m_bBatchInFlight = false;
+    alignas(cachealign::nDestructiveSize) std::mutex m_muResultsMutex;
+    double m_dBatchLatencySum = 0.0;
+
+    /******************************************************************************
+     * @brief Sums a batch's results and records how long the batch took from
+     *      launch to this point.
+     *
+     * @param vResults - The prime count of every task in the batch.
+     * @param tmLaunched - When the batch was launched.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void FinishBatch(const std::vector<uint64_t> &vResults, std::chrono::steady_clock::time_point tmLaunched)
+    {
+        // Post process the batch.
+        uint64_t nPrimes = std::accumulate(vResults.begin(), vResults.end(), uint64_t(0));
+
+        // Record results.
+        std::lock_guard<std::mutex> lkResultsLock(m_muResultsMutex);
+        m_nPrimesFound += nPrimes;
+        m_dBatchLatencySum += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tmLaunched).count();
+        m_nBatchesCompleted.fetch_add(1, std::memory_order_release);
+    }
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Start the clock on the first iteration.
+        if (m_nMainIterations == 0)
+        {
+            m_tmStartTime = std::chrono::steady_clock::now();
+        }
+        ++m_nMainIterations;
+
+        // The main loop's own light control work.
+        for (int nIter = 0; nIter < 256; ++nIter)
+        {
+            m_nControlChecksum = m_nControlChecksum * 31 + nIter;
+        }
+
+        // Launch the next batch if there is one left to do.
+        if (m_nBatchesLaunched < m_nBatchCount)
+        {
+            if (m_eStyle == eBlocking)
+            {
+                // Run the batch and wait for all of its results.
+                ++m_nBatchesLaunched;
+                std::chrono::steady_clock::time_point tmLaunched = std::chrono::steady_clock::now();
+                this->RunPool(m_nTasksPerBatch, m_nPoolThreads);
+                this->FinishBatch(this->GetPoolResults(), tmLaunched);
+            }
+            else if (!m_bBatchInFlight.load(std::memory_order_acquire))
+            {
+                // Chain the follow up onto the batch and keep iterating.
+                ++m_nBatchesLaunched;
+                m_bBatchInFlight = true;
+                std::chrono::steady_clock::time_point tmLaunched = std::chrono::steady_clock::now();
+                this->RunPoolAsync(m_nTasksPerBatch, m_nPoolThreads)
+                    .Then(
+                        [this, tmLaunched](const std::vector<uint64_t> &vResults)
+                        {
+                            this->FinishBatch(vResults, tmLaunched);
+                            m_bBatchInFlight.store(false, std::memory_order_release);
+                        });
+            }
+        }
+
+        // Check if every batch is done.
+        if (m_nBatchesCompleted.load(std::memory_order_acquire) >= m_nBatchCount)
+        {
+            // Calculate results.
+            m_dTotalTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_tmStartTime).count();
+            m_dMainLoopIPS = m_nMainIterations / m_dTotalTime;
+            m_dAverageBatchLatency = m_dBatchLatencySum / m_nBatchCount;
+            // Request stop of main thread.
+            this->RequestStop();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Each pool task counts the primes in its own chunk of numbers. Every
+     *      batch covers the same numbers so all batches do the same amount of work.
+     *
+     * @return uint64_t - The number of primes found in the chunk.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t PooledLinearCode() override
+    {
+        // Create instance variables.
+        uint64_t nPrimes = 0;
+        int nChunk = m_nNextChunk.fetch_add(1, std::memory_order_relaxed) % m_nTasksPerBatch;
+        int nStart = nChunk * m_nChunkSize;
+
+        // Count primes in the chunk by trial division.
+        for (int nNum = std::max(nStart, 2); nNum < nStart + m_nChunkSize; ++nNum)
+        {
+            bool bIsPrime = true;
+            for (int i = 2; i * i <= nNum; ++i)
+            {
+                if (nNum % i == 0)
+                {
+                    bIsPrime = false;
+                    break;
+                }
+            }
+            nPrimes += bIsPrime;
+        }
+
+        return nPrimes;
+    }
+
+public:
+    // Declare and define public methods and variables.
+    PooledContinuationBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Resets the results before a new run.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ClearResults()
+    {
+        // Reset state.
+        m_nMainIterations = 0;
+        m_nControlChecksum = 0;
+        m_nBatchesLaunched = 0;
+        m_nNextChunk = 0;
+        m_nBatchesCompleted = 0;
+        m_bBatchInFlight = false;
+        // Reset results.
+        m_dMainLoopIPS = 0.0;
+        m_dTotalTime = 0.0;
+        m_dAverageBatchLatency = 0.0;
+        m_dBatchLatencySum = 0.0;
+        m_nPrimesFound = 0;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Style private member.
+     *
+     * @param eStyle - Whether the main loop blocks on batches or chains continuations.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetStyle(WaitStyle eStyle) { m_eStyle = eStyle; }
+
+    /******************************************************************************
+     * @brief Mutator for the Batch Count private member.
+     *
+     * @param nNum - The number of batches to run.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetBatchCount(int nNum) { m_nBatchCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Tasks Per Batch private member.
+     *
+     * @param nNum - The number of pool tasks in each batch.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetTasksPerBatch(int nNum) { m_nTasksPerBatch = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Pool Threads private member.
+     *
+     * @param nNum - The number of threads in the pool.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPoolThreads(int nNum) { m_nPoolThreads = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Main Loop Rate private member.
+     *
+     * @param nRateHz - The IPS limit of the main loop. Zero is unlimited.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMainLoopRate(int nRateHz) { this->SetMainThreadIPSLimit(nRateHz); }
+
+    /******************************************************************************
+     * @brief Accessor for the Main Loop IPS private member.
+     *
+     * @return double - The average iterations per second of the main loop during the run.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetMainLoopIPS() { return m_dMainLoopIPS; }
+
+    /******************************************************************************
+     * @brief Accessor for the Total Time private member.
+     *
+     * @return double - The time it took to finish every batch in seconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetTotalTime() { return m_dTotalTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the Average Batch Latency private member.
+     *
+     * @return double - The average time from launching a batch to its follow-up finishing in microseconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetAverageBatchLatency() { return m_dAverageBatchLatency; }
+
+    /******************************************************************************
+     * @brief Accessor for the Primes Found private member.
+     *
+     * @return uint64_t - The number of primes counted by all batches.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetPrimesFound() { return m_nPrimesFound; }
+};
@@ -0,0 +1,194 @@
+/******************************************************************************
+ * @brief Example file that calculates prime numbers with pooled tasks that are
+ *      each handed their own range of numbers, instead of claiming numbers from
+ *      a shared counter.
+ *
+ * @file PrimeNumbersIndexed.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class calculates the first N primes by trial division, like the
+ *      unordered mode of PrimeCalculatorThreadPooled, but uses the range RunPool()
+ *      overload. Each round splits a range of numbers between the tasks, every
+ *      task returns the primes in its range, and the results come back in range
+ *      order. Tasks share nothing while they run, so there is no counter mutex and
+ *      the output is sorted without any extra work.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class PrimeCalculatorThreadIndexed : public AutonomyThread<std::vector<uint64_t>>
+{
+private:
+    // Declare and define private methods and variables.
+    int m_nCount = 10;
+    int m_nTasksPerRound = 256;
+    int m_nPoolThreads = 100;
+    std::vector<uint64_t> m_vPrimes;
+    double m_dCalculationTime = -1.0;
+
+    /******************************************************************************
+     * @brief Check if a number is prime.
+     *
+     * @param nNum - The number to check.
+     * @return true - The number is prime.
+     * @return false - The number is not prime.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static bool IsPrime(uint64_t nNum)
+    {
+        if (nNum <= 1)
+        {
+            return false;
+        }
+        // Compare against the quotient instead of squaring i, so large numbers can't overflow.
+        for (uint64_t i = 2; i <= nNum / i; ++i)
+        {
+            if (nNum % i == 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Create instance variables.
+        std::chrono::system_clock::time_point tmStartTime = std::chrono::system_clock::now();
+        uint64_t nNextNumber = 2;
+        m_vPrimes.clear();
+
+        // Keep going until enough primes are found.
+        while (int(m_vPrimes.size()) < m_nCount)
+        {
+            // Size the round with the prime number theorem, primes near x are about ln(x) apart. Aim a little high so one round is usually enough.
+            double dMissing = double(m_nCount - int(m_vPrimes.size()));
+            double dGap = std::log(double(nNextNumber) + dMissing * std::log(double(nNextNumber) + dMissing + 16.0) + 16.0);
+            uint64_t nRoundSize = uint64_t(dMissing * dGap * 1.05) + m_nTasksPerRound;
+            uint64_t nRoundStart = nNextNumber;
+
+            // Each task tests its own slice of the round.
+            this->RunPool(nRoundSize,
+                          m_nTasksPerRound,
+                          m_nPoolThreads,
+                          [nRoundStart](const uint64_t nStart, const uint64_t nEnd)
+                          {
+                              std::vector<uint64_t> vPrimes;
+                              for (uint64_t nNum = nRoundStart + nStart; nNum < nRoundStart + nEnd; ++nNum)
+                              {
+                                  if (IsPrime(nNum))
+                                  {
+                                      vPrimes.push_back(nNum);
+                                  }
+                              }
+                              return vPrimes;
+                          });
+
+            // Append the slices in order, the last round may overshoot.
+            for (const std::vector<uint64_t> &vSlice : this->GetPoolResults())
+            {
+                size_t nWanted = size_t(m_nCount) - m_vPrimes.size();
+                m_vPrimes.insert(m_vPrimes.end(), vSlice.begin(), vSlice.begin() + std::min(vSlice.size(), nWanted));
+            }
+
+            // Move on to the numbers after this round.
+            nNextNumber = nRoundStart + nRoundSize;
+        }
+
+        // Calculate elapsed time.
+        m_dCalculationTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - tmStartTime).count();
+        // Request stop of main thread.
+        this->RequestStop();
+    }
+
+    /******************************************************************************
+     * @brief Not used, the work is handed out by the range RunPool() overload.
+     *
+     * @return std::vector<uint64_t> - Always empty.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    std::vector<uint64_t> PooledLinearCode() override { return {}; }
+
+public:
+    // Declare and define public methods and variables.
+    PrimeCalculatorThreadIndexed() = default;
+
+    /******************************************************************************
+     * @brief Mutator for the Prime Count private member
+     *
+     * @param nNum - The amount of primes to calculate.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPrimeCount(int nNum) { m_nCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Tasks Per Round private member.
+     *
+     * @param nNum - The number of ranges each round is split into.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetTasksPerRound(int nNum) { m_nTasksPerRound = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Pool Threads private member.
+     *
+     * @param nNum - The number of threads in the pool.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPoolThreads(int nNum) { m_nPoolThreads = nNum; }
+
+    /******************************************************************************
+     * @brief Accessor for the Primes private member.
+     *
+     * @return const std::vector<uint64_t>& - The primes found by the last run, in order.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    const std::vector<uint64_t> &GetPrimes() { return m_vPrimes; }
+
+    /******************************************************************************
+     * @brief Accessor for the Calculation Time private member.
+     *
+     * @return double - The time the last run took in microseconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetCalculationTime() { return m_dCalculationTime; }
+};
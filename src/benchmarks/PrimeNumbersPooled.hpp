@@ -10,9 +10,20 @@
  ******************************************************************************/
 
 #include "../interfaces/AutonomyThread.hpp"
+#include "../util/MillerRabin.hpp"
+#include "../util/PrimalityKernel.hpp"
+#include "../util/PrimeStore.hpp"
+#include "../util/ResultStream.hpp"
 
 /// \cond
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <map>
+#include <span>
 #include <vector>
 #include <shared_mutex>
 
@@ -30,13 +41,37 @@ class PrimeCalculatorThreadPooled : public AutonomyThread<void>
 {
 private:
     // Declare and define private methods and variables.
-    std::vector<int> m_vThreadPrimes;
+    // Read-mostly state. Every pool task reads the kernel and search parameters, so keep them away from the write-heavy members below.
+    alignas(cachealign::nDestructiveSize) std::chrono::system_clock::time_point m_tmStartTime = std::chrono::system_clock::time_point::min();
     int m_nCount = 10;
-    int m_nCurrentCount = 2;
+    int m_nPendingCount = 10;
+    uint64_t m_nPrimeOffset = 0;
+    uint64_t m_nSearchStart = 0;
+    PrimeStore *m_pPrimeStore = nullptr;
+    bool m_bPrimeStoreUsed = false;
+    primality::PrimeTestKernel m_eKernel = primality::PrimeTestKernel::eTrialDivision;
     double m_dCalculationTime = -1.0;
-    std::chrono::system_clock::time_point m_tmStartTime = std::chrono::system_clock::time_point::min();
-    std::shared_mutex m_muVectorWriteMutex;
-    std::shared_mutex m_muCurrentCountWriteMutex;
+    // The candidate counter is written by every pool task, it shares a cache line only with the lock that guards it.
+    alignas(cachealign::nDestructiveSize) std::shared_mutex m_muCurrentCountWriteMutex;
+    uint64_t m_nCurrentCount = 2;
+    uint64_t m_nWheelIndex = 0;
+    // The result stream and its lock get their own cache line. The lock serializes pool tasks pushing into the stream, readers never take it.
+    alignas(cachealign::nDestructiveSize) std::shared_mutex m_muVectorWriteMutex;
+    ResultStream<uint64_t> m_stPrimeStream;
+    std::map<uint64_t, uint32_t> m_mapFinishedBatches;
+    uint64_t m_nNextPublishIndex = 0;
+    int m_nFoundCount = 0;
+    // Ordered trial division. The main thread sets up each round between pool runs, and every block slot is only written by the task that claims it.
+    bool m_bOrderedOutput = true;
+    int m_nBlocksPerRound = 256;
+    bool m_bScatterPhase = false;
+    uint64_t m_nRoundStart = 0;
+    uint64_t m_nBlockSize = 0;
+    std::vector<std::vector<uint64_t>> m_vBlockPrimes;
+    std::vector<size_t> m_vBlockOffsets;
+    std::vector<uint64_t> m_vRoundPrimes;
+    double m_dOrderingTime = 0.0;
+    alignas(cachealign::nDestructiveSize) std::atomic<int> m_nNextBlock = 0;
 
     /******************************************************************************
      * @brief Check if a number if prime.
@@ -48,13 +83,14 @@ private:
      * @author ClayJay3 (claytonraycowen@gmail.com)
      * @date 2023-07-22
      ******************************************************************************/
-    bool IsPrime(int &nNum)
+    bool IsPrime(uint64_t nNum)
     {
         if (nNum <= 1)
         {
             return false;
         }
-        for (int i = 2; i * i <= nNum; ++i)
+        // Compare against the quotient instead of squaring i, so large numbers can't overflow.
+        for (uint64_t i = 2; i <= nNum / i; ++i)
         {
             if (nNum % i == 0)
             {
@@ -74,10 +110,59 @@ private:
      ******************************************************************************/
     void ThreadedContinuousCode() override
     {
-        // Start a thread pool with 100 threads. This will run the code in the PooledLinearCode() method.
-        this->RunDetachedPool(m_nCount, 100);
-        // Wait for Pool to finish.
-        this->JoinPool();
+        // Measure the amount of time it takes to run this code.
+        if (m_tmStartTime == std::chrono::system_clock::time_point::min())
+        {
+            m_tmStartTime = std::chrono::system_clock::now();
+        }
+        // Only compute the primes the store doesn't already have.
+        this->ResumeFromStore();
+
+        // Check which kernel to use.
+        if (m_nPendingCount > 0 && m_eKernel != primality::PrimeTestKernel::eTrialDivision)
+        {
+            // The wheel skips 2, 3 and 5, so publish the ones past the search start first.
+            for (uint64_t nPrime : primality::aWheelPrimes)
+            {
+                if (nPrime >= m_nSearchStart && int(m_stPrimeStream.GetSize()) < m_nPendingCount)
+                {
+                    m_stPrimeStream.Push(nPrime);
+                }
+            }
+            // Batched tasks keep claiming batches until enough primes are found, so one task per thread is enough.
+            m_mapFinishedBatches.clear();
+            m_nNextPublishIndex = m_nWheelIndex;
+            m_nFoundCount = int(m_stPrimeStream.GetSize());
+            this->RunDetachedPool(100, 100);
+            // Wait for Pool to finish.
+            this->JoinPool();
+        }
+        else if (m_nPendingCount > 0 && m_bOrderedOutput)
+        {
+            // Test contiguous blocks in parallel and stitch them together in order.
+            this->CalculatePrimesOrdered();
+        }
+        else if (m_nPendingCount > 0)
+        {
+            // Start a thread pool with 100 threads. This will run the code in the PooledLinearCode() method.
+            this->RunDetachedPool(m_nPendingCount, 100);
+            // Wait for Pool to finish.
+            this->JoinPool();
+        }
+        // Publish the last partial chunk.
+        m_stPrimeStream.Close();
+        // Append the new tail to the store.
+        if (m_bPrimeStoreUsed && (m_eKernel != primality::PrimeTestKernel::eTrialDivision || m_bOrderedOutput))
+        {
+            m_stPrimeStream.ForEachChunk([this](std::span<const uint64_t> spChunk) { m_pPrimeStore->Append(spChunk); });
+        }
+        else if (m_bPrimeStoreUsed)
+        {
+            // Unordered trial division tasks each find the next prime in line, so the results are the right primes but out of order.
+            std::vector<uint64_t> vPrimes = m_stPrimeStream.ToVector();
+            std::sort(vPrimes.begin(), vPrimes.end());
+            m_pPrimeStore->Append(vPrimes);
+        }
         // Store end time.
         std::chrono::system_clock::time_point tmEndTime = std::chrono::system_clock::now();
         // Calculate elapsed time.
@@ -86,6 +171,48 @@ private:
         this->RequestStop();
     }
 
+    /******************************************************************************
+     * @brief Sets up the search for this run. With a usable prime store attached
+     *      the run continues from the last stored prime and only looks for the primes
+     *      the store is missing, otherwise it looks for all of them. A store that
+     *      can't be used stays attached but is left alone, see IsPrimeStoreUsed().
+     *
+     * @return true - The run resumes from the store and appends to it.
+     * @return false - No store, or it is closed or was computed from a different offset.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool ResumeFromStore()
+    {
+        // Without a usable store search for everything.
+        m_nPendingCount = m_nCount;
+        m_bPrimeStoreUsed = this->IsPrimeStoreUsable();
+        if (!m_bPrimeStoreUsed)
+        {
+            return false;
+        }
+
+        // Continue from the end of the store.
+        m_stPrimeStream.Clear();
+        m_nPendingCount = int(std::max<int64_t>(int64_t(m_nCount) - int64_t(m_pPrimeStore->GetCount()), 0));
+        m_nSearchStart = m_pPrimeStore->GetResumePoint();
+        m_nCurrentCount = std::max<uint64_t>(m_nSearchStart, 2);
+        m_nWheelIndex = primality::WheelIndexAtOrAbove(m_nSearchStart);
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Checks if the attached prime store can be resumed from and appended to.
+     *
+     * @return true - A store is attached, open and computed from the calculator's offset.
+     * @return false - No store, or it is closed or was computed from a different offset.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsPrimeStoreUsable() const { return m_pPrimeStore != nullptr && m_pPrimeStore->IsOpen() && m_pPrimeStore->GetOffset() == m_nPrimeOffset; }
+
     /******************************************************************************
      * @brief Any highly parallelizable code that can be used in the main thread
      *       goes here.
@@ -98,9 +225,19 @@ private:
     {
         // Create instance variables.
         bool bFoundPrime = false;
-        // Measure the amount of time it takes to run this code.
-        if (m_tmStartTime == std::chrono::system_clock::time_point::min())
-            m_tmStartTime = std::chrono::system_clock::now();
+
+        // Test whole batches with the SIMD kernel or Miller-Rabin instead.
+        if (m_eKernel != primality::PrimeTestKernel::eTrialDivision)
+        {
+            this->CalculatePrimesBatched();
+            return;
+        }
+        // Test or scatter one block of an ordered round instead.
+        if (m_bOrderedOutput)
+        {
+            this->ProcessBlock();
+            return;
+        }
 
         // Continue working until this thread finds 1 prime.
         while (!bFoundPrime)
@@ -108,7 +245,7 @@ private:
             // Acquire write lock to current count.
             std::unique_lock<std::shared_mutex> lkWriteLockCount(m_muCurrentCountWriteMutex);
             // Get current count number.
-            int nCurrentPrimeTestNumber = m_nCurrentCount;
+            uint64_t nCurrentPrimeTestNumber = m_nCurrentCount;
             // Increment count, this pool thead has the current number.
             ++m_nCurrentCount;
             // Release lock.
@@ -117,16 +254,167 @@ private:
             // Check if number is prime.
             if (this->IsPrime(nCurrentPrimeTestNumber))
             {
-                // Acquire write lock for prime vector.
+                // Acquire write lock for prime stream.
                 std::unique_lock<std::shared_mutex> lkWriteLockVector(m_muVectorWriteMutex);
-                // Append new prime number to vector.
-                m_vThreadPrimes.emplace_back(nCurrentPrimeTestNumber);
+                // Append new prime number to stream.
+                m_stPrimeStream.Push(nCurrentPrimeTestNumber);
                 // Set toggle to stop looping.
                 bFoundPrime = true;
             }
         }
     }
 
+    /******************************************************************************
+     * @brief Claims batches of wheel candidates and tests them with the batched
+     *      primality kernel, or Miller-Rabin for the eMillerRabin kernel or candidates
+     *      past 32 bits, until enough primes have been found. Batches finish out of
+     *      order, so finished batches wait until every batch claimed before them is
+     *      published. That keeps the prime stream sorted while it is being read.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void CalculatePrimesBatched()
+    {
+        // Create instance variables.
+        bool bFoundEnough = false;
+
+        // Continue working until enough primes are found.
+        while (!bFoundEnough)
+        {
+            // Acquire write lock to the wheel position and claim the next batch.
+            std::unique_lock<std::shared_mutex> lkWriteLockCount(m_muCurrentCountWriteMutex);
+            uint64_t nWheelIndex = m_nWheelIndex;
+            m_nWheelIndex += primality::nBatchSize;
+            // Release lock.
+            lkWriteLockCount.unlock();
+
+            // Fill and test the batch.
+            uint64_t aCandidates[primality::nBatchSize];
+            for (int nLane = 0; nLane < primality::nBatchSize; ++nLane)
+            {
+                aCandidates[nLane] = primality::WheelCandidate(nWheelIndex + nLane);
+            }
+            uint32_t nPrimeMask = primality::IsPrimeBatch64(aCandidates, primality::nBatchSize, m_eKernel == primality::PrimeTestKernel::eMillerRabin);
+
+            // Acquire write lock for prime stream and queue the batch.
+            std::unique_lock<std::shared_mutex> lkWriteLockVector(m_muVectorWriteMutex);
+            m_mapFinishedBatches.emplace(nWheelIndex, nPrimeMask);
+            m_nFoundCount += std::popcount(nPrimeMask);
+            // Publish every queued batch that is next in line. The last batch may overshoot, so stop at the count.
+            auto itBatch = m_mapFinishedBatches.begin();
+            while (itBatch != m_mapFinishedBatches.end() && itBatch->first == m_nNextPublishIndex)
+            {
+                for (int nLane = 0; nLane < primality::nBatchSize && int(m_stPrimeStream.GetSize()) < m_nPendingCount; ++nLane)
+                {
+                    if (itBatch->second & (1u << nLane))
+                    {
+                        m_stPrimeStream.Push(primality::WheelCandidate(itBatch->first + nLane));
+                    }
+                }
+                m_nNextPublishIndex += primality::nBatchSize;
+                itBatch = m_mapFinishedBatches.erase(itBatch);
+            }
+            // Check if we are done. Count queued batches too, every batch claimed so far will finish and get published.
+            bFoundEnough = m_nFoundCount >= m_nPendingCount;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Finds the pending primes by trial division in rounds. Each round
+     *      splits a range of numbers into contiguous blocks and the pool tests them
+     *      into block-local vectors, with no shared writes. An exclusive prefix sum of
+     *      the block counts then gives every block its place in the round's output,
+     *      and the pool scatters the blocks into it in parallel. The round is already
+     *      sorted, so it is published straight to the stream.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void CalculatePrimesOrdered()
+    {
+        // Create instance variables.
+        uint64_t nNextNumber = std::max<uint64_t>(m_nSearchStart, 2);
+        m_dOrderingTime = 0.0;
+        m_vBlockPrimes.resize(m_nBlocksPerRound);
+        m_vBlockOffsets.resize(m_nBlocksPerRound);
+
+        // Keep going until enough primes are published.
+        while (int(m_stPrimeStream.GetSize()) < m_nPendingCount)
+        {
+            // Size the round with the prime number theorem, primes near x are about ln(x) apart. Aim a little high so one round is usually enough.
+            double dMissing = double(m_nPendingCount - int(m_stPrimeStream.GetSize()));
+            double dGap = std::log(double(nNextNumber) + dMissing * std::log(double(nNextNumber) + dMissing + 16.0) + 16.0);
+            uint64_t nRoundSize = uint64_t(dMissing * dGap * 1.05) + m_nBlocksPerRound;
+            m_nRoundStart = nNextNumber;
+            m_nBlockSize = (nRoundSize + m_nBlocksPerRound - 1) / m_nBlocksPerRound;
+
+            // Test every block.
+            m_bScatterPhase = false;
+            m_nNextBlock = 0;
+            this->RunDetachedPool(m_nBlocksPerRound, 100);
+            this->JoinPool();
+
+            // Give every block its offset in the output.
+            std::chrono::system_clock::time_point tmOrderStart = std::chrono::system_clock::now();
+            size_t nRoundCount = 0;
+            for (int nBlock = 0; nBlock < m_nBlocksPerRound; ++nBlock)
+            {
+                m_vBlockOffsets[nBlock] = nRoundCount;
+                nRoundCount += m_vBlockPrimes[nBlock].size();
+            }
+            // Scatter the blocks into place.
+            m_vRoundPrimes.resize(nRoundCount);
+            m_bScatterPhase = true;
+            m_nNextBlock = 0;
+            this->RunDetachedPool(m_nBlocksPerRound, 100);
+            this->JoinPool();
+            // Publish the round, the last one may overshoot.
+            size_t nWanted = size_t(m_nPendingCount) - m_stPrimeStream.GetSize();
+            m_stPrimeStream.PushRange(std::span<const uint64_t>(m_vRoundPrimes).first(std::min(nRoundCount, nWanted)));
+            m_dOrderingTime += std::chrono::duration<double, std::micro>(std::chrono::system_clock::now() - tmOrderStart).count();
+
+            // Move on to the numbers after this round.
+            nNextNumber = m_nRoundStart + m_nBlockSize * m_nBlocksPerRound;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Claims the next block of the current round. In the test phase it
+     *      finds the block's primes, in the scatter phase it copies them to the
+     *      block's offset in the round output.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ProcessBlock()
+    {
+        // Claim a block.
+        int nBlock = m_nNextBlock.fetch_add(1, std::memory_order_relaxed);
+        std::vector<uint64_t> &vBlockPrimes = m_vBlockPrimes[nBlock];
+
+        // Check which phase we are in.
+        if (m_bScatterPhase)
+        {
+            std::copy(vBlockPrimes.begin(), vBlockPrimes.end(), m_vRoundPrimes.begin() + m_vBlockOffsets[nBlock]);
+            return;
+        }
+
+        // Test every number in the block.
+        uint64_t nBlockStart = m_nRoundStart + nBlock * m_nBlockSize;
+        vBlockPrimes.clear();
+        for (uint64_t nNum = nBlockStart; nNum < nBlockStart + m_nBlockSize; ++nNum)
+        {
+            if (this->IsPrime(nNum))
+            {
+                vBlockPrimes.push_back(nNum);
+            }
+        }
+    }
+
 public:
     // Declare and define public methods and variables.
     PrimeCalculatorThreadPooled() = default;
@@ -141,6 +429,95 @@ public:
      ******************************************************************************/
     void SetPrimeCount(int nNum) { m_nCount = nNum; }
 
+    /******************************************************************************
+     * @brief Mutator for the Kernel private member.
+     *
+     * @param eKernel - The primality test to use.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetKernel(primality::PrimeTestKernel eKernel) { m_eKernel = eKernel; }
+
+    /******************************************************************************
+     * @brief Mutator for the Ordered Output private member. Only affects trial
+     *      division, the batched kernels always publish in order.
+     *
+     * @param bOrdered - True to test contiguous blocks and publish primes in order, false for
+     *          the original one task per prime engine that publishes them as they are found.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetOrderedOutput(bool bOrdered) { m_bOrderedOutput = bOrdered; }
+
+    /******************************************************************************
+     * @brief Bounds the pool queue. Every engine queues through RunDetachedPool(),
+     *      which runs tasks the full queue rejects on the main thread, so every policy
+     *      still finds every prime. The unordered trial division engine queues one task
+     *      per prime and the ordered one 256 blocks per round, the batched kernels only
+     *      queue one task per thread and never fill a queue bigger than that.
+     *
+     * @param nCapacity - The most tasks the queue may hold. 0 for unbounded.
+     * @param ePolicy - What happens to a task queued while the queue is full.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetQueueCapacity(size_t nCapacity, ElasticThreadPool::QueueFullPolicy ePolicy = ElasticThreadPool::eBlock)
+    {
+        this->SetPoolQueueCapacity(nCapacity, ePolicy);
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Prime Offset private member. The calculator finds the
+     *      first primes at or above this number. Clears any previous results.
+     *
+     * @param nOffset - The number to start searching from.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPrimeOffset(uint64_t nOffset)
+    {
+        m_nPrimeOffset = nOffset;
+        m_bPrimeStoreUsed = this->IsPrimeStoreUsable();
+        this->ClearPrimes();
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Prime Store private member. Runs load the primes the
+     *      store already has and append the ones they compute. The store must be
+     *      opened with the same offset as the calculator and outlive it, pass nullptr
+     *      to detach it. A store with a different offset stays attached but unused
+     *      until the offsets match again.
+     *
+     * @param pPrimeStore - The store to use.
+     * @return true - The store will be used by the next run.
+     * @return false - Detached, or the store is closed or was computed from a different offset.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool SetPrimeStore(PrimeStore *pPrimeStore)
+    {
+        m_pPrimeStore = pPrimeStore;
+        m_bPrimeStoreUsed = this->IsPrimeStoreUsable();
+        this->ClearPrimes();
+        return m_bPrimeStoreUsed;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Prime Store Used private member.
+     *
+     * @return true - The attached store was used by the last run, or will be by the next one.
+     * @return false - No store, or it doesn't match the calculator's offset and is ignored.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsPrimeStoreUsed() const { return m_bPrimeStoreUsed; }
+
     /******************************************************************************
      * @brief Accessor for the Prime Counter private member.
      *
@@ -154,12 +531,56 @@ public:
     /******************************************************************************
      * @brief Accessor for the Primes private member.
      *
-     * @return std::vector<int> - A vector of the resultant primes.
+     * @return std::vector<uint64_t> - A copy of the resultant primes. Prefer ForEachPrimeChunk() to avoid the copy.
      *
      * @author ClayJay3 (claytonraycowen@gmail.com)
      * @date 2023-07-22
      ******************************************************************************/
-    std::vector<int> GetPrimes() { return m_vThreadPrimes; }
+    std::vector<uint64_t> GetPrimes()
+    {
+        std::vector<uint64_t> vPrimes;
+        this->ForEachPrimeChunk([&vPrimes](std::span<const uint64_t> spChunk) { vPrimes.insert(vPrimes.end(), spChunk.begin(), spChunk.end()); });
+        return vPrimes;
+    }
+
+    /******************************************************************************
+     * @brief Zero-copy access to the resultant primes. Calls a function with a
+     *      read-only span of each completed chunk, in order. Without a prime store
+     *      this is safe while a run is in progress and visits the chunks published
+     *      so far. With a store attached the span points into the mapped file, so
+     *      only call it between runs. Spans are invalidated by the next run or
+     *      ClearPrimes().
+     *
+     * @tparam F - The function type.
+     * @param fnVisitor - Called with a std::span<const uint64_t> for each chunk.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+    void ForEachPrimeChunk(F &&fnVisitor)
+    {
+        // Results live in the store when it is used.
+        if (m_bPrimeStoreUsed)
+        {
+            std::span<const uint64_t> spStored = m_pPrimeStore->GetPrimes();
+            fnVisitor(spStored.first(std::min<size_t>(spStored.size(), m_nCount)));
+            return;
+        }
+        m_stPrimeStream.ForEachChunk(fnVisitor);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Prime Stream private member. Subscribe to it to read
+     *      the primes this run computes in chunks while it is still running. With
+     *      a prime store attached it only holds the primes the store was missing.
+     *
+     * @return const ResultStream<uint64_t>& - The stream the calculator publishes primes to.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    const ResultStream<uint64_t> &GetPrimeStream() { return m_stPrimeStream; }
 
     /******************************************************************************
      * @brief Accessor for the Calculation Time private member.
@@ -173,7 +594,49 @@ public:
     double GetCalculationTime() { return m_dCalculationTime; }
 
     /******************************************************************************
-     * @brief Clears the prime results vector.
+     * @brief Accessor for the Ordering Time private member.
+     *
+     * @return double - The time in microseconds the last ordered trial division run spent on
+     *          prefix sums, scattering and publishing, included in the calculation time.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetOrderingTime() { return m_dOrderingTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the longest the pool queue got during the last run.
+     *
+     * @return size_t - The peak number of queued tasks.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetPeakQueueLength() const { return this->GetPoolPeakQueueLength(); }
+
+    /******************************************************************************
+     * @brief Accessor for the number of tasks the full queue rejected during the last run.
+     *
+     * @return uint64_t - Rejected tasks, each one was queued again later.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetRejectedTaskCount() const { return this->GetPoolRejectedTaskCount(); }
+
+    /******************************************************************************
+     * @brief Accessor for the number of tasks the main thread ran itself because
+     *      the queue was full during the last run.
+     *
+     * @return uint64_t - Tasks run by the caller.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetCallerRunTaskCount() const { return this->GetPoolCallerRunTaskCount(); }
+
+    /******************************************************************************
+     * @brief Clears the prime results. Nobody may be reading the prime stream.
      *
      *
      * @author ClayJay3 (claytonraycowen@gmail.com)
@@ -181,10 +644,12 @@ public:
      ******************************************************************************/
     void ClearPrimes()
     {
-        // Clear number vector.
-        m_vThreadPrimes.clear();
+        // Clear number stream.
+        m_stPrimeStream.Clear();
         // Reset other vars.
-        m_nCurrentCount = 2;
+        m_nSearchStart = m_nPrimeOffset;
+        m_nCurrentCount = std::max<uint64_t>(m_nPrimeOffset, 2);
+        m_nWheelIndex = primality::WheelIndexAtOrAbove(m_nPrimeOffset);
         m_dCalculationTime = -1.0;
         // Reset start time.
         m_tmStartTime = std::chrono::system_clock::time_point::min();
@@ -10,9 +10,16 @@
  ******************************************************************************/
 
 #include "../interfaces/AutonomyThread.hpp"
+#include "../util/MillerRabin.hpp"
+#include "../util/PrimalityKernel.hpp"
+#include "../util/PrimeStore.hpp"
+#include "../util/ResultStream.hpp"
 
 /// \cond
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <span>
 #include <vector>
 
 /// \endcond
@@ -29,9 +36,16 @@ class PrimeCalculatorThreadSingleThreaded : public AutonomyThread<void>
 {
 private:
     // Declare and define private methods and variables.
-    std::vector<int> m_vThreadPrimes;
+    ResultStream<uint64_t> m_stPrimeStream;
     int m_nCount = 10;
-    int m_nCurrentCount = 2;
+    int m_nPendingCount = 10;
+    uint64_t m_nPrimeOffset = 0;
+    uint64_t m_nSearchStart = 0;
+    PrimeStore *m_pPrimeStore = nullptr;
+    bool m_bPrimeStoreUsed = false;
+    uint64_t m_nCurrentCount = 2;
+    uint64_t m_nWheelIndex = 0;
+    primality::PrimeTestKernel m_eKernel = primality::PrimeTestKernel::eTrialDivision;
     double m_dCalculationTime = -1.0;
     std::chrono::system_clock::time_point m_tmStartTime = std::chrono::system_clock::time_point::min();
 
@@ -46,13 +60,14 @@ private:
      * @date 2023-07-22
      ******************************************************************************/
     bool
-    IsPrime(int &nNum)
+    IsPrime(uint64_t nNum)
     {
         if (nNum <= 1)
         {
             return false;
         }
-        for (int i = 2; i * i <= nNum; ++i)
+        // Compare against the quotient instead of squaring i, so large numbers can't overflow.
+        for (uint64_t i = 2; i <= nNum / i; ++i)
         {
             if (nNum % i == 0)
             {
@@ -73,13 +88,20 @@ private:
      ******************************************************************************/
     void CalculatePrimes(int &nCount)
     {
+        // Test a whole batch of wheel candidates per iteration with the SIMD kernel or Miller-Rabin.
+        if (m_eKernel != primality::PrimeTestKernel::eTrialDivision)
+        {
+            this->CalculatePrimesBatched(nCount);
+            return;
+        }
+
         // Loop until we have the required amount of primes.
-        if (int(m_vThreadPrimes.size()) < nCount)
+        if (int(m_stPrimeStream.GetSize()) < nCount)
         {
             // Check if our current number is a prime.
             if (IsPrime(m_nCurrentCount))
             {
-                m_vThreadPrimes.push_back(m_nCurrentCount);
+                m_stPrimeStream.Push(m_nCurrentCount);
             }
 
             // Increment counter.
@@ -87,6 +109,53 @@ private:
         }
     }
 
+    /******************************************************************************
+     * @brief Calculate primes one batch of wheel candidates at a time using the
+     *      batched primality kernel, or Miller-Rabin for the eMillerRabin kernel or
+     *      candidates past 32 bits.
+     *
+     * @param nCount - The number of primes to calculate.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void CalculatePrimesBatched(int nCount)
+    {
+        // Loop until we have the required amount of primes.
+        if (int(m_stPrimeStream.GetSize()) < nCount)
+        {
+            // The wheel skips 2, 3 and 5, so add the ones past the offset first.
+            if (m_stPrimeStream.GetSize() == 0 && m_nWheelIndex == primality::WheelIndexAtOrAbove(m_nSearchStart))
+            {
+                for (uint64_t nPrime : primality::aWheelPrimes)
+                {
+                    if (nPrime >= m_nSearchStart && int(m_stPrimeStream.GetSize()) < nCount)
+                    {
+                        m_stPrimeStream.Push(nPrime);
+                    }
+                }
+            }
+
+            // Fill and test the next batch of candidates.
+            uint64_t aCandidates[primality::nBatchSize];
+            for (int nLane = 0; nLane < primality::nBatchSize; ++nLane)
+            {
+                aCandidates[nLane] = primality::WheelCandidate(m_nWheelIndex + nLane);
+            }
+            uint32_t nPrimeMask = primality::IsPrimeBatch64(aCandidates, primality::nBatchSize, m_eKernel == primality::PrimeTestKernel::eMillerRabin);
+            m_nWheelIndex += primality::nBatchSize;
+
+            // Store the primes in order. The last batch may overshoot, so stop at the count.
+            for (int nLane = 0; nLane < primality::nBatchSize && int(m_stPrimeStream.GetSize()) < nCount; ++nLane)
+            {
+                if (nPrimeMask & (1u << nLane))
+                {
+                    m_stPrimeStream.Push(aCandidates[nLane]);
+                }
+            }
+        }
+    }
+
     /******************************************************************************
      * @brief This code will run in a separate thread. Main code goes here.
      *
@@ -98,13 +167,24 @@ private:
     {
         // Measure the amount of time it takes to run this code.
         if (m_tmStartTime == std::chrono::system_clock::time_point::min())
+        {
             m_tmStartTime = std::chrono::system_clock::now();
+            // Only compute the primes the store doesn't already have.
+            this->ResumeFromStore();
+        }
         // Change this to calculate a different number of prime numbers.
-        CalculatePrimes(m_nCount);
+        CalculatePrimes(m_nPendingCount);
 
         // Check if we have reached the desired number of primes.
-        if (int(this->GetPrimes().size()) >= this->GetDesiredPrimeAmount())
+        if (int(m_stPrimeStream.GetSize()) >= m_nPendingCount)
         {
+            // Publish the last partial chunk.
+            m_stPrimeStream.Close();
+            // Append the new tail to the store.
+            if (m_bPrimeStoreUsed)
+            {
+                m_stPrimeStream.ForEachChunk([this](std::span<const uint64_t> spChunk) { m_pPrimeStore->Append(spChunk); });
+            }
             // Call thread stop.
             this->RequestStop();
             // Store end time.
@@ -114,6 +194,48 @@ private:
         }
     }
 
+    /******************************************************************************
+     * @brief Sets up the search for this run. With a usable prime store attached
+     *      the run continues from the last stored prime and only looks for the primes
+     *      the store is missing, otherwise it looks for all of them. A store that
+     *      can't be used stays attached but is left alone, see IsPrimeStoreUsed().
+     *
+     * @return true - The run resumes from the store and appends to it.
+     * @return false - No store, or it is closed or was computed from a different offset.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool ResumeFromStore()
+    {
+        // Without a usable store search for everything.
+        m_nPendingCount = m_nCount;
+        m_bPrimeStoreUsed = this->IsPrimeStoreUsable();
+        if (!m_bPrimeStoreUsed)
+        {
+            return false;
+        }
+
+        // Continue from the end of the store.
+        m_stPrimeStream.Clear();
+        m_nPendingCount = int(std::max<int64_t>(int64_t(m_nCount) - int64_t(m_pPrimeStore->GetCount()), 0));
+        m_nSearchStart = m_pPrimeStore->GetResumePoint();
+        m_nCurrentCount = std::max<uint64_t>(m_nSearchStart, 2);
+        m_nWheelIndex = primality::WheelIndexAtOrAbove(m_nSearchStart);
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Checks if the attached prime store can be resumed from and appended to.
+     *
+     * @return true - A store is attached, open and computed from the calculator's offset.
+     * @return false - No store, or it is closed or was computed from a different offset.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsPrimeStoreUsable() const { return m_pPrimeStore != nullptr && m_pPrimeStore->IsOpen() && m_pPrimeStore->GetOffset() == m_nPrimeOffset; }
+
     /******************************************************************************
      * @brief Any highly parallelizable code that can be used in the main thread
      *       goes here.
@@ -138,6 +260,65 @@ public:
      ******************************************************************************/
     void SetPrimeCount(int nNum) { m_nCount = nNum; }
 
+    /******************************************************************************
+     * @brief Mutator for the Kernel private member.
+     *
+     * @param eKernel - The primality test to use.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetKernel(primality::PrimeTestKernel eKernel) { m_eKernel = eKernel; }
+
+    /******************************************************************************
+     * @brief Mutator for the Prime Offset private member. The calculator finds the
+     *      first primes at or above this number. Clears any previous results.
+     *
+     * @param nOffset - The number to start searching from.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPrimeOffset(uint64_t nOffset)
+    {
+        m_nPrimeOffset = nOffset;
+        m_bPrimeStoreUsed = this->IsPrimeStoreUsable();
+        this->ClearPrimes();
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Prime Store private member. Runs load the primes the
+     *      store already has and append the ones they compute. The store must be
+     *      opened with the same offset as the calculator and outlive it, pass nullptr
+     *      to detach it. A store with a different offset stays attached but unused
+     *      until the offsets match again.
+     *
+     * @param pPrimeStore - The store to use.
+     * @return true - The store will be used by the next run.
+     * @return false - Detached, or the store is closed or was computed from a different offset.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool SetPrimeStore(PrimeStore *pPrimeStore)
+    {
+        m_pPrimeStore = pPrimeStore;
+        m_bPrimeStoreUsed = this->IsPrimeStoreUsable();
+        this->ClearPrimes();
+        return m_bPrimeStoreUsed;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Prime Store Used private member.
+     *
+     * @return true - The attached store was used by the last run, or will be by the next one.
+     * @return false - No store, or it doesn't match the calculator's offset and is ignored.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsPrimeStoreUsed() const { return m_bPrimeStoreUsed; }
+
     /******************************************************************************
      * @brief Accessor for the Prime Counter private member.
      *
@@ -151,12 +332,56 @@ public:
     /******************************************************************************
      * @brief Accessor for the Primes private member.
      *
-     * @return std::vector<int> - A vector of the resultant primes.
+     * @return std::vector<uint64_t> - A copy of the resultant primes. Prefer ForEachPrimeChunk() to avoid the copy.
      *
      * @author ClayJay3 (claytonraycowen@gmail.com)
      * @date 2023-07-22
      ******************************************************************************/
-    std::vector<int> GetPrimes() { return m_vThreadPrimes; }
+    std::vector<uint64_t> GetPrimes()
+    {
+        std::vector<uint64_t> vPrimes;
+        this->ForEachPrimeChunk([&vPrimes](std::span<const uint64_t> spChunk) { vPrimes.insert(vPrimes.end(), spChunk.begin(), spChunk.end()); });
+        return vPrimes;
+    }
+
+    /******************************************************************************
+     * @brief Zero-copy access to the resultant primes. Calls a function with a
+     *      read-only span of each completed chunk, in order. Without a prime store
+     *      this is safe while a run is in progress and visits the chunks published
+     *      so far. With a store attached the span points into the mapped file, so
+     *      only call it between runs. Spans are invalidated by the next run or
+     *      ClearPrimes().
+     *
+     * @tparam F - The function type.
+     * @param fnVisitor - Called with a std::span<const uint64_t> for each chunk.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+    void ForEachPrimeChunk(F &&fnVisitor)
+    {
+        // Results live in the store when it is used.
+        if (m_bPrimeStoreUsed)
+        {
+            std::span<const uint64_t> spStored = m_pPrimeStore->GetPrimes();
+            fnVisitor(spStored.first(std::min<size_t>(spStored.size(), m_nCount)));
+            return;
+        }
+        m_stPrimeStream.ForEachChunk(fnVisitor);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Prime Stream private member. Subscribe to it to read
+     *      the primes this run computes in chunks while it is still running. With
+     *      a prime store attached it only holds the primes the store was missing.
+     *
+     * @return const ResultStream<uint64_t>& - The stream the calculator publishes primes to.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    const ResultStream<uint64_t> &GetPrimeStream() { return m_stPrimeStream; }
 
     /******************************************************************************
      * @brief Accessor for the Calculation Time private member.
@@ -170,7 +395,7 @@ public:
     double GetCalculationTime() { return m_dCalculationTime; }
 
     /******************************************************************************
-     * @brief Clears the prime results vector.
+     * @brief Clears the prime results. Nobody may be reading the prime stream.
      *
      *
      * @author ClayJay3 (claytonraycowen@gmail.com)
@@ -178,10 +403,12 @@ public:
      ******************************************************************************/
     void ClearPrimes()
     {
-        // Clear number vector.
-        m_vThreadPrimes.clear();
+        // Clear number stream.
+        m_stPrimeStream.Clear();
         // Reset other vars.
-        m_nCurrentCount = 2;
+        m_nSearchStart = m_nPrimeOffset;
+        m_nCurrentCount = std::max<uint64_t>(m_nPrimeOffset, 2);
+        m_nWheelIndex = primality::WheelIndexAtOrAbove(m_nPrimeOffset);
         m_dCalculationTime = -1.0;
         // Reset start time.
         m_tmStartTime = std::chrono::system_clock::time_point::min();
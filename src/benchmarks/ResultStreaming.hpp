@@ -0,0 +1,207 @@
+/******************************************************************************
+ * @brief Example file that reads a prime calculator's results while it is still
+ *      running, either by subscribing to its result stream or by copying the
+ *      whole result set over and over.
+ *
+ * @file ResultStreaming.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+#include "../util/ResultStream.hpp"
+
+/// \cond
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class consumes a stream of primes in its main thread. In streaming
+ *      mode it subscribes to the stream and sleeps until each chunk is published,
+ *      reading it in place. In snapshot mode it copies every published prime out
+ *      at a fixed rate, the way callers of GetPrimes() used to, and only looks at
+ *      the new ones. Both modes checksum what they read, so the work done per prime
+ *      is the same and the difference is the cost of getting at the data.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class PrimeStreamConsumer : public AutonomyThread<void>
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // How the consumer reads the results.
+    enum ConsumeMode
+    {
+        eStreaming,
+        eSnapshot
+    };
+
+private:
+    // Declare and define private methods and variables.
+    ConsumeMode m_eMode = eStreaming;
+    int m_nSnapshotRate = 1000;
+    const ResultStream<uint64_t> *m_pStream = nullptr;
+    std::optional<ResultStream<uint64_t>::Cursor> m_stCursor;
+    // Results.
+    uint64_t m_nPrimesRead = 0;
+    uint64_t m_nChunksRead = 0;
+    uint64_t m_nBytesCopied = 0;
+    uint64_t m_nChecksum = 0;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Check which mode to use.
+        if (m_eMode == eStreaming)
+        {
+            // Subscribe on the first iteration.
+            if (!m_stCursor)
+            {
+                m_stCursor.emplace(m_pStream->Subscribe());
+            }
+
+            // Sleep until a chunk is published and read it in place.
+            std::span<const uint64_t> spChunk = m_stCursor->WaitNext();
+            for (uint64_t nPrime : spChunk)
+            {
+                m_nChecksum = m_nChecksum * 31 + nPrime;
+            }
+            m_nPrimesRead += spChunk.size();
+            m_nChunksRead += !spChunk.empty();
+
+            // Check if we have read everything.
+            if (m_stCursor->IsFinished())
+            {
+                this->RequestStop();
+            }
+        }
+        else
+        {
+            // Check closed before copying, so the last copy is complete.
+            bool bClosed = m_pStream->IsClosed();
+
+            // Copy everything out and checksum the primes we haven't seen.
+            std::vector<uint64_t> vSnapshot = m_pStream->ToVector();
+            for (size_t nIter = m_nPrimesRead; nIter < vSnapshot.size(); ++nIter)
+            {
+                m_nChecksum = m_nChecksum * 31 + vSnapshot[nIter];
+            }
+            m_nBytesCopied += vSnapshot.size() * sizeof(uint64_t);
+            m_nChunksRead += vSnapshot.size() > m_nPrimesRead;
+            m_nPrimesRead = vSnapshot.size();
+
+            // Check if we have read everything.
+            if (bClosed)
+            {
+                this->RequestStop();
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Any highly parallelizable code that can be used in the main thread
+     *       goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override {}
+
+public:
+    // Declare and define public methods and variables.
+    PrimeStreamConsumer() = default;
+
+    /******************************************************************************
+     * @brief Resets the results and sets the stream to read before a new run.
+     *
+     * @param pStream - The stream to consume. Must stay alive and not be cleared until Join() returns.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetStream(const ResultStream<uint64_t> *pStream)
+    {
+        // Set the stream and drop the old cursor.
+        m_pStream = pStream;
+        m_stCursor.reset();
+        // Reset results.
+        m_nPrimesRead = 0;
+        m_nChunksRead = 0;
+        m_nBytesCopied = 0;
+        m_nChecksum = 0;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Mode private member. Also sets the main loop rate,
+     *      streaming is unlimited because it sleeps in WaitNext().
+     *
+     * @param eMode - Whether to subscribe to the stream or copy snapshots.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMode(ConsumeMode eMode)
+    {
+        m_eMode = eMode;
+        this->SetMainThreadIPSLimit(eMode == eStreaming ? 0 : m_nSnapshotRate);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Primes Read private member.
+     *
+     * @return uint64_t - The number of primes the consumer has read.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetPrimesRead() { return m_nPrimesRead; }
+
+    /******************************************************************************
+     * @brief Accessor for the Chunks Read private member.
+     *
+     * @return uint64_t - The number of reads that returned new primes.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetChunksRead() { return m_nChunksRead; }
+
+    /******************************************************************************
+     * @brief Accessor for the Bytes Copied private member.
+     *
+     * @return uint64_t - The number of bytes copied out of the stream. Zero when streaming.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetBytesCopied() { return m_nBytesCopied; }
+
+    /******************************************************************************
+     * @brief Accessor for the Checksum private member.
+     *
+     * @return uint64_t - A checksum of every prime read, in order. Matches between modes.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetChecksum() { return m_nChecksum; }
+};
@@ -0,0 +1,355 @@
+/******************************************************************************
+ * @brief Example file that runs a rover-like set of subsystems together, each at
+ *      its own rate with its own synthetic load, and measures how well each one
+ *      keeps its schedule.
+ *
+ * @file RoverSystem.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include "../../external/threadpool/include/BS_thread_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <time.h>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The rate and synthetic load of one simulated subsystem.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct RoverSubsystemConfig
+{
+public:
+    // Declare public member variables.
+    std::string szName;
+    int nRateHz = 10;                   // Main loop IPS limit.
+    int nWorkMicroseconds = 0;          // CPU time burned by every main loop iteration.
+    int nBurstEvery = 0;                // Run a pool burst every this many iterations. 0 for never.
+    int nBurstTasks = 0;                // Pool tasks per burst.
+    int nBurstThreads = 0;              // Pool threads per burst.
+    int nBurstWorkMicroseconds = 0;     // CPU time burned by every pool task.
+};
+
+/******************************************************************************
+ * @brief How well one subsystem kept its schedule over the measured window.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct RoverSubsystemResult
+{
+public:
+    // Declare public member variables.
+    std::string szName;
+    int nRateHz = 0;
+    double dAchievedIPS = 0.0;           // Measured iterations per second.
+    double dJitterMicroseconds = 0.0;    // Standard deviation of the time between iteration starts.
+    double dWorstLatency = 0.0;          // Longest time from when an iteration was due until it finished, in microseconds.
+    uint64_t nIterations = 0;
+    uint64_t nDeadlineMisses = 0;        // Iterations that finished after the next one was due.
+    uint64_t nOverruns = 0;              // Iterations whose own run time went over budget, from AutonomyThread.
+    double dWorstOverrun = 0.0;          // Most an iteration went over budget, in microseconds.
+    std::array<uint64_t, AutonomyThread<void>::nBudgetHistogramBuckets> aBudgetHistogram = {};
+};
+
+/******************************************************************************
+ * @brief One simulated subsystem. Every iteration burns a fixed amount of CPU
+ *      time, and every few iterations it also fans work out to its pool and waits
+ *      for it, like the detector bursting into RunPool(). Work is measured in
+ *      thread CPU time so it stays the same amount of work when the machine is busy.
+ *
+ *      An iteration is due one period after the previous one started. Its latency
+ *      is the time from being due until it finishes, and it misses its deadline if
+ *      that is longer than a period.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class RoverSubsystem : public AutonomyThread<void>
+{
+private:
+    // Declare and define private methods and variables.
+    RoverSubsystemConfig m_stConfig;
+    const std::atomic_bool *m_pMeasuring = nullptr;
+    bool m_bWasMeasuring = false;
+    std::chrono::steady_clock::time_point m_tmLastStart;
+    // Results.
+    uint64_t m_nIterations = 0;
+    uint64_t m_nDeadlineMisses = 0;
+    double m_dIntervalSum = 0.0;
+    double m_dIntervalSquareSum = 0.0;
+    double m_dWorstLatency = 0.0;
+    std::chrono::steady_clock::time_point m_tmFirstMeasuredStart;
+    std::chrono::steady_clock::time_point m_tmLastMeasuredStart;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Create instance variables.
+        std::chrono::steady_clock::time_point tmStart = std::chrono::steady_clock::now();
+        bool bMeasuring = m_pMeasuring->load(std::memory_order_relaxed);
+        bool bMeasureInterval = bMeasuring && m_bWasMeasuring;
+        std::chrono::steady_clock::time_point tmDue = m_tmLastStart + std::chrono::microseconds(1000000 / m_stConfig.nRateHz);
+
+        // Do this iteration's work.
+        BurnCPU(m_stConfig.nWorkMicroseconds);
+        if (m_stConfig.nBurstEvery > 0 && (m_nIterations + 1) % m_stConfig.nBurstEvery == 0)
+        {
+            this->RunDetachedPool(m_stConfig.nBurstTasks, m_stConfig.nBurstThreads);
+            this->JoinPool();
+        }
+        std::chrono::steady_clock::time_point tmEnd = std::chrono::steady_clock::now();
+
+        // Record stats while the benchmark is measuring.
+        if (bMeasuring)
+        {
+            if (m_nIterations == 0)
+            {
+                m_tmFirstMeasuredStart = tmStart;
+                // The base class accounts this iteration after it returns, so the window starts here.
+                this->ResetOverrunStats();
+            }
+            m_tmLastMeasuredStart = tmStart;
+            // The first measured iteration has no previous start to be due from.
+            if (bMeasureInterval)
+            {
+                double dInterval = std::chrono::duration<double, std::micro>(tmStart - m_tmLastStart).count();
+                double dLatency = std::chrono::duration<double, std::micro>(tmEnd - tmDue).count();
+                m_dIntervalSum += dInterval;
+                m_dIntervalSquareSum += dInterval * dInterval;
+                m_dWorstLatency = std::max(m_dWorstLatency, dLatency);
+                m_nDeadlineMisses += dLatency > 1e6 / m_stConfig.nRateHz;
+            }
+            ++m_nIterations;
+        }
+        m_bWasMeasuring = bMeasuring;
+        m_tmLastStart = tmStart;
+    }
+
+    /******************************************************************************
+     * @brief Each pool task burns its share of a burst.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override { BurnCPU(m_stConfig.nBurstWorkMicroseconds); }
+
+    /******************************************************************************
+     * @brief Spins until this thread has used the given amount of CPU time. Time
+     *      spent preempted doesn't count, so a busy machine makes it take longer.
+     *
+     * @param nMicroseconds - The CPU time to use.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static void BurnCPU(int nMicroseconds)
+    {
+        // Create instance variables.
+        struct timespec stStart;
+        struct timespec stNow;
+        volatile uint64_t nSink = 0;
+
+        // Spin in short bursts between clock reads.
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &stStart);
+        int64_t nTargetNanoseconds = int64_t(nMicroseconds) * 1000;
+        do
+        {
+            for (int nIter = 0; nIter < 256; ++nIter)
+            {
+                nSink = nSink + nIter;
+            }
+            clock_gettime(CLOCK_THREAD_CPUTIME_ID, &stNow);
+        } while ((stNow.tv_sec - stStart.tv_sec) * 1000000000ll + (stNow.tv_nsec - stStart.tv_nsec) < nTargetNanoseconds);
+    }
+
+public:
+    /******************************************************************************
+     * @brief Construct a new Rover Subsystem object.
+     *
+     * @param stConfig - The subsystem's rate and load.
+     * @param pMeasuring - Flag set by the benchmark while iterations should be recorded.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    RoverSubsystem(const RoverSubsystemConfig &stConfig, const std::atomic_bool *pMeasuring)
+    {
+        // Initialize member variables.
+        m_stConfig = stConfig;
+        m_stConfig.nRateHz = std::max(m_stConfig.nRateHz, 1);
+        m_pMeasuring = pMeasuring;
+        this->SetMainThreadIPSLimit(m_stConfig.nRateHz);
+        // Show up in the telemetry monitor under the subsystem's name.
+        this->RegisterTelemetry(m_stConfig.szName);
+    }
+
+    /******************************************************************************
+     * @brief Calculates the results. Only call this after the subsystem has been joined.
+     *
+     * @return RoverSubsystemResult - How well the subsystem kept its schedule.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    RoverSubsystemResult GetResult() const
+    {
+        // Create instance variables.
+        RoverSubsystemResult stResult;
+        uint64_t nIntervals = m_nIterations > 0 ? m_nIterations - 1 : 0;
+
+        // Fill in the results.
+        stResult.szName = m_stConfig.szName;
+        stResult.nRateHz = m_stConfig.nRateHz;
+        stResult.nIterations = m_nIterations;
+        stResult.nDeadlineMisses = m_nDeadlineMisses;
+        stResult.dWorstLatency = m_dWorstLatency;
+        stResult.nOverruns = this->GetOverrunCount();
+        stResult.dWorstOverrun = double(this->GetWorstOverrun().count());
+        stResult.aBudgetHistogram = this->GetBudgetHistogram();
+        if (nIntervals > 0)
+        {
+            double dMeanInterval = m_dIntervalSum / nIntervals;
+            stResult.dAchievedIPS = nIntervals / std::chrono::duration<double>(m_tmLastMeasuredStart - m_tmFirstMeasuredStart).count();
+            stResult.dJitterMicroseconds = std::sqrt(std::max(0.0, m_dIntervalSquareSum / nIntervals - dMeanInterval * dMeanInterval));
+        }
+
+        return stResult;
+    }
+};
+
+/******************************************************************************
+ * @brief This class builds a set of subsystems from their configs, starts them
+ *      all, measures them together for a while, then stops them and collects how
+ *      well each kept its rate. Mirrors the rover process, where cameras,
+ *      navigation and the drive loop all share the same cores.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class RoverSystemBenchmark
+{
+private:
+    // Declare and define private methods and variables.
+    std::vector<RoverSubsystemConfig> m_vConfigs;
+    double m_dDurationSeconds = 3.0;
+    std::vector<RoverSubsystemResult> m_vResults;
+
+public:
+    // Declare and define public methods and variables.
+    RoverSystemBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Adds a subsystem to the simulated system.
+     *
+     * @param stConfig - The subsystem's rate and load.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void AddSubsystem(const RoverSubsystemConfig &stConfig) { m_vConfigs.push_back(stConfig); }
+
+    /******************************************************************************
+     * @brief Removes every subsystem.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ClearSubsystems() { m_vConfigs.clear(); }
+
+    /******************************************************************************
+     * @brief Mutator for the Duration private member.
+     *
+     * @param dSeconds - How long the subsystems are measured for.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetDuration(double dSeconds) { m_dDurationSeconds = dSeconds; }
+
+    /******************************************************************************
+     * @brief Creates and starts every subsystem, measures them for the duration,
+     *      then stops them and gathers their results.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Run()
+    {
+        // Create instance variables.
+        std::atomic_bool bMeasuring = false;
+        std::vector<std::unique_ptr<RoverSubsystem>> vSubsystems;
+
+        // Create subsystems.
+        for (const RoverSubsystemConfig &stConfig : m_vConfigs)
+        {
+            vSubsystems.emplace_back(std::make_unique<RoverSubsystem>(stConfig, &bMeasuring));
+        }
+
+        // Start() blocks for a whole period, so start them all at once from a helper pool.
+        {
+            BS::thread_pool thStarter(vSubsystems.size());
+            thStarter.detach_loop(size_t(0), vSubsystems.size(), [&vSubsystems](size_t nIndex) { vSubsystems[nIndex]->Start(); });
+            thStarter.wait();
+        }
+
+        // Measure only once everything is running together.
+        bMeasuring = true;
+        std::this_thread::sleep_for(std::chrono::microseconds(int64_t(m_dDurationSeconds * 1e6)));
+        bMeasuring = false;
+
+        // Stop all of them before joining any of them.
+        for (std::unique_ptr<RoverSubsystem> &pSubsystem : vSubsystems)
+        {
+            pSubsystem->RequestStop();
+        }
+        m_vResults.clear();
+        for (std::unique_ptr<RoverSubsystem> &pSubsystem : vSubsystems)
+        {
+            pSubsystem->Join();
+            m_vResults.push_back(pSubsystem->GetResult());
+        }
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Results private member.
+     *
+     * @return const std::vector<RoverSubsystemResult>& - One result per subsystem, in the order they were added.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    const std::vector<RoverSubsystemResult> &GetResults() const { return m_vResults; }
+};
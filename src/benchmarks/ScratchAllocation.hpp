@@ -0,0 +1,260 @@
+/******************************************************************************
+ * @brief Example file that allocates short lived buffers from many pool threads,
+ *      either from the global heap or from each thread's scratch arena.
+ *
+ * @file ScratchAllocation.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class runs a fixed number of frames. Every frame the main loop
+ *      builds a scratch list, then queues pool tasks that each build and throw away
+ *      a batch of vectors of random sizes. The code is the same in both modes, only
+ *      the memory resource given to the std::pmr containers changes. In heap mode
+ *      every buffer goes through new and delete, so the pool threads fight over the
+ *      allocator. In arena mode buffers come from the thread's scratch arena, which
+ *      is reset when the task or iteration returns.
+ *
+ *      Both modes compute the same values, so the checksum must match.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class ScratchAllocationBenchmark : public AutonomyThread<void>
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // Where the scratch buffers come from.
+    enum AllocationMode
+    {
+        eHeap,
+        eArena
+    };
+
+private:
+    // Declare and define private methods and variables.
+    AllocationMode m_eMode = eHeap;
+    int m_nFrameCount = 100;
+    int m_nTasksPerFrame = 64;
+    int m_nAllocationsPerTask = 128;
+    int m_nPoolThreads = 4;
+    int m_nFramesDone = 0;
+    alignas(cachealign::nDestructiveSize) std::atomic<uint64_t> m_nNextTask = 0;
+    alignas(cachealign::nDestructiveSize) std::atomic<uint64_t> m_nChecksum = 0;
+    std::chrono::steady_clock::time_point m_tmStartTime;
+    double m_dTotalTime = 0.0;
+
+    /******************************************************************************
+     * @brief Accessor for the memory resource of the current mode.
+     *
+     * @return std::pmr::memory_resource* - The heap or the calling thread's arena.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    std::pmr::memory_resource *GetResource()
+    {
+        return m_eMode == eArena ? static_cast<std::pmr::memory_resource *>(&this->GetScratchArena()) : std::pmr::new_delete_resource();
+    }
+
+    /******************************************************************************
+     * @brief Builds a batch of vectors with sizes picked from the seed, reads them
+     *      back and lets them go.
+     *
+     * @param nSeed - Picks the sizes and values.
+     * @param nCount - The number of vectors to build.
+     * @return uint64_t - A checksum of every value written.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t ChurnBuffers(uint64_t nSeed, int nCount)
+    {
+        // Create instance variables.
+        std::pmr::memory_resource *pResource = this->GetResource();
+        uint64_t nState = nSeed * 0x9E3779B97F4A7C15ULL + 1;
+        uint64_t nSum = 0;
+
+        // Keep a few buffers alive at once like real scratch code does.
+        std::pmr::vector<std::pmr::vector<uint32_t>> vLive(pResource);
+        vLive.reserve(8);
+        for (int nIter = 0; nIter < nCount; ++nIter)
+        {
+            // Pick a size between 16 and 527 elements.
+            nState ^= nState << 13;
+            nState ^= nState >> 7;
+            nState ^= nState << 17;
+            size_t nSize = 16 + nState % 512;
+
+            // Fill the buffer.
+            std::pmr::vector<uint32_t> vBuffer(pResource);
+            for (size_t nIndex = 0; nIndex < nSize; ++nIndex)
+            {
+                vBuffer.push_back(uint32_t(nState >> 32) + uint32_t(nIndex));
+            }
+            nSum += vBuffer[nSize / 2] + nSize;
+
+            // Retire the oldest buffer when too many are alive.
+            if (vLive.size() == 8)
+            {
+                vLive.erase(vLive.begin());
+            }
+            vLive.push_back(std::move(vBuffer));
+        }
+
+        return nSum;
+    }
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Set up on the first frame.
+        if (m_nFramesDone == 0)
+        {
+            m_nChecksum = 0;
+            m_nNextTask = 0;
+            m_tmStartTime = std::chrono::steady_clock::now();
+        }
+
+        // The main loop uses scratch memory too.
+        m_nChecksum += this->ChurnBuffers(~uint64_t(m_nFramesDone), m_nAllocationsPerTask);
+
+        // Churn from every pool thread at once.
+        this->RunDetachedPool(m_nTasksPerFrame, m_nPoolThreads);
+        this->JoinPool();
+
+        // Check if every frame is done.
+        if (++m_nFramesDone >= m_nFrameCount)
+        {
+            // Calculate results.
+            m_dTotalTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_tmStartTime).count();
+            m_nFramesDone = 0;
+            // Request stop of main thread.
+            this->RequestStop();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Each pool task churns its own batch of buffers.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override
+    {
+        uint64_t nTask = m_nNextTask.fetch_add(1, std::memory_order_relaxed);
+        m_nChecksum.fetch_add(this->ChurnBuffers(nTask, m_nAllocationsPerTask), std::memory_order_relaxed);
+    }
+
+public:
+    // Declare and define public methods and variables.
+    ScratchAllocationBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Mutator for the Mode private member.
+     *
+     * @param eMode - Whether buffers come from the heap or the scratch arena.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMode(AllocationMode eMode) { m_eMode = eMode; }
+
+    /******************************************************************************
+     * @brief Mutator for the Frame Count private member.
+     *
+     * @param nNum - The number of frames to run.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetFrameCount(int nNum) { m_nFrameCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Tasks Per Frame private member.
+     *
+     * @param nNum - The number of pool tasks queued each frame.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetTasksPerFrame(int nNum) { m_nTasksPerFrame = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Allocations Per Task private member.
+     *
+     * @param nNum - The number of buffers each task and iteration builds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetAllocationsPerTask(int nNum) { m_nAllocationsPerTask = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Pool Threads private member.
+     *
+     * @param nNum - The number of threads in the pool.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPoolThreads(int nNum) { m_nPoolThreads = nNum; }
+
+    /******************************************************************************
+     * @brief Accessor for the Total Time private member.
+     *
+     * @return double - The time it took to run every frame in seconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetTotalTime() { return m_dTotalTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the buffer throughput of the last run.
+     *
+     * @return double - Buffers built per second by the main loop and pool together.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetBuffersPerSecond()
+    {
+        return m_dTotalTime > 0.0 ? double(m_nFrameCount) * (m_nTasksPerFrame + 1) * m_nAllocationsPerTask / m_dTotalTime : 0.0;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Checksum private member.
+     *
+     * @return uint64_t - Combined values of every buffer. Matches between modes.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetChecksum() { return m_nChecksum; }
+};
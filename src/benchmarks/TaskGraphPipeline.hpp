@@ -0,0 +1,319 @@
+/******************************************************************************
+ * @brief Example file that runs a per camera undistort, detect, pose estimate
+ *      pipeline every frame, either as one pooled batch per stage with a barrier
+ *      between stages or as a task graph.
+ *
+ * @file TaskGraphPipeline.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+#include "../util/TaskGraph.hpp"
+
+/// \cond
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class processes a fixed number of frames from several cameras.
+ *      Every camera goes through three stages and a final fuse step combines the
+ *      poses. The cameras are unbalanced, the even cameras are slow to undistort
+ *      and pose, the odd cameras are slow to detect. With a barrier after each
+ *      stage every stage costs as much as its slowest camera. With the task graph
+ *      each camera moves on to its next stage as soon as it is done, so the fast
+ *      stages of one camera overlap the slow stages of another.
+ *
+ *      Both modes compute the same values, so the checksum must match.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class TaskGraphPipelineBenchmark : public AutonomyThread<void>
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // How the stages are scheduled.
+    enum ScheduleMode
+    {
+        eBarriers,
+        eTaskGraph
+    };
+
+    // Number of stages per camera.
+    static constexpr int nStageCount = 3;
+
+private:
+    // Declare and define private methods and variables.
+    ScheduleMode m_eMode = eBarriers;
+    int m_nCameraCount = 4;
+    int m_nFrameCount = 200;
+    int m_nPoolThreads = 4;
+    int m_nStageWork = 50000;
+    // Per frame state. Each camera only writes its own row.
+    std::vector<std::array<uint64_t, nStageCount>> m_vStageOutputs;
+    uint64_t m_nFrameSeed = 0;
+    uint64_t m_nChecksum = 0;
+    int m_nFramesDone = 0;
+    // Barrier mode, the stage being run and the next camera to give a pool task.
+    int m_nCurrentStage = 0;
+    alignas(cachealign::nDestructiveSize) std::atomic<int> m_nNextCamera = 0;
+    // Task graph mode, built once per run.
+    TaskGraph m_stGraph;
+    // Results.
+    std::chrono::steady_clock::time_point m_tmStartTime;
+    double m_dTotalTime = 0.0;
+
+    /******************************************************************************
+     * @brief Stand-in for one stage of image processing. The amount of work depends
+     *      on the camera and stage, the result depends on the previous stage.
+     *
+     * @param nCamera - The camera index.
+     * @param nStage - The stage index.
+     * @param nInput - The output of the previous stage, or the frame seed.
+     * @return uint64_t - The output of this stage.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t RunStage(int nCamera, int nStage, uint64_t nInput) const
+    {
+        // Slow stages cost four times the fast ones, and alternate between cameras.
+        int nIterations = m_nStageWork * ((nCamera + nStage) % 2 == 0 ? 4 : 1);
+        uint64_t nState = nInput ^ (uint64_t(nCamera) << 32 | uint64_t(nStage)) ^ 0x9E3779B97F4A7C15ULL;
+
+        // Xorshift, each step depends on the last so it can't be skipped.
+        for (int nIter = 0; nIter < nIterations; ++nIter)
+        {
+            nState ^= nState << 13;
+            nState ^= nState >> 7;
+            nState ^= nState << 17;
+        }
+
+        return nState;
+    }
+
+    /******************************************************************************
+     * @brief Runs one stage of one camera for the current frame.
+     *
+     * @param nCamera - The camera index.
+     * @param nStage - The stage index.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void RunCameraStage(int nCamera, int nStage)
+    {
+        uint64_t nInput = nStage == 0 ? m_nFrameSeed : m_vStageOutputs[nCamera][nStage - 1];
+        m_vStageOutputs[nCamera][nStage] = this->RunStage(nCamera, nStage, nInput);
+    }
+
+    /******************************************************************************
+     * @brief Combines the poses of every camera into the checksum.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void FusePoses()
+    {
+        for (const std::array<uint64_t, nStageCount> &aOutputs : m_vStageOutputs)
+        {
+            m_nChecksum = m_nChecksum * 31 + aOutputs[nStageCount - 1];
+        }
+    }
+
+    /******************************************************************************
+     * @brief Declares every stage of every camera and the fuse step once. The
+     *      tasks read the frame seed from the member, so the graph is reused for
+     *      every frame.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void BuildGraph()
+    {
+        // Create the fuse task, it waits for every camera's last stage.
+        m_stGraph.Clear();
+        size_t nFuseTask = m_stGraph.AddTask([this]() { this->FusePoses(); });
+
+        // Chain each camera's stages.
+        for (int nCamera = 0; nCamera < m_nCameraCount; ++nCamera)
+        {
+            size_t nPreviousTask = 0;
+            for (int nStage = 0; nStage < nStageCount; ++nStage)
+            {
+                size_t nTask = m_stGraph.AddTask([this, nCamera, nStage]() { this->RunCameraStage(nCamera, nStage); });
+                if (nStage > 0)
+                {
+                    m_stGraph.AddDependency(nPreviousTask, nTask);
+                }
+                nPreviousTask = nTask;
+            }
+            m_stGraph.AddDependency(nPreviousTask, nFuseTask);
+        }
+        m_stGraph.Finalize();
+    }
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Set up on the first frame.
+        if (m_nFramesDone == 0)
+        {
+            m_vStageOutputs.assign(m_nCameraCount, {});
+            m_nChecksum = 0;
+            if (m_eMode == eTaskGraph)
+            {
+                this->BuildGraph();
+            }
+            m_tmStartTime = std::chrono::steady_clock::now();
+        }
+
+        // Process one frame.
+        m_nFrameSeed = uint64_t(m_nFramesDone) * 0x2545F4914F6CDD1DULL + 1;
+        if (m_eMode == eBarriers)
+        {
+            // One pooled batch per stage, waiting for every camera before the next stage.
+            for (int nStage = 0; nStage < nStageCount; ++nStage)
+            {
+                m_nCurrentStage = nStage;
+                m_nNextCamera = 0;
+                this->RunDetachedPool(m_nCameraCount, m_nPoolThreads);
+                this->JoinPool();
+            }
+            this->FusePoses();
+        }
+        else
+        {
+            // Every stage is released as soon as the camera's previous stage is done.
+            this->RunTaskGraph(m_stGraph, m_nPoolThreads);
+        }
+
+        // Check if every frame is done.
+        if (++m_nFramesDone >= m_nFrameCount)
+        {
+            // Calculate results.
+            m_dTotalTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_tmStartTime).count();
+            m_nFramesDone = 0;
+            // Request stop of main thread.
+            this->RequestStop();
+        }
+    }
+
+    /******************************************************************************
+     * @brief In barrier mode each pool task runs the current stage for the next
+     *      camera.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override
+    {
+        int nCamera = m_nNextCamera.fetch_add(1, std::memory_order_relaxed);
+        this->RunCameraStage(nCamera, m_nCurrentStage);
+    }
+
+public:
+    // Declare and define public methods and variables.
+    TaskGraphPipelineBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Mutator for the Mode private member.
+     *
+     * @param eMode - Whether stages are separated by barriers or scheduled by a task graph.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMode(ScheduleMode eMode) { m_eMode = eMode; }
+
+    /******************************************************************************
+     * @brief Mutator for the Camera Count private member.
+     *
+     * @param nNum - The number of cameras processed each frame.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetCameraCount(int nNum) { m_nCameraCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Frame Count private member.
+     *
+     * @param nNum - The number of frames to process.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetFrameCount(int nNum) { m_nFrameCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Pool Threads private member.
+     *
+     * @param nNum - The number of threads in the pool.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPoolThreads(int nNum) { m_nPoolThreads = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Stage Work private member.
+     *
+     * @param nIterations - Iterations of a fast stage. Slow stages run four times as many.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetStageWork(int nIterations) { m_nStageWork = nIterations; }
+
+    /******************************************************************************
+     * @brief Accessor for the Total Time private member.
+     *
+     * @return double - The time it took to process every frame in seconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetTotalTime() { return m_dTotalTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the frame rate of the last run.
+     *
+     * @return double - Frames processed per second.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetFramesPerSecond() { return m_dTotalTime > 0.0 ? m_nFrameCount / m_dTotalTime : 0.0; }
+
+    /******************************************************************************
+     * @brief Accessor for the Checksum private member.
+     *
+     * @return uint64_t - Combined poses of every frame. Matches between modes.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetChecksum() { return m_nChecksum; }
+};
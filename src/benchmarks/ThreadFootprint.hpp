@@ -0,0 +1,223 @@
+/******************************************************************************
+ * @brief Example file that measures how much memory and creation time idle
+ *      AutonomyThreads cost as the instance count, pool size and thread stack
+ *      size change.
+ *
+ * @file ThreadFootprint.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+#include "../util/ProcessStats.hpp"
+
+/// \cond
+#include <chrono>
+#include <memory>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief An AutonomyThread that never runs. It only exists to own a main thread
+ *      and a pool, so the cost of those threads can be measured.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class FootprintThread : public AutonomyThread<void>
+{
+private:
+    /******************************************************************************
+     * @brief Not used, the thread is never started.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override { this->RequestStop(); }
+
+    /******************************************************************************
+     * @brief Not used, no tasks are queued.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override {}
+
+public:
+    /******************************************************************************
+     * @brief Construct a new Footprint Thread object.
+     *
+     * @param nStackSize - Stack size of the main and pool threads in bytes. 0 uses the system default.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    explicit FootprintThread(size_t nStackSize) : AutonomyThread<void>(nStackSize, nStackSize) {}
+
+    /******************************************************************************
+     * @brief Resizes the pool without queueing any work.
+     *
+     * @param nNumThreads - The number of threads the pool should have.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ResizePool(int nNumThreads) { this->RunDetachedPool(0, nNumThreads); }
+};
+
+/******************************************************************************
+ * @brief This class creates a number of idle FootprintThreads, grows each pool
+ *      to the requested size, and measures what the process gained. Everything
+ *      is destroyed before Run() returns, so runs don't affect each other.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class ThreadFootprintBenchmark
+{
+private:
+    // Declare and define private methods and variables.
+    int m_nInstanceCount = 10;
+    int m_nPoolThreads = 4;
+    size_t m_nStackSize = 0;
+    // Results.
+    long m_nThreadsAdded = 0;
+    long m_nResidentDeltaKB = 0;
+    long m_nVirtualDeltaKB = 0;
+    long m_nPageTableDeltaKB = 0;
+    double m_dCreationTime = 0.0;
+
+public:
+    // Declare and define public methods and variables.
+    ThreadFootprintBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Creates the threads, measures the process, then destroys them.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Run()
+    {
+        // Measure the process before anything is created.
+        long nBaseThreads = procstats::GetThreadCount();
+        long nBaseResidentKB = procstats::GetResidentMemoryKB();
+        long nBaseVirtualKB = procstats::GetVirtualMemoryKB();
+        long nBasePageTableKB = procstats::GetPageTableKB();
+
+        // Create the instances and grow their pools.
+        std::vector<std::unique_ptr<FootprintThread>> vInstances;
+        vInstances.reserve(m_nInstanceCount);
+        std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+        for (int nIter = 0; nIter < m_nInstanceCount; ++nIter)
+        {
+            vInstances.emplace_back(std::make_unique<FootprintThread>(m_nStackSize));
+            vInstances.back()->ResizePool(m_nPoolThreads);
+        }
+        m_dCreationTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count();
+
+        // Measure what they added.
+        m_nThreadsAdded = procstats::GetThreadCount() - nBaseThreads;
+        m_nResidentDeltaKB = procstats::GetResidentMemoryKB() - nBaseResidentKB;
+        m_nVirtualDeltaKB = procstats::GetVirtualMemoryKB() - nBaseVirtualKB;
+        m_nPageTableDeltaKB = procstats::GetPageTableKB() - nBasePageTableKB;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Instance Count private member.
+     *
+     * @param nNum - The number of AutonomyThreads to create.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetInstanceCount(int nNum) { m_nInstanceCount = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Pool Threads private member.
+     *
+     * @param nNum - The number of pool threads each instance gets.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPoolThreads(int nNum) { m_nPoolThreads = nNum; }
+
+    /******************************************************************************
+     * @brief Mutator for the Stack Size private member.
+     *
+     * @param nBytes - Stack size of every thread in bytes. 0 uses the system default.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetStackSize(size_t nBytes) { m_nStackSize = nBytes; }
+
+    /******************************************************************************
+     * @brief Accessor for the Threads Added private member.
+     *
+     * @return long - The number of threads the instances added to the process.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    long GetThreadsAdded() { return m_nThreadsAdded; }
+
+    /******************************************************************************
+     * @brief Accessor for the Resident Delta private member.
+     *
+     * @return long - Resident memory added by the instances in kB.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    long GetResidentDeltaKB() { return m_nResidentDeltaKB; }
+
+    /******************************************************************************
+     * @brief Accessor for the Virtual Delta private member.
+     *
+     * @return long - Address space added by the instances in kB.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    long GetVirtualDeltaKB() { return m_nVirtualDeltaKB; }
+
+    /******************************************************************************
+     * @brief Accessor for the Page Table Delta private member.
+     *
+     * @return long - Page table memory added by the instances in kB.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    long GetPageTableDeltaKB() { return m_nPageTableDeltaKB; }
+
+    /******************************************************************************
+     * @brief Accessor for the Creation Time private member.
+     *
+     * @return double - The time it took to create every instance and pool in seconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetCreationTime() { return m_dCreationTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the creation time of one thread.
+     *
+     * @return double - The average time to create one thread in microseconds.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetCreationTimePerThread() { return m_nThreadsAdded > 0 ? m_dCreationTime * 1e6 / m_nThreadsAdded : 0.0; }
+};
@@ -0,0 +1,590 @@
+/******************************************************************************
+ * @brief Benchmark suite of workload kernels that stress different parts of the
+ *      machine, all run through the same pooled runner so their scaling can be
+ *      compared with each other and with the prime calculators.
+ *
+ * @file WorkloadSuite.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#include "../interfaces/AutonomyThread.hpp"
+
+/// \cond
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief This class runs one workload kernel at a time. The kernel's work is a
+ *      fixed problem split into the same number of pool tasks no matter how many
+ *      threads run them, so the time at different thread counts shows strong
+ *      scaling. Input data is built before the clock starts and reused until the
+ *      kernel or problem size changes. Every kernel produces a checksum that must
+ *      not change with the thread count.
+ *
+ *      Kernels:
+ *          eMemoryStream - STREAM triad over three large arrays. Bandwidth bound.
+ *          ePointerChase - Dependent loads through one big random cycle. Latency bound.
+ *          eConvolution - 5x5 integer convolution of an 8-bit image. Compute and cache bound.
+ *          eParsing - Splits and converts NMEA-like text lines. Branch bound.
+ *          eSleepIO - Sleeps in short slices, like a task waiting on a device. Scales past the core count.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class WorkloadBenchmark : public AutonomyThread<void>
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // The workload to run.
+    enum WorkloadKernel
+    {
+        eMemoryStream,
+        ePointerChase,
+        eConvolution,
+        eParsing,
+        eSleepIO
+    };
+
+private:
+    // Declare and define private methods and variables.
+    WorkloadKernel m_eKernel = eMemoryStream;
+    WorkloadKernel m_ePreparedKernel = eSleepIO;
+    uint64_t m_nProblemSize = 0;
+    uint64_t m_nPreparedSize = 0;
+    int m_nThreads = 1;
+    int m_nTaskCount = 64;
+    std::atomic<int> m_nNextTask = 0;
+    std::atomic<uint64_t> m_nChecksum = 0;
+    double m_dCalculationTime = -1.0;
+    double m_dWorkDone = 0.0;
+    // Kernel data.
+    std::vector<double> m_vStreamA;
+    std::vector<double> m_vStreamB;
+    std::vector<double> m_vStreamC;
+    std::vector<uint32_t> m_vChaseNodes;
+    std::vector<uint8_t> m_vImage;
+    std::vector<uint8_t> m_vConvolved;
+    std::string m_szText;
+    std::vector<size_t> m_vTaskTextStarts;
+
+    // Declare private constants.
+    static constexpr int nStreamPasses = 4;
+    static constexpr int nImageWidth = 2048;
+    static constexpr int nSleepSlicesPerTask = 4;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Build the input once per kernel and size, outside of the timing.
+        if (m_ePreparedKernel != m_eKernel || m_nPreparedSize != this->GetProblemSize())
+        {
+            this->PrepareData();
+        }
+        m_nNextTask = 0;
+        m_nChecksum = 0;
+
+        // Run the tasks.
+        std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+        this->RunDetachedPool(m_nTaskCount, m_nThreads);
+        this->JoinPool();
+        m_dCalculationTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count();
+
+        // Request stop of main thread.
+        this->RequestStop();
+    }
+
+    /******************************************************************************
+     * @brief Each pool task claims one slice of the problem and runs the kernel on it.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override
+    {
+        // Claim a task and run the kernel on its slice.
+        int nTask = m_nNextTask.fetch_add(1, std::memory_order_relaxed);
+        uint64_t nChecksum = 0;
+        switch (m_eKernel)
+        {
+            case eMemoryStream: nChecksum = this->StreamTask(nTask); break;
+            case ePointerChase: nChecksum = this->ChaseTask(nTask); break;
+            case eConvolution: nChecksum = this->ConvolutionTask(nTask); break;
+            case eParsing: nChecksum = this->ParsingTask(nTask); break;
+            case eSleepIO: nChecksum = this->SleepTask(nTask); break;
+        }
+
+        // Combine order independently so the result doesn't depend on scheduling.
+        m_nChecksum.fetch_add(nChecksum, std::memory_order_relaxed);
+    }
+
+    /******************************************************************************
+     * @brief Builds the input data for the current kernel and frees the others.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PrepareData()
+    {
+        // Create instance variables.
+        uint64_t nSize = this->GetProblemSize();
+        std::mt19937_64 genRandom(42);
+
+        // Free anything from the last kernel.
+        m_vStreamA = std::vector<double>();
+        m_vStreamB = std::vector<double>();
+        m_vStreamC = std::vector<double>();
+        m_vChaseNodes = std::vector<uint32_t>();
+        m_vImage = std::vector<uint8_t>();
+        m_vConvolved = std::vector<uint8_t>();
+        m_szText = std::string();
+        m_vTaskTextStarts.clear();
+
+        switch (m_eKernel)
+        {
+            case eMemoryStream:
+            {
+                // Three 64 MB arrays by default, past most last level caches. Bytes moved per pass: read B and C, write A.
+                m_vStreamA.assign(nSize, 0.0);
+                m_vStreamB.assign(nSize, 1.0);
+                m_vStreamC.assign(nSize, 2.0);
+                m_dWorkDone = double(nStreamPasses) * nSize * 3 * sizeof(double) / 1e9;
+                break;
+            }
+            case ePointerChase:
+            {
+                // Sattolo's algorithm makes a single cycle through every node, so no task gets stuck in a short loop.
+                m_vChaseNodes.resize(nSize);
+                std::iota(m_vChaseNodes.begin(), m_vChaseNodes.end(), 0);
+                for (uint64_t nIter = nSize - 1; nIter > 0; --nIter)
+                {
+                    std::swap(m_vChaseNodes[nIter], m_vChaseNodes[std::uniform_int_distribution<uint64_t>(0, nIter - 1)(genRandom)]);
+                }
+                m_dWorkDone = double(nSize) / 1e6;
+                break;
+            }
+            case eConvolution:
+            {
+                // Random image, the kernel doesn't care about the content.
+                m_vImage.resize(nSize);
+                for (uint8_t &nPixel : m_vImage)
+                {
+                    nPixel = uint8_t(genRandom());
+                }
+                m_vConvolved.assign(nSize, 0);
+                m_dWorkDone = double(nSize) / 1e6;
+                break;
+            }
+            case eParsing:
+            {
+                // NMEA-like sentences with a mix of field types, some empty.
+                static const char *aSentenceTypes[] = {"GPGGA", "GPRMC", "GPVTG", "PRDIM"};
+                char aLine[160];
+                while (m_szText.size() < nSize)
+                {
+                    int nType = int(genRandom() % 4);
+                    int nLength = std::snprintf(aLine,
+                                                sizeof(aLine),
+                                                "$%s,%06u,%u.%03u,%c,%05u.%03u,%c,%u,%02u,%s,%d.%u,M,*%02X\n",
+                                                aSentenceTypes[nType],
+                                                unsigned(genRandom() % 235959),
+                                                unsigned(genRandom() % 9000),
+                                                unsigned(genRandom() % 1000),
+                                                genRandom() % 2 ? 'N' : 'S',
+                                                unsigned(genRandom() % 18000),
+                                                unsigned(genRandom() % 1000),
+                                                genRandom() % 2 ? 'E' : 'W',
+                                                unsigned(genRandom() % 9),
+                                                unsigned(genRandom() % 13),
+                                                genRandom() % 3 ? "0.9" : "",
+                                                int(genRandom() % 2000) - 100,
+                                                unsigned(genRandom() % 10),
+                                                unsigned(genRandom() % 256));
+                    m_szText.append(aLine, size_t(nLength));
+                }
+                // Split the text on line boundaries, one slice per task.
+                m_vTaskTextStarts.resize(m_nTaskCount + 1);
+                for (int nTask = 0; nTask < m_nTaskCount; ++nTask)
+                {
+                    size_t nStart = m_szText.size() * nTask / m_nTaskCount;
+                    size_t nNewline = m_szText.find('\n', nStart);
+                    m_vTaskTextStarts[nTask] = nTask == 0 ? 0 : (nNewline == std::string::npos ? m_szText.size() : nNewline + 1);
+                }
+                m_vTaskTextStarts[m_nTaskCount] = m_szText.size();
+                m_dWorkDone = double(m_szText.size()) / 1e6;
+                break;
+            }
+            case eSleepIO:
+            {
+                // Nothing to build, the size is the length of each sleep in microseconds.
+                m_dWorkDone = double(m_nTaskCount) * nSleepSlicesPerTask;
+                break;
+            }
+        }
+
+        m_ePreparedKernel = m_eKernel;
+        m_nPreparedSize = nSize;
+    }
+
+    /******************************************************************************
+     * @brief STREAM triad, A = B + s * C, over one slice of the arrays.
+     *
+     * @param nTask - The task index.
+     * @return uint64_t - The sum of a few output elements.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t StreamTask(int nTask)
+    {
+        // Find this task's slice.
+        size_t nBegin = m_vStreamA.size() * nTask / m_nTaskCount;
+        size_t nEnd = m_vStreamA.size() * (nTask + 1) / m_nTaskCount;
+        double *pA = m_vStreamA.data();
+        const double *pB = m_vStreamB.data();
+        const double *pC = m_vStreamC.data();
+
+        // Run the passes over the slice.
+        for (int nPass = 0; nPass < nStreamPasses; ++nPass)
+        {
+            double dScalar = 3.0 + nPass;
+            for (size_t nIter = nBegin; nIter < nEnd; ++nIter)
+            {
+                pA[nIter] = pB[nIter] + dScalar * pC[nIter];
+            }
+        }
+
+        return nEnd > nBegin ? uint64_t(pA[nBegin] + pA[nEnd - 1]) : 0;
+    }
+
+    /******************************************************************************
+     * @brief Follows the cycle from an evenly spaced starting node. Every load
+     *      depends on the one before it, so only memory latency matters.
+     *
+     * @param nTask - The task index.
+     * @return uint64_t - The node the chase ended on.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t ChaseTask(int nTask)
+    {
+        // Each task does an equal share of the total hops.
+        uint64_t nHops = m_vChaseNodes.size() / m_nTaskCount;
+        uint32_t nNode = uint32_t(m_vChaseNodes.size() * nTask / m_nTaskCount);
+        const uint32_t *pNodes = m_vChaseNodes.data();
+
+        // Chase.
+        for (uint64_t nIter = 0; nIter < nHops; ++nIter)
+        {
+            nNode = pNodes[nNode];
+        }
+
+        return nNode;
+    }
+
+    /******************************************************************************
+     * @brief 5x5 binomial blur over a band of image rows. The image border is
+     *      clamped.
+     *
+     * @param nTask - The task index.
+     * @return uint64_t - The sum of the output band.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t ConvolutionTask(int nTask)
+    {
+        // Create instance variables.
+        static constexpr int aWeights[5] = {1, 4, 6, 4, 1};
+        int nHeight = int(m_vImage.size() / nImageWidth);
+        int nRowBegin = nHeight * nTask / m_nTaskCount;
+        int nRowEnd = nHeight * (nTask + 1) / m_nTaskCount;
+        const uint8_t *pImage = m_vImage.data();
+        uint64_t nSum = 0;
+
+        // Convolve every pixel in the band.
+        for (int nRow = nRowBegin; nRow < nRowEnd; ++nRow)
+        {
+            for (int nColumn = 0; nColumn < nImageWidth; ++nColumn)
+            {
+                int nAccumulator = 0;
+                for (int nKernelRow = -2; nKernelRow <= 2; ++nKernelRow)
+                {
+                    const uint8_t *pRow = pImage + size_t(std::clamp(nRow + nKernelRow, 0, nHeight - 1)) * nImageWidth;
+                    for (int nKernelColumn = -2; nKernelColumn <= 2; ++nKernelColumn)
+                    {
+                        nAccumulator += aWeights[nKernelRow + 2] * aWeights[nKernelColumn + 2] * pRow[std::clamp(nColumn + nKernelColumn, 0, nImageWidth - 1)];
+                    }
+                }
+                uint8_t nPixel = uint8_t(nAccumulator >> 8);
+                m_vConvolved[size_t(nRow) * nImageWidth + nColumn] = nPixel;
+                nSum += nPixel;
+            }
+        }
+
+        return nSum;
+    }
+
+    /******************************************************************************
+     * @brief Parses one slice of the NMEA-like text. Each field is handled by
+     *      character class, so the branch pattern follows the data.
+     *
+     * @param nTask - The task index.
+     * @return uint64_t - A sum of every parsed integer and the fraction digits.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t ParsingTask(int nTask)
+    {
+        // Create instance variables.
+        const char *pText = m_szText.data();
+        size_t nEnd = m_vTaskTextStarts[nTask + 1];
+        uint64_t nSum = 0;
+        int64_t nValue = 0;
+        bool bNegative = false;
+        bool bInNumber = false;
+
+        // Walk the slice one character at a time.
+        for (size_t nIter = m_vTaskTextStarts[nTask]; nIter < nEnd; ++nIter)
+        {
+            char chCharacter = pText[nIter];
+            if (chCharacter >= '0' && chCharacter <= '9')
+            {
+                nValue = nValue * 10 + (chCharacter - '0');
+                bInNumber = true;
+            }
+            else if (chCharacter == '-')
+            {
+                bNegative = true;
+            }
+            else if (chCharacter >= 'A' && chCharacter <= 'Z')
+            {
+                // Hemisphere and sentence letters.
+                nSum += chCharacter == 'S' || chCharacter == 'W' ? 2 : 1;
+            }
+            else
+            {
+                // Separators end the current number. A '.' starts the fraction as a separate number.
+                if (bInNumber)
+                {
+                    nSum += uint64_t(bNegative ? -nValue : nValue);
+                }
+                nValue = 0;
+                bNegative = false;
+                bInNumber = false;
+                if (chCharacter == '*')
+                {
+                    // Skip the hex checksum.
+                    nIter += 2;
+                }
+            }
+        }
+
+        return nSum;
+    }
+
+    /******************************************************************************
+     * @brief Sleeps in short slices, like a task that mostly waits on a serial
+     *      port or network reply.
+     *
+     * @param nTask - The task index.
+     * @return uint64_t - The number of slices slept.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t SleepTask(int nTask)
+    {
+        // Create instance variables.
+        (void) nTask;
+        uint64_t nSlices = 0;
+
+        // Wait for each "reply".
+        for (int nIter = 0; nIter < nSleepSlicesPerTask; ++nIter)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(m_nPreparedSize));
+            ++nSlices;
+        }
+
+        return nSlices;
+    }
+
+public:
+    // Declare and define public methods and variables.
+    WorkloadBenchmark() = default;
+
+    /******************************************************************************
+     * @brief Mutator for the Kernel private member.
+     *
+     * @param eKernel - The workload to run.
+     * @param nProblemSize - The size of the problem. 0 uses the kernel's default:
+     *          eMemoryStream: 8M doubles per array.
+     *          ePointerChase: 4M nodes.
+     *          eConvolution: 2048 x 2048 pixels.
+     *          eParsing: 16 MB of text.
+     *          eSleepIO: 1000 us per sleep.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetKernel(WorkloadKernel eKernel, uint64_t nProblemSize = 0)
+    {
+        m_eKernel = eKernel;
+        m_nProblemSize = nProblemSize;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Threads private member.
+     *
+     * @param nThreads - The number of pool threads that run the tasks.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetThreads(int nThreads) { m_nThreads = std::max(nThreads, 1); }
+
+    /******************************************************************************
+     * @brief Mutator for the Task Count private member. Changing it rebuilds the input.
+     *
+     * @param nTaskCount - The number of slices the problem is split into.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetTaskCount(int nTaskCount)
+    {
+        m_nTaskCount = std::max(nTaskCount, 1);
+        m_nPreparedSize = 0;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the problem size the current kernel runs with.
+     *
+     * @return uint64_t - The problem size, in the kernel's units.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetProblemSize()
+    {
+        // Use the given size if there is one.
+        if (m_nProblemSize != 0)
+        {
+            return m_nProblemSize;
+        }
+
+        switch (m_eKernel)
+        {
+            case eMemoryStream: return 8ull << 20;
+            case ePointerChase: return 4ull << 20;
+            case eConvolution: return uint64_t(nImageWidth) * 2048;
+            case eParsing: return 16ull << 20;
+            case eSleepIO: return 1000;
+        }
+
+        return 0;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the name of a kernel.
+     *
+     * @param eKernel - The kernel.
+     * @return const char* - The kernel's name.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static const char *GetKernelName(WorkloadKernel eKernel)
+    {
+        switch (eKernel)
+        {
+            case eMemoryStream: return "Memory Stream";
+            case ePointerChase: return "Pointer Chase";
+            case eConvolution: return "Convolution";
+            case eParsing: return "Parsing";
+            case eSleepIO: return "Sleep IO";
+        }
+
+        return "Unknown";
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the unit GetThroughput() is reported in.
+     *
+     * @param eKernel - The kernel.
+     * @return const char* - The throughput unit.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static const char *GetThroughputUnit(WorkloadKernel eKernel)
+    {
+        switch (eKernel)
+        {
+            case eMemoryStream: return "GB/s";
+            case ePointerChase: return "M hops/s";
+            case eConvolution: return "M pixels/s";
+            case eParsing: return "MB/s";
+            case eSleepIO: return "waits/s";
+        }
+
+        return "";
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Calculation Time private member.
+     *
+     * @return double - The time in seconds the last run took.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetCalculationTime() { return m_dCalculationTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the throughput of the last run.
+     *
+     * @return double - The work done per second, in GetThroughputUnit() units.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetThroughput() { return m_dWorkDone / m_dCalculationTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the Checksum private member.
+     *
+     * @return uint64_t - The combined checksum of every task. Must match between thread counts.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetChecksum() { return m_nChecksum.load(); }
+};
@@ -0,0 +1,835 @@
+/******************************************************************************
+ * @brief This interface defines a coroutine based version of AutonomyThread.
+ *      Instead of owning an OS thread, the main loop of each inheritor is a C++20
+ *      coroutine that is resumed on a small shared set of worker threads, so a
+ *      subsystem that is mostly waiting on timers, pooled work or channel data
+ *      doesn't occupy a thread while it waits.
+ *
+ * @file AutonomyCoroutine.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef AUTONOMYCOROUTINE_H
+#define AUTONOMYCOROUTINE_H
+
+#include "../util/CacheAlignment.hpp"
+#include "../util/Channel.hpp"
+#include "../util/IPS.hpp"
+#include "AutonomyThread.hpp"
+
+/// \cond
+#include "../../external/threadpool/include/BS_thread_pool.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Lazily started coroutine that returns nothing. This is the return type
+ *      of AutonomyCoroutineThread::ThreadedContinuousCode() and of any helper
+ *      coroutines it wants to co_await. The coroutine doesn't run until it is
+ *      awaited, and resumes the awaiting coroutine directly when it finishes.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class AutonomyTask
+{
+public:
+    /******************************************************************************
+     * @brief Promise type required by the compiler to build the coroutine frame.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    struct promise_type
+    {
+    public:
+        // Declare public member variables.
+        std::coroutine_handle<> hContinuation = std::noop_coroutine();
+        std::exception_ptr pException = nullptr;
+
+        // Resumes whoever awaited this task once it finishes, without growing the stack.
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> hCoroutine) noexcept { return hCoroutine.promise().hContinuation; }
+            void await_resume() const noexcept {}
+        };
+
+        // Declare promise methods.
+        AutonomyTask get_return_object() { return AutonomyTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        FinalAwaiter final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() { pException = std::current_exception(); }
+    };
+
+    /******************************************************************************
+     * @brief Construct a new, empty Autonomy Task object.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    AutonomyTask() = default;
+
+    /******************************************************************************
+     * @brief Construct a new Autonomy Task object by taking over another one.
+     *
+     * @param stOther - The task to take the coroutine from.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    AutonomyTask(AutonomyTask &&stOther) noexcept : m_hCoroutine(std::exchange(stOther.m_hCoroutine, nullptr)) {}
+
+    // A task owns its coroutine frame.
+    AutonomyTask(const AutonomyTask &) = delete;
+    AutonomyTask &operator=(const AutonomyTask &) = delete;
+    AutonomyTask &operator=(AutonomyTask &&) = delete;
+
+    /******************************************************************************
+     * @brief Destroy the Autonomy Task object and its coroutine frame.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ~AutonomyTask()
+    {
+        // Destroy the coroutine frame if we own one.
+        if (m_hCoroutine)
+        {
+            m_hCoroutine.destroy();
+        }
+    }
+
+    // Awaitable interface. Awaiting a task starts it and resumes the awaiter when it finishes.
+    bool await_ready() const noexcept { return !m_hCoroutine || m_hCoroutine.done(); }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> hAwaiting) noexcept
+    {
+        m_hCoroutine.promise().hContinuation = hAwaiting;
+        return m_hCoroutine;
+    }
+    void await_resume() const
+    {
+        // Pass on any exception thrown by the task.
+        if (m_hCoroutine && m_hCoroutine.promise().pException)
+        {
+            std::rethrow_exception(m_hCoroutine.promise().pException);
+        }
+    }
+
+private:
+    // Only the promise can create tasks that own a coroutine.
+    explicit AutonomyTask(std::coroutine_handle<promise_type> hCoroutine) : m_hCoroutine(hCoroutine) {}
+
+    // Declare private member variables.
+    std::coroutine_handle<promise_type> m_hCoroutine = nullptr;
+};
+
+/******************************************************************************
+ * @brief Multiplexes coroutines onto a small fixed set of worker threads. Also
+ *      owns a timer thread for sleeping coroutines and a pool for offloading
+ *      blocking or heavy work. Every AutonomyCoroutineThread is given one of these,
+ *      and it must outlive all of them.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class CoroutineScheduler
+{
+private:
+    /////////////////////////////////////////
+    // Declare private structs.
+    /////////////////////////////////////////
+
+    // A sleeping coroutine and when to wake it.
+    struct TimerEntry
+    {
+        std::chrono::steady_clock::time_point tmDeadline;
+        std::coroutine_handle<> hCoroutine;
+
+        // Reversed so the priority queue puts the earliest deadline on top.
+        bool operator<(const TimerEntry &stOther) const { return tmDeadline > stOther.tmDeadline; }
+    };
+
+public:
+    /////////////////////////////////////////
+    // Declare public awaitables.
+    /////////////////////////////////////////
+
+    // Moves the awaiting coroutine onto a worker thread.
+    struct ScheduleAwaiter
+    {
+        CoroutineScheduler *pScheduler;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> hCoroutine) const { pScheduler->Post(hCoroutine); }
+        void await_resume() const noexcept {}
+    };
+
+    // Parks the awaiting coroutine on the timer thread until the deadline passes.
+    struct TimerAwaiter
+    {
+        CoroutineScheduler *pScheduler;
+        std::chrono::steady_clock::time_point tmDeadline;
+        bool await_ready() const noexcept { return tmDeadline <= std::chrono::steady_clock::now(); }
+        void await_suspend(std::coroutine_handle<> hCoroutine) const { pScheduler->AddTimer(tmDeadline, hCoroutine); }
+        void await_resume() const noexcept {}
+    };
+
+    // Runs a callable on the offload pool and resumes the awaiting coroutine on a worker with its result.
+    template <typename F, typename R = std::invoke_result_t<F>>
+    struct OffloadAwaiter
+    {
+        CoroutineScheduler *pScheduler;
+        F fnWork;
+        std::conditional_t<std::is_void_v<R>, bool, std::optional<R>> tResult = {};
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> hCoroutine)
+        {
+            pScheduler->m_thOffloadPool.detach_task(
+                [this, hCoroutine]()
+                {
+                    // Run the work and keep the result in the awaiter, which lives in the suspended coroutine's frame.
+                    if constexpr (std::is_void_v<R>)
+                    {
+                        fnWork();
+                    }
+                    else
+                    {
+                        tResult.emplace(fnWork());
+                    }
+                    pScheduler->Post(hCoroutine);
+                });
+        }
+        R await_resume()
+        {
+            if constexpr (!std::is_void_v<R>)
+            {
+                return std::move(*tResult);
+            }
+        }
+    };
+
+    // Runs nNumTasks copies of a callable on the offload pool and resumes the awaiting coroutine once all are done.
+    template <typename F>
+    struct OffloadBatchAwaiter
+    {
+        CoroutineScheduler *pScheduler;
+        unsigned int nNumTasks;
+        F fnWork;
+        std::atomic<unsigned int> nRemaining = 0;
+        bool await_ready() const noexcept { return nNumTasks == 0; }
+        void await_suspend(std::coroutine_handle<> hCoroutine)
+        {
+            nRemaining.store(nNumTasks, std::memory_order_relaxed);
+            for (unsigned int nIter = 0; nIter < nNumTasks; ++nIter)
+            {
+                pScheduler->m_thOffloadPool.detach_task(
+                    [this, hCoroutine, nIter]()
+                    {
+                        fnWork(nIter);
+                        // The last task to finish resumes the coroutine.
+                        if (nRemaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        {
+                            pScheduler->Post(hCoroutine);
+                        }
+                    });
+            }
+        }
+        void await_resume() const noexcept {}
+    };
+
+    // Waits for an item from a channel without blocking a thread. Returns an empty optional if the channel closed.
+    template <typename T, bool bMultiProducer>
+    struct ChannelAwaiter : public ChannelDataWaiter
+    {
+        CoroutineScheduler *pScheduler;
+        Channel<T, bMultiProducer> *pChannel;
+        std::optional<T> tItem = std::nullopt;
+        std::coroutine_handle<> hCoroutine = nullptr;
+        ChannelAwaiter(CoroutineScheduler *pSched, Channel<T, bMultiProducer> *pChan) : pScheduler(pSched), pChannel(pChan) {}
+        bool await_ready()
+        {
+            // Don't suspend at all if data is already waiting or the channel is done.
+            T tValue;
+            if (pChannel->TryPop(tValue))
+            {
+                tItem.emplace(std::move(tValue));
+                return true;
+            }
+            return pChannel->IsClosed() && pChannel->Empty();
+        }
+        bool await_suspend(std::coroutine_handle<> hAwaiting)
+        {
+            // Suspend only if the waiter got registered before data showed up.
+            hCoroutine = hAwaiting;
+            return pChannel->RegisterDataWaiter(this);
+        }
+        void OnDataAvailable() override { pScheduler->Post(hCoroutine); }
+        std::optional<T> await_resume()
+        {
+            // Pop now if we were woken up instead of getting the item in await_ready().
+            if (!tItem.has_value())
+            {
+                T tValue;
+                if (pChannel->TryPop(tValue))
+                {
+                    tItem.emplace(std::move(tValue));
+                }
+            }
+            return std::move(tItem);
+        }
+    };
+
+    /////////////////////////////////////////
+    // Declare and define public class methods.
+    /////////////////////////////////////////
+
+    /******************************************************************************
+     * @brief Construct a new Coroutine Scheduler object.
+     *
+     * @param nNumWorkers - The number of worker threads that resume coroutines.
+     * @param nNumPoolThreads - The number of threads that run offloaded work.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    CoroutineScheduler(const unsigned int nNumWorkers = 2, const unsigned int nNumPoolThreads = 2) :
+        m_thWorkers(nNumWorkers), m_thOffloadPool(nNumPoolThreads), m_thTimerThread(1)
+    {
+        // Start the timer loop. It lives for as long as the scheduler.
+        m_thTimerThread.detach_task([this]() { this->RunTimers(); });
+    }
+
+    /******************************************************************************
+     * @brief Destroy the Coroutine Scheduler object. All coroutine threads using
+     *      this scheduler must be stopped and joined first, coroutines still parked
+     *      on a timer are never resumed.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ~CoroutineScheduler()
+    {
+        // Stop the timer loop.
+        {
+            std::lock_guard<std::mutex> lkTimerLock(m_muTimerMutex);
+            m_bStopTimers = true;
+        }
+        m_cdTimerCondition.notify_all();
+        m_thTimerThread.wait();
+
+        // Wait for any running work.
+        m_thOffloadPool.wait();
+        m_thWorkers.wait();
+    }
+
+    /******************************************************************************
+     * @brief Queues a suspended coroutine to be resumed on a worker thread.
+     *
+     * @param hCoroutine - The coroutine to resume.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Post(std::coroutine_handle<> hCoroutine)
+    {
+        m_thWorkers.detach_task([hCoroutine]() { hCoroutine.resume(); });
+    }
+
+    /******************************************************************************
+     * @brief co_await the result of this to hop onto a worker thread.
+     *
+     * @return ScheduleAwaiter - The awaitable.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ScheduleAwaiter Schedule() { return ScheduleAwaiter{this}; }
+
+    /******************************************************************************
+     * @brief co_await the result of this to sleep until a point in time without
+     *      blocking a thread.
+     *
+     * @param tmDeadline - When to resume.
+     * @return TimerAwaiter - The awaitable.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    TimerAwaiter SleepUntil(std::chrono::steady_clock::time_point tmDeadline) { return TimerAwaiter{this, tmDeadline}; }
+
+    /******************************************************************************
+     * @brief co_await the result of this to sleep for a duration without blocking
+     *      a thread.
+     *
+     * @param tmDuration - How long to sleep.
+     * @return TimerAwaiter - The awaitable.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    TimerAwaiter SleepFor(std::chrono::steady_clock::duration tmDuration) { return TimerAwaiter{this, std::chrono::steady_clock::now() + tmDuration}; }
+
+    /******************************************************************************
+     * @brief co_await the result of this to run heavy or blocking work on the
+     *      offload pool. The coroutine resumes on a worker with the work's return value.
+     *
+     * @tparam F - The type of the callable.
+     * @param fnWork - The callable to run. Takes no arguments.
+     * @return OffloadAwaiter<F> - The awaitable.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+    OffloadAwaiter<std::decay_t<F>> Offload(F &&fnWork)
+    {
+        return OffloadAwaiter<std::decay_t<F>>{this, std::forward<F>(fnWork)};
+    }
+
+    /******************************************************************************
+     * @brief co_await the result of this to run nNumTasks copies of some work on
+     *      the offload pool, like RunPool() followed by JoinPool() but without
+     *      blocking a thread while waiting.
+     *
+     * @tparam F - The type of the callable.
+     * @param nNumTasks - The number of tasks to run.
+     * @param fnWork - The callable to run. MUST ACCEPT ONE ARG: const unsigned int nTaskIndex.
+     * @return OffloadBatchAwaiter<F> - The awaitable.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+    OffloadBatchAwaiter<std::decay_t<F>> OffloadBatch(const unsigned int nNumTasks, F &&fnWork)
+    {
+        return OffloadBatchAwaiter<std::decay_t<F>>{this, nNumTasks, std::forward<F>(fnWork)};
+    }
+
+    /******************************************************************************
+     * @brief co_await the result of this to wait for the next item of a channel.
+     *      Only the channel's single consumer may do this.
+     *
+     * @tparam T - The type of the channel items.
+     * @tparam bMultiProducer - Whether the channel is multi-producer.
+     * @param stChannel - The channel to receive from.
+     * @return ChannelAwaiter<T, bMultiProducer> - The awaitable, resumes with an empty optional if the channel closed.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename T, bool bMultiProducer>
+    ChannelAwaiter<T, bMultiProducer> Receive(Channel<T, bMultiProducer> &stChannel)
+    {
+        return ChannelAwaiter<T, bMultiProducer>(this, &stChannel);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Worker Count private member.
+     *
+     * @return int - The number of worker threads resuming coroutines.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    int GetWorkerCount() const { return m_thWorkers.get_thread_count(); }
+
+private:
+    /////////////////////////////////////////
+    // Declare private class member variables.
+    /////////////////////////////////////////
+
+    alignas(cachealign::nDestructiveSize) BS::thread_pool m_thWorkers;
+    alignas(cachealign::nDestructiveSize) BS::thread_pool m_thOffloadPool;
+    alignas(cachealign::nDestructiveSize) BS::thread_pool m_thTimerThread;
+    alignas(cachealign::nDestructiveSize) std::mutex m_muTimerMutex;
+    std::condition_variable m_cdTimerCondition;
+    std::priority_queue<TimerEntry> m_pqTimers;
+    bool m_bStopTimers = false;
+
+    /////////////////////////////////////////
+    // Declare and define private methods.
+    /////////////////////////////////////////
+
+    /******************************************************************************
+     * @brief Parks a coroutine until the deadline passes.
+     *
+     * @param tmDeadline - When to resume.
+     * @param hCoroutine - The coroutine to resume.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void AddTimer(std::chrono::steady_clock::time_point tmDeadline, std::coroutine_handle<> hCoroutine)
+    {
+        // Create instance variables.
+        bool bNewEarliest = false;
+
+        // Add the timer.
+        {
+            std::lock_guard<std::mutex> lkTimerLock(m_muTimerMutex);
+            bNewEarliest = m_pqTimers.empty() || tmDeadline < m_pqTimers.top().tmDeadline;
+            m_pqTimers.push(TimerEntry{tmDeadline, hCoroutine});
+        }
+
+        // Only wake the timer thread if it needs to sleep for less time now.
+        if (bNewEarliest)
+        {
+            m_cdTimerCondition.notify_one();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Timer loop. Sleeps until the earliest deadline and posts expired
+     *      coroutines to the workers.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void RunTimers()
+    {
+        // Acquire timer lock.
+        std::unique_lock<std::mutex> lkTimerLock(m_muTimerMutex);
+
+        // Loop until the scheduler is destroyed.
+        while (!m_bStopTimers)
+        {
+            // Nothing to do, sleep until a timer is added.
+            if (m_pqTimers.empty())
+            {
+                m_cdTimerCondition.wait(lkTimerLock);
+            }
+            // Earliest timer expired, resume its coroutine.
+            else if (m_pqTimers.top().tmDeadline <= std::chrono::steady_clock::now())
+            {
+                std::coroutine_handle<> hCoroutine = m_pqTimers.top().hCoroutine;
+                m_pqTimers.pop();
+                lkTimerLock.unlock();
+                this->Post(hCoroutine);
+                lkTimerLock.lock();
+            }
+            // Sleep until the earliest timer expires or an earlier one is added.
+            else
+            {
+                m_cdTimerCondition.wait_until(lkTimerLock, m_pqTimers.top().tmDeadline);
+            }
+        }
+    }
+};
+
+/******************************************************************************
+ * @brief Interface class used to run a child class's main loop as a coroutine on
+ *      a CoroutineScheduler instead of in its own thread. It mirrors the
+ *      AutonomyThread main loop API (Start, RequestStop, Join, IPS limit) but
+ *      ThreadedContinuousCode() returns an AutonomyTask and can co_await timers,
+ *      offloaded pool work and channel data through GetScheduler().
+ *
+ *      ThreadedContinuousCode() must never block the worker thread it runs on.
+ *      Anything that blocks belongs in GetScheduler().Offload().
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class AutonomyCoroutineThread
+{
+public:
+    /////////////////////////////////////////
+    // Declare and define public class methods.
+    /////////////////////////////////////////
+
+    /******************************************************************************
+     * @brief Construct a new Autonomy Coroutine Thread object.
+     *
+     * @param stScheduler - The scheduler to run on. Must outlive this object.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    AutonomyCoroutineThread(CoroutineScheduler &stScheduler) : m_stScheduler(stScheduler)
+    {
+        // Initialize member variables.
+        m_bStopThreads = false;
+        m_bLoopFinished = true;
+        m_eThreadState = AutonomyThread<void>::eStopped;
+        m_nMainThreadMaxIterationPerSecond = 0;
+    }
+
+    /******************************************************************************
+     * @brief Destroy the Autonomy Coroutine Thread object. Stops and waits for the
+     *      main loop so the coroutine never outlives the object.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    virtual ~AutonomyCoroutineThread()
+    {
+        // Stop and wait for the main loop.
+        this->RequestStop();
+        this->Join();
+    }
+
+    /******************************************************************************
+     * @brief Starts the main loop coroutine on the scheduler. If it is already
+     *      running it is stopped and joined first.
+     *
+     * @note This method will block until the thread state is eRunning.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Start()
+    {
+        // Stop and wait for any running loop.
+        this->RequestStop();
+        this->Join();
+
+        // Update thread state.
+        {
+            std::lock_guard<std::mutex> lkStateLock(m_muThreadStateMutex);
+            m_eThreadState = AutonomyThread<void>::eStarting;
+            m_bStopThreads = false;
+            m_bLoopFinished = false;
+        }
+
+        // Launch the main loop. It immediately hops onto a worker.
+        this->RunThread();
+
+        // Block until the loop is running or already stopping.
+        std::unique_lock<std::mutex> lkStartLock(m_muThreadStateMutex);
+        m_cdThreadStateCondition.wait(lkStartLock,
+                                      [this]
+                                      {
+                                          return m_eThreadState == AutonomyThread<void>::eRunning || m_eThreadState == AutonomyThread<void>::eStopping ||
+                                                 m_bLoopFinished;
+                                      });
+    }
+
+    /******************************************************************************
+     * @brief Signals the main loop to stop. DOES NOT JOIN. The loop exits after the
+     *      current iteration or sleep finishes.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void RequestStop()
+    {
+        // Signal the loop to stop.
+        m_bStopThreads = true;
+        // Update thread state.
+        if (m_eThreadState != AutonomyThread<void>::eStopped)
+        {
+            m_eThreadState = AutonomyThread<void>::eStopping;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Waits for the main loop coroutine to finish. This method will block
+     *      the calling thread. Never call it from inside a coroutine.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Join()
+    {
+        // Wait for the loop to report that it finished.
+        std::unique_lock<std::mutex> lkJoinLock(m_muThreadStateMutex);
+        m_cdThreadStateCondition.wait(lkJoinLock, [this] { return m_bLoopFinished; });
+    }
+
+    /******************************************************************************
+     * @brief Check if the main loop coroutine has finished.
+     *
+     * @return true - The loop is finished.
+     * @return false - The loop is still running.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Joinable()
+    {
+        std::lock_guard<std::mutex> lkStateLock(m_muThreadStateMutex);
+        return m_bLoopFinished;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Threads State private member.
+     *
+     * @return AutonomyThread<void>::AutonomyThreadState - The current state of the main loop.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    AutonomyThread<void>::AutonomyThreadState GetThreadState() const { return m_eThreadState; }
+
+    /******************************************************************************
+     * @brief Accessor for the IPS private member.
+     *
+     * @return IPS& - The iteration per second counter for the ThreadedContinuousCode()
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    IPS &GetIPS() { return m_IPS; }
+
+protected:
+    /////////////////////////////////////////
+    // Declare protected objects.
+    /////////////////////////////////////////
+    alignas(cachealign::nDestructiveSize) IPS m_IPS = IPS();
+
+    /////////////////////////////////////////
+    // Declare and define protected class methods.
+    /////////////////////////////////////////
+
+    /******************************************************************************
+     * @brief Mutator for the Main Thread Max I P S private member.
+     *
+     * @param nMaxIterationsPerSecond - The max iteration per second limit of the main loop.
+     *
+     * @note - Set to zero to disable the max iteration per second limit.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMainThreadIPSLimit(int nMaxIterationsPerSecond = 0) { m_nMainThreadMaxIterationPerSecond = nMaxIterationsPerSecond; }
+
+    /******************************************************************************
+     * @brief Accessor for the Main Thread Max I P S private member.
+     *
+     * @return int - The max iterations per second the main loop can reach.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    int GetMainThreadMaxIPS() const { return m_nMainThreadMaxIterationPerSecond; }
+
+    /******************************************************************************
+     * @brief Accessor for the Scheduler private member. co_await its Schedule(),
+     *      SleepFor(), Offload(), OffloadBatch() and Receive() awaitables from
+     *      inside ThreadedContinuousCode().
+     *
+     * @return CoroutineScheduler& - The scheduler this loop runs on.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    CoroutineScheduler &GetScheduler() { return m_stScheduler; }
+
+private:
+    /////////////////////////////////////////
+    // Declare private structs.
+    /////////////////////////////////////////
+
+    // Eagerly started coroutine that cleans up after itself. Only used for the main loop.
+    struct DetachedLoop
+    {
+        struct promise_type
+        {
+            DetachedLoop get_return_object() const noexcept { return {}; }
+            std::suspend_never initial_suspend() const noexcept { return {}; }
+            std::suspend_never final_suspend() const noexcept { return {}; }
+            void return_void() const noexcept {}
+            void unhandled_exception() const noexcept { std::terminate(); }
+        };
+    };
+
+    /////////////////////////////////////////
+    // Declare private class member variables.
+    /////////////////////////////////////////
+
+    CoroutineScheduler &m_stScheduler;
+    // Control flags. Read by the loop every iteration, written rarely by other threads.
+    alignas(cachealign::nDestructiveSize) std::atomic_bool m_bStopThreads;
+    std::atomic<AutonomyThread<void>::AutonomyThreadState> m_eThreadState;
+    // Read-mostly configuration for the loop.
+    alignas(cachealign::nDestructiveSize) int m_nMainThreadMaxIterationPerSecond;
+    // Start and join handshake.
+    alignas(cachealign::nDestructiveSize) std::mutex m_muThreadStateMutex;
+    std::condition_variable m_cdThreadStateCondition;
+    bool m_bLoopFinished;
+
+    /////////////////////////////////////////
+    // Declare and/or define private methods.
+    /////////////////////////////////////////
+
+    // Declare interface class pure virtual functions. (These must be overriden by inheritor.)
+    virtual AutonomyTask ThreadedContinuousCode() = 0;    // This is where user's main continuously looping code will go. It may co_await but never block.
+
+    /******************************************************************************
+     * @brief The main loop coroutine. Mirrors AutonomyThread::RunThread(), except
+     *      the IPS limit is enforced by parking on the scheduler's timer instead of
+     *      sleeping a thread.
+     *
+     * @return DetachedLoop - Nothing useful, the coroutine owns itself.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    DetachedLoop RunThread()
+    {
+        // Move off the calling thread and onto a worker.
+        co_await m_stScheduler.Schedule();
+
+        // Loop until stop flag is set.
+        while (!m_bStopThreads)
+        {
+            // Get start execution time.
+            std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+
+            // Call method containing user code.
+            co_await this->ThreadedContinuousCode();
+
+            // Check if thread state needs to be updated.
+            if (m_eThreadState != AutonomyThread<void>::eRunning && m_eThreadState != AutonomyThread<void>::eStopping)
+            {
+                // Update thread state to running and notify waiting start method.
+                std::lock_guard<std::mutex> lkStateLock(m_muThreadStateMutex);
+                m_eThreadState = AutonomyThread<void>::eRunning;
+                m_cdThreadStateCondition.notify_all();
+            }
+
+            // Check if max IPS limit has been set.
+            if (m_nMainThreadMaxIterationPerSecond > 0)
+            {
+                // Park on the timer for the rest of this iteration's time slot.
+                co_await m_stScheduler.SleepUntil(tmStartTime + std::chrono::microseconds(1000000 / m_nMainThreadMaxIterationPerSecond));
+            }
+
+            // Call iteration per second tracking tick.
+            m_IPS.Tick();
+        }
+
+        // Notify joiners. Nothing may touch this object after the lock is released.
+        std::lock_guard<std::mutex> lkStateLock(m_muThreadStateMutex);
+        m_eThreadState = AutonomyThread<void>::eStopped;
+        m_bLoopFinished = true;
+        m_cdThreadStateCondition.notify_all();
+    }
+};
+
+#endif
@@ -14,13 +14,26 @@
 #ifndef AUTONOMYTHREAD_H
 #define AUTONOMYTHREAD_H
 
+#include "../util/CacheAlignment.hpp"
+#include "../util/ElasticThreadPool.hpp"
 #include "../util/IPS.hpp"
+#include "../util/PoolFuture.hpp"
+#include "../util/ScratchArena.hpp"
+#include "../util/TaskGraph.hpp"
+#include "../util/ThreadStack.hpp"
+#include "../util/ThreadRegistry.hpp"
 
 /// \cond
-#include "../../external/threadpool/include/BS_thread_pool.hpp"
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <concepts>
 #include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
 /// \endcond
@@ -50,17 +63,29 @@ public:
         eStopped
     };
 
+    // The combined result of a batch of PooledLinearCode() tasks queued by RunPoolAsync().
+    using PoolBatchType = std::conditional_t<std::is_void_v<T>, void, std::vector<T>>;
+
+    // Upper edges of the budget histogram buckets, in percent of the main loop budget. The last bucket has no upper edge.
+    static constexpr std::array<int, 7> aBudgetHistogramEdges = {25, 50, 75, 100, 125, 150, 200};
+    static constexpr size_t nBudgetHistogramBuckets = aBudgetHistogramEdges.size() + 1;
+    static_assert(nBudgetHistogramBuckets == std::tuple_size_v<decltype(ThreadTelemetrySlot::aBudgetHistogram)>, "Telemetry must hold every budget bucket.");
+
     /////////////////////////////////////////
     // Declare and define public class methods.
     /////////////////////////////////////////
     /******************************************************************************
      * @brief Construct a new Autonomy Thread object.
      *
+     * @param nMainThreadStackSize - Stack size of the main thread in bytes. 0 uses the system default.
+     * @param nPoolThreadStackSize - Stack size of each pool thread in bytes. 0 uses the system default.
      *
      * @author clayjay3 (claytonraycowen@gmail.com)
      * @date 2023-12-30
      ******************************************************************************/
-    AutonomyThread()
+    explicit AutonomyThread(const size_t nMainThreadStackSize = 0, const size_t nPoolThreadStackSize = 0)
+        : m_thMainThread(1, nMainThreadStackSize), m_thPool(2, nPoolThreadStackSize), m_nMainThreadStackSize(nMainThreadStackSize),
+          m_nPoolThreadStackSize(nPoolThreadStackSize)
     {
         // Initialize member variables.
         m_bStopThreads = false;
@@ -86,16 +111,18 @@ public:
         m_eThreadState = eStopping;
 
         // Pause and clear pool queues.
-        m_thPool.pause();
-        m_thPool.purge();
-        m_thMainThread.pause();
-        m_thMainThread.purge();
+        m_thPool.Pause();
+        m_thPool.Purge();
+        m_thMainThread.Pause();
+        m_thMainThread.Purge();
 
         // Wait for all pools to finish.
-        m_thPool.wait();
-        m_thMainThread.wait();
+        m_thPool.Wait();
+        m_thMainThread.Wait();
         // Update thread state.
         m_eThreadState = eStopped;
+        // Stop showing up in telemetry. The main thread is done, so nothing publishes into the slot anymore.
+        this->UnregisterTelemetry();
     }
 
     /******************************************************************************
@@ -122,28 +149,39 @@ public:
         m_eThreadState = eStopping;
 
         // Pause queuing of new tasks to the threads, then purge them.
-        m_thPool.pause();
-        m_thPool.purge();
-        m_thMainThread.pause();
-        m_thMainThread.purge();
+        m_thPool.Pause();
+        m_thPool.Purge();
+        m_thMainThread.Pause();
+        m_thMainThread.Purge();
 
         // Wait for loop, pool and main thread to join.
         this->Join();
+        // Drop anything the old main loop queued while it was stopping.
+        m_thPool.Purge();
+
+        // Recreate the main thread if its stack size changed.
+        if (m_bMainThreadStackSizeChanged)
+        {
+            m_thMainThread.SetStackSize(m_nMainThreadStackSize);
+            m_thMainThread.Reset(1);
+            m_bMainThreadStackSizeChanged = false;
+        }
 
         // Update thread state.
         m_eThreadState = eStarting;
-        // Clear results vector.
+        // Clear results vector and queue statistics.
         m_vPoolReturns.clear();
+        m_thPool.ResetQueueStatistics();
         // Reset thread stop toggle.
         m_bStopThreads = false;
 
         // Submit single task to pool queue and store resulting future. Still using pool, as it's scheduling is more efficient.
-        std::future<void> fuMainReturn = m_thMainThread.submit_task([this]()
+        std::future<void> fuMainReturn = m_thMainThread.SubmitTask([this]()
                                                                     { this->RunThread(m_bStopThreads); });
 
         // Unpause pool queues.
-        m_thPool.unpause();
-        m_thMainThread.unpause();
+        m_thPool.Unpause();
+        m_thMainThread.Unpause();
 
         // Block until thread is started or currently stopping if thread start failed.
         std::unique_lock<std::mutex> lkStartLock(m_muThreadRunningConditionMutex);
@@ -180,12 +218,18 @@ public:
     void Join()
     {
         // Wait for pool to finish all tasks.
-        m_thPool.wait();
+        m_thPool.Wait();
         // Wait for main thread to finish.
-        m_thMainThread.wait();
+        m_thMainThread.Wait();
 
         // Update thread state.
         m_eThreadState = eStopped;
+        // The main thread is done, so publish the final state from here.
+        int nTelemetrySlot = m_nTelemetrySlot.load(std::memory_order_acquire);
+        if (nTelemetrySlot >= 0)
+        {
+            this->PublishTelemetry(nTelemetrySlot, std::chrono::steady_clock::now());
+        }
     }
 
     /******************************************************************************
@@ -201,7 +245,7 @@ public:
     bool Joinable() const
     {
         // Check current number of running and queued tasks.
-        if (m_thMainThread.get_tasks_total() <= 0 && m_thPool.get_tasks_total() <= 0)
+        if (m_thMainThread.GetTasksTotal() <= 0 && m_thPool.GetTasksTotal() <= 0)
         {
             // Threads are joinable.
             return true;
@@ -233,11 +277,128 @@ public:
      ******************************************************************************/
     IPS &GetIPS() { return m_IPS; }
 
+    /******************************************************************************
+     * @brief Accessor for the Overrun Count private member. An overrun is a main
+     *      loop iteration that took longer than its budget, 1 / the IPS limit, so the
+     *      loop couldn't keep its rate. Only counted while an IPS limit is set.
+     *
+     * @return uint64_t - The number of iterations that went over budget.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetOverrunCount() const { return m_nOverrunCount.load(std::memory_order_relaxed); }
+
+    /******************************************************************************
+     * @brief Accessor for the Worst Overrun private member.
+     *
+     * @return std::chrono::microseconds - The most any iteration went over its budget by.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    std::chrono::microseconds GetWorstOverrun() const { return std::chrono::microseconds(m_nWorstOverrunMicroseconds.load(std::memory_order_relaxed)); }
+
+    /******************************************************************************
+     * @brief Accessor for the Budget Histogram private member. Counts main loop
+     *      iterations by how much of their budget they used, bucketed by
+     *      aBudgetHistogramEdges. Buckets past 100% are overruns.
+     *
+     * @return std::array<uint64_t, nBudgetHistogramBuckets> - The iteration count of each bucket.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    std::array<uint64_t, nBudgetHistogramBuckets> GetBudgetHistogram() const
+    {
+        // Create instance variables.
+        std::array<uint64_t, nBudgetHistogramBuckets> aHistogram;
+
+        // Copy each bucket.
+        for (size_t nIter = 0; nIter < nBudgetHistogramBuckets; ++nIter)
+        {
+            aHistogram[nIter] = m_aBudgetHistogram[nIter].load(std::memory_order_relaxed);
+        }
+
+        return aHistogram;
+    }
+
+    /******************************************************************************
+     * @brief Registers this thread in the process-wide ThreadRegistry. While the
+     *      main loop runs it publishes its state, IPS, pool size and queue length and
+     *      overrun counters at most once per publish interval. Only call while the
+     *      thread is stopped, before Start() or after Join().
+     *
+     * @param szName - The name shown to telemetry readers.
+     * @return true - The thread is registered.
+     * @return false - The registry is full.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool RegisterTelemetry(const std::string &szName)
+    {
+        // Only claim one slot.
+        if (m_nTelemetrySlot.load(std::memory_order_acquire) < 0)
+        {
+            m_nTelemetrySlot.store(ThreadRegistry::Instance().Register(szName), std::memory_order_release);
+        }
+
+        return m_nTelemetrySlot.load(std::memory_order_acquire) >= 0;
+    }
+
+    /******************************************************************************
+     * @brief Releases this thread's registry slot. Only call while the thread is
+     *      stopped, a running main thread could still publish into the slot after
+     *      another thread claims it. The destructor calls this after joining.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void UnregisterTelemetry()
+    {
+        // Take the slot first so a late reader sees -1 instead of a freed slot.
+        int nTelemetrySlot = m_nTelemetrySlot.exchange(-1, std::memory_order_acq_rel);
+        if (nTelemetrySlot >= 0)
+        {
+            ThreadRegistry::Instance().Unregister(nTelemetrySlot);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Telemetry Publish Interval private member.
+     *
+     * @param tmInterval - The least time between two telemetry updates. Zero publishes every iteration.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetTelemetryPublishInterval(std::chrono::microseconds tmInterval) { m_tmTelemetryPublishInterval = tmInterval; }
+
+    /******************************************************************************
+     * @brief Clears the overrun count, worst overrun and budget histogram.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ResetOverrunStats()
+    {
+        m_nOverrunCount.store(0, std::memory_order_relaxed);
+        m_nWorstOverrunMicroseconds.store(0, std::memory_order_relaxed);
+        for (std::atomic<uint64_t> &nBucket : m_aBudgetHistogram)
+        {
+            nBucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
 protected:
     /////////////////////////////////////////
     // Declare protected objects.
     /////////////////////////////////////////
-    IPS m_IPS = IPS();
+    // Written by the main thread every iteration, keep it off the cache lines other threads poll.
+    alignas(cachealign::nDestructiveSize) IPS m_IPS = IPS();
 
     /////////////////////////////////////////
     // Declare and define protected class methods.
@@ -273,41 +434,20 @@ protected:
      ******************************************************************************/
     void RunPool(const unsigned int nNumTasksToQueue, const unsigned int nNumThreads = 2, const bool bForceStopCurrentThreads = false)
     {
-        // Check if the pools need to be resized.
-        if (m_thPool.get_thread_count() != nNumThreads)
-        {
-            // Pause queuing of new tasks to the threads, then purge them.
-            m_thPool.pause();
-            m_thPool.purge();
-            // Wait for open threads to terminate, then resize the pool.
-            m_thPool.reset(nNumThreads);
-            // Unpause queue.
-            m_thPool.unpause();
-
-            // Clear results vector.
-            m_vPoolReturns.clear();
-        }
-        // Check if the current pool tasks should be stopped before queueing more tasks.
-        else if (bForceStopCurrentThreads)
-        {
-            // Pause queuing of new tasks to the threads, then purge them.
-            m_thPool.pause();
-            m_thPool.purge();
-            // Wait for threadpool to join.
-            m_thPool.wait();
-            // Unpause queue.
-            m_thPool.unpause();
-        }
+        // Resize or clear the pool if needed.
+        this->PreparePool(nNumThreads, bForceStopCurrentThreads);
 
         // Loop nNumThreads times and queue tasks.
         for (unsigned int i = 0; i < nNumTasksToQueue; ++i)
         {
             // Submit single task to pool queue.
-            m_vPoolReturns.emplace_back(m_thPool.submit_task(
+            m_vPoolReturns.emplace_back(this->SubmitPoolFuture(
                 [this]()
                 {
+                    // Free the task's scratch memory when it returns.
+                    ScratchArena::ResetGuard stScratchGuard(ScratchArena::ThreadLocal());
                     // Run user pool code without lock.
-                    this->PooledLinearCode();
+                    return this->PooledLinearCode();
                 }));
         }
     }
@@ -331,6 +471,11 @@ protected:
      *      a different threading method is called. So there's no overhead with starting and
      *      stopping threads or queueing more tasks.
      *
+     *      Every task is queued up front, so a large nNumTasksToQueue costs memory in
+     *      proportion to its size. Bound the queue with SetPoolQueueCapacity() to make
+     *      this method block or run tasks itself once the queue is full. Every task still
+     *      runs under every policy, see SetPoolQueueCapacity().
+     *
      *      YOU MUST HANDLE MUTEX LOCKS AND ATOMICS. It is impossible for this class to handle
      *      locks as all possible solutions lead to a solution that only lets one thread run at
      *      a time, essentially canceling out the parallelism.
@@ -345,45 +490,318 @@ protected:
      ******************************************************************************/
     void RunDetachedPool(const unsigned int nNumTasksToQueue, const unsigned int nNumThreads = 2, const bool bForceStopCurrentThreads = false)
     {
-        // Check if the pools need to be resized.
-        if (m_thPool.get_thread_count() != nNumThreads)
-        {
-            // Pause queuing of new tasks to the threads, then purge them.
-            m_thPool.pause();
-            m_thPool.purge();
-            // Wait for open threads to terminate, then resize the pool.
-            m_thPool.reset(nNumThreads);
-            // Unpause queue.
-            m_thPool.unpause();
-
-            // Clear results vector.
-            m_vPoolReturns.clear();
-        }
-        // Check if the current pool tasks should be stopped before queueing more tasks.
-        else if (bForceStopCurrentThreads)
-        {
-            // Pause queuing of new tasks to the threads, then purge them.
-            m_thPool.pause();
-            m_thPool.purge();
-            // Wait for threadpool to join.
-            m_thPool.wait();
-            // Unpause queue.
-            m_thPool.unpause();
-        }
+        // Resize or clear the pool if needed.
+        this->PreparePool(nNumThreads, bForceStopCurrentThreads);
 
         // Loop nNumThreads times and queue tasks.
         for (unsigned int i = 0; i < nNumTasksToQueue; ++i)
         {
             // Push single task to pool queue. No return value no control.
-            m_thPool.detach_task(
+            this->DetachPoolTask(
                 [this]()
                 {
+                    // Free the task's scratch memory when it returns.
+                    ScratchArena::ResetGuard stScratchGuard(ScratchArena::ThreadLocal());
                     // Run user code without lock.
                     this->PooledLinearCode();
                 });
         }
     }
 
+    /******************************************************************************
+     * @brief Same as RunPool(), but runs a callable that is given the index of its
+     *      task instead of PooledLinearCode(). Tasks find their share of the work from
+     *      the index, so no shared counter or lock is needed to hand it out. Results
+     *      are collected with GetPoolResults() in task order.
+     *
+     * @tparam F - The type of the callable. Takes an unsigned int and returns T.
+     * @param nNumTasksToQueue - The number of tasks to queue, indices are 0 to nNumTasksToQueue - 1.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param fnTask - The callable to run. Shared by every task, so it is never copied.
+     * @param bForceStopCurrentThreads - Clears the current tasks queue then signals and waits for existing
+     *                                  tasks to stop before queueing more.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+        requires std::invocable<F &, unsigned int>
+    void RunPool(const unsigned int nNumTasksToQueue, const unsigned int nNumThreads, F &&fnTask, const bool bForceStopCurrentThreads = false)
+    {
+        this->template QueueIndexedTasks<false>(nNumTasksToQueue, nNumThreads, std::forward<F>(fnTask), bForceStopCurrentThreads);
+    }
+
+    /******************************************************************************
+     * @brief Same as RunPool(), but splits the iterations 0 to tTotalIterations into
+     *      nearly equal contiguous ranges and gives each task its own range. Results
+     *      are collected with GetPoolResults() in range order.
+     *
+     * @tparam N - The integer type of the iterations.
+     * @tparam F - The type of the callable. Takes a start and end N and returns T.
+     * @param tTotalIterations - The total iterations to split.
+     * @param nNumTasksToQueue - The number of ranges. Capped at tTotalIterations.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param fnTask - The callable to run on [start, end). Shared by every task, so it is never copied.
+     * @param bForceStopCurrentThreads - Clears the current tasks queue then signals and waits for existing
+     *                                  tasks to stop before queueing more.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename N, typename F>
+        requires std::integral<N> && std::invocable<F &, N, N>
+    void RunPool(const N tTotalIterations,
+                 const unsigned int nNumTasksToQueue,
+                 const unsigned int nNumThreads,
+                 F &&fnTask,
+                 const bool bForceStopCurrentThreads = false)
+    {
+        this->template QueueRangeTasks<false>(tTotalIterations, nNumTasksToQueue, nNumThreads, std::forward<F>(fnTask), bForceStopCurrentThreads);
+    }
+
+    /******************************************************************************
+     * @brief Same as RunPool(), but queues one task per payload and moves the
+     *      payload into the callable, so each task owns its input outright. Results
+     *      are collected with GetPoolResults() in payload order.
+     *
+     * @tparam P - The payload type. Only needs to be movable.
+     * @tparam F - The type of the callable. Takes a P&& and returns T.
+     * @param vPayloads - One payload per task.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param fnTask - The callable to run. Shared by every task, so it is never copied.
+     * @param bForceStopCurrentThreads - Clears the current tasks queue then signals and waits for existing
+     *                                  tasks to stop before queueing more.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename P, typename F>
+        requires std::invocable<F &, P &&>
+    void RunPool(std::vector<P> vPayloads, const unsigned int nNumThreads, F &&fnTask, const bool bForceStopCurrentThreads = false)
+    {
+        this->template QueuePayloadTasks<false>(std::move(vPayloads), nNumThreads, std::forward<F>(fnTask), bForceStopCurrentThreads);
+    }
+
+    /******************************************************************************
+     * @brief Same as the indexed RunPool(), but doesn't store futures. Wait with
+     *      JoinPool().
+     *
+     * @tparam F - The type of the callable. Takes an unsigned int, the return value is discarded.
+     * @param nNumTasksToQueue - The number of tasks to queue, indices are 0 to nNumTasksToQueue - 1.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param fnTask - The callable to run. Shared by every task, so it is never copied.
+     * @param bForceStopCurrentThreads - Clears the current tasks queue then signals and waits for existing
+     *                                  tasks to stop before queueing more.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+        requires std::invocable<F &, unsigned int>
+    void RunDetachedPool(const unsigned int nNumTasksToQueue, const unsigned int nNumThreads, F &&fnTask, const bool bForceStopCurrentThreads = false)
+    {
+        this->template QueueIndexedTasks<true>(nNumTasksToQueue, nNumThreads, std::forward<F>(fnTask), bForceStopCurrentThreads);
+    }
+
+    /******************************************************************************
+     * @brief Same as the range RunPool(), but doesn't store futures. Wait with
+     *      JoinPool().
+     *
+     * @tparam N - The integer type of the iterations.
+     * @tparam F - The type of the callable. Takes a start and end N, the return value is discarded.
+     * @param tTotalIterations - The total iterations to split.
+     * @param nNumTasksToQueue - The number of ranges. Capped at tTotalIterations.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param fnTask - The callable to run on [start, end). Shared by every task, so it is never copied.
+     * @param bForceStopCurrentThreads - Clears the current tasks queue then signals and waits for existing
+     *                                  tasks to stop before queueing more.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename N, typename F>
+        requires std::integral<N> && std::invocable<F &, N, N>
+    void RunDetachedPool(const N tTotalIterations,
+                         const unsigned int nNumTasksToQueue,
+                         const unsigned int nNumThreads,
+                         F &&fnTask,
+                         const bool bForceStopCurrentThreads = false)
+    {
+        this->template QueueRangeTasks<true>(tTotalIterations, nNumTasksToQueue, nNumThreads, std::forward<F>(fnTask), bForceStopCurrentThreads);
+    }
+
+    /******************************************************************************
+     * @brief Same as the payload RunPool(), but doesn't store futures. Wait with
+     *      JoinPool().
+     *
+     * @tparam P - The payload type. Only needs to be movable.
+     * @tparam F - The type of the callable. Takes a P&&, the return value is discarded.
+     * @param vPayloads - One payload per task.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param fnTask - The callable to run. Shared by every task, so it is never copied.
+     * @param bForceStopCurrentThreads - Clears the current tasks queue then signals and waits for existing
+     *                                  tasks to stop before queueing more.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename P, typename F>
+        requires std::invocable<F &, P &&>
+    void RunDetachedPool(std::vector<P> vPayloads, const unsigned int nNumThreads, F &&fnTask, const bool bForceStopCurrentThreads = false)
+    {
+        this->template QueuePayloadTasks<true>(std::move(vPayloads), nNumThreads, std::forward<F>(fnTask), bForceStopCurrentThreads);
+    }
+
+    /******************************************************************************
+     * @brief Same as RunPool(), but instead of storing std::futures that have to be
+     *      waited on, it returns a single PoolFuture that becomes ready once every
+     *      queued PooledLinearCode() task has finished. Chain follow-up logic onto it
+     *      with Then() and let the main thread keep iterating instead of blocking in
+     *      JoinPool(). The follow-up runs on the pool thread that finishes last.
+     *
+     *      If the pool is purged before the tasks run, the future never becomes ready.
+     *
+     * @param nNumTasksToQueue - The number of tasks running PooledLinearCode() to queue.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param bForceStopCurrentThreads - Clears the current tasks queue then signals and waits for existing
+     *                                  tasks to stop before queueing more.
+     * @return PoolFuture<PoolBatchType> - A future for the results of every task, PoolFuture<void> if T is void.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    PoolFuture<PoolBatchType> RunPoolAsync(const unsigned int nNumTasksToQueue, const unsigned int nNumThreads = 2, const bool bForceStopCurrentThreads = false)
+    {
+        // Create instance variables.
+        std::vector<PoolFuture<T>> vFutures;
+        vFutures.reserve(nNumTasksToQueue);
+
+        // Resize or clear the pool if needed.
+        this->PreparePool(nNumThreads, bForceStopCurrentThreads);
+
+        // Loop nNumThreads times and queue tasks.
+        for (unsigned int i = 0; i < nNumTasksToQueue; ++i)
+        {
+            // Submit single task to pool queue.
+            vFutures.emplace_back(this->SubmitPoolTask([this]() { return this->PooledLinearCode(); }));
+        }
+
+        // Combine them into one future.
+        return WhenAll(vFutures);
+    }
+
+    /******************************************************************************
+     * @brief Queues any callable in the pool and returns a PoolFuture for its result.
+     *      Use this for pooled work that isn't PooledLinearCode(), then combine the
+     *      futures with Then(), WhenAll() or WhenAny(). Uses the pool's current size.
+     *
+     * @tparam F - The type of the callable. Must be copyable.
+     * @param fnTask - The callable to run. Takes no arguments.
+     * @return PoolFuture<std::invoke_result_t<F>> - A future for the callable's result.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+    PoolFuture<std::invoke_result_t<std::decay_t<F>>> SubmitPoolTask(F &&fnTask)
+    {
+        // Create instance variables.
+        using R = std::invoke_result_t<std::decay_t<F>>;
+        PoolPromise<R> stPromise;
+        PoolFuture<R> stFuture = stPromise.GetFuture();
+
+        // Push single task to pool queue. The promise is completed from the pool thread.
+        bool bQueued = this->DetachPoolTask(
+            [stPromise, fnTask = std::forward<F>(fnTask)]() mutable
+            {
+                // Free the task's scratch memory when it returns.
+                ScratchArena::ResetGuard stScratchGuard(ScratchArena::ThreadLocal());
+                try
+                {
+                    // Run user code without lock and store the result.
+                    if constexpr (std::is_void_v<R>)
+                    {
+                        fnTask();
+                        stPromise.SetValue();
+                    }
+                    else
+                    {
+                        stPromise.SetValue(fnTask());
+                    }
+                }
+                catch (...)
+                {
+                    stPromise.SetException(std::current_exception());
+                }
+            });
+        // The pool was stopping and dropped the task, don't leave the future waiting forever.
+        if (!bQueued)
+        {
+            stPromise.SetException(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+        }
+
+        return stFuture;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the calling thread's scratch arena. Use it for temporary
+     *      buffers in ThreadedContinuousCode(), PooledLinearCode() and any other pooled
+     *      task, either directly or as the memory resource of std::pmr containers.
+     *      Allocating is a pointer bump with no lock, and freeing is free.
+     *
+     *      Everything allocated is released at once when the main loop iteration or
+     *      pool task that allocated it returns. Don't keep pointers into the arena past
+     *      that point, and don't return results that live in it. Tasks that run in the
+     *      local pools of ParallelizeLoop(), ParallelReduce() or ParallelScan() should not
+     *      use it, those threads are never reset.
+     *
+     * @return ScratchArena& - The arena owned by the calling thread.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ScratchArena &GetScratchArena() { return ScratchArena::ThreadLocal(); }
+
+    /******************************************************************************
+     * @brief Runs every task in a TaskGraph on the pool and blocks until they are all
+     *      done. Each task is queued as soon as its predecessors finish instead of
+     *      waiting for a whole stage like a series of RunPool() and JoinPool() calls.
+     *      Must not be called from a pool thread.
+     *
+     * @param stGraph - The graph to run. Can be run again without rebuilding it.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param bForceStopCurrentThreads - Clears the current tasks queue then signals and waits for existing
+     *                                  tasks to stop before queueing more.
+     * @return true - Every task ran.
+     * @return false - The graph contains a cycle, nothing ran.
+     *
+     * @note Rethrows the first exception thrown by a task.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool RunTaskGraph(TaskGraph &stGraph, const unsigned int nNumThreads = 2, const bool bForceStopCurrentThreads = false)
+    {
+        // Resize or clear the pool if needed.
+        this->PreparePool(nNumThreads, bForceStopCurrentThreads);
+
+        // Run graph, ready tasks are pushed to the pool queue.
+        return stGraph.Run(
+            [this](std::function<void()> &&fnTask)
+            {
+                // Run() only returns once every node ran, so a node the stopping pool drops runs here instead.
+                std::function<void()> fnNode = [fnTask = std::move(fnTask)]()
+                {
+                    ScratchArena::ResetGuard stScratchGuard(ScratchArena::ThreadLocal());
+                    fnTask();
+                };
+                if (!this->DetachPoolTask(std::move(fnNode)))
+                {
+                    fnNode();
+                }
+            });
+    }
+
     /******************************************************************************
      * @brief Given a ref-qualified looping function and an arbitrary number of iterations,
      *      this method will divide up the loop and run each section in a thread pool.
@@ -414,18 +832,175 @@ protected:
     void ParallelizeLoop(const int nNumThreads, const N tTotalIterations, F &&tLoopFunction)
     {
         // Create new thread pool.
-        BS::thread_pool m_thLoopPool = BS::thread_pool(nNumThreads);
+        ElasticThreadPool thLoopPool(std::max(nNumThreads, 1), m_nPoolThreadStackSize);
+        const N tBlocks = std::max<N>(std::min<N>(N(std::max(nNumThreads, 1)), tTotalIterations), N(1));
+
+        // Queue one block per thread.
+        for (N tBlock = 0; tBlock < tBlocks && tTotalIterations > N(0); ++tBlock)
+        {
+            const N tStart = GetBlockStart(tTotalIterations, tBlocks, tBlock);
+            const N tEnd = GetBlockStart(tTotalIterations, tBlocks, N(tBlock + 1));
+            thLoopPool.DetachTask(
+                [&tLoopFunction, tStart, tEnd]()
+                {
+                    // Call loop function without lock.
+                    tLoopFunction(tStart, tEnd);
+                });
+        }
+
+        // Wait for loop to finish.
+        thLoopPool.Wait();
+    }
+
+    /******************************************************************************
+     * @brief Maps every iteration to a value and combines them into one result in
+     *      parallel. The iterations are split into one block per thread and each
+     *      block keeps its own accumulator, so nothing is locked while the loop runs.
+     *      The block results are combined in order on the calling thread. This method
+     *      will block until the reduction has completed.
+     *
+     *      fnCombine must be associative, it doesn't need to be commutative. Floating
+     *      point sums can differ slightly from a sequential loop since the order of the
+     *      additions changes.
+     *
+     * @tparam N - Template argument for the nTotalIterations type.
+     * @tparam R - Template argument for the result type.
+     * @tparam M - Template argument for the map function.
+     * @tparam C - Template argument for the combine function.
+     * @param nNumThreads - The number of threads to use for the thread pool.
+     * @param tTotalIterations - The total iterations to loop for.
+     * @param tIdentity - The value that leaves any other value unchanged when combined. (0 for sums)
+     * @param fnMap - Function that takes an iteration index and returns an R.
+     * @param fnCombine - Function that takes two R and returns their combination.
+     * @return R - The combination of every mapped value, tIdentity if there are no iterations.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename N, typename R, typename M, typename C>
+    R ParallelReduce(const int nNumThreads, const N tTotalIterations, const R tIdentity, M &&fnMap, C &&fnCombine)
+    {
+        // Create instance variables.
+        const N tBlocks = std::max<N>(std::min<N>(N(std::max(nNumThreads, 1)), tTotalIterations), N(1));
+        std::vector<CacheAligned<R>> vPartials(static_cast<size_t>(tBlocks), CacheAligned<R>(tIdentity));
+        ElasticThreadPool thLoopPool(std::max(nNumThreads, 1), m_nPoolThreadStackSize);
+
+        // Reduce each block into its own accumulator.
+        for (N tBlock = 0; tBlock < tBlocks; ++tBlock)
+        {
+            thLoopPool.DetachTask(
+                [&, tBlock]()
+                {
+                    // Accumulate locally, then store once.
+                    R tAccumulator = tIdentity;
+                    for (N tIter = GetBlockStart(tTotalIterations, tBlocks, tBlock); tIter < GetBlockStart(tTotalIterations, tBlocks, N(tBlock + 1)); ++tIter)
+                    {
+                        tAccumulator = fnCombine(tAccumulator, fnMap(tIter));
+                    }
+                    vPartials[size_t(tBlock)].tValue = tAccumulator;
+                });
+        }
+
+        // Wait for loop to finish.
+        thLoopPool.Wait();
+
+        // Combine blocks in order.
+        R tResult = tIdentity;
+        for (const CacheAligned<R> &stPartial : vPartials)
+        {
+            tResult = fnCombine(tResult, stPartial.tValue);
+        }
 
-        m_thLoopPool.detach_blocks(0,
-                                   tTotalIterations,
-                                   [&tLoopFunction](const int nStart, const int nEnd)
-                                   {
-                                       // Call loop function without lock.
-                                       tLoopFunction(nStart, nEnd);
-                                   });
+        return tResult;
+    }
+
+    /******************************************************************************
+     * @brief Computes the running combination of a range in parallel, like
+     *      std::inclusive_scan or std::exclusive_scan. The range is split into one
+     *      block per thread. The first pass reduces each block, the block totals are
+     *      scanned on the calling thread, and the second pass scans each block
+     *      starting from its total. Nothing is locked while the passes run. The output
+     *      may be the same range as the input. This method will block until the scan
+     *      has completed.
+     *
+     *      fnCombine must be associative, it doesn't need to be commutative.
+     *
+     * @tparam I - Template argument for the input random access iterator.
+     * @tparam O - Template argument for the output random access iterator.
+     * @tparam V - Template argument for the value type.
+     * @tparam C - Template argument for the combine function.
+     * @param nNumThreads - The number of threads to use for the thread pool.
+     * @param itFirst - Start of the input range.
+     * @param itLast - End of the input range.
+     * @param itOutput - Start of the output range, must hold as many values as the input.
+     * @param tIdentity - The value that leaves any other value unchanged when combined. (0 for sums)
+     * @param fnCombine - Function that takes two V and returns their combination.
+     * @param bInclusive - True to include each input in its own output, false to start the output with tIdentity.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename I, typename O, typename V, typename C>
+    void ParallelScan(const int nNumThreads, I itFirst, I itLast, O itOutput, const V tIdentity, C &&fnCombine, const bool bInclusive = true)
+    {
+        // Create instance variables.
+        const size_t nTotal = size_t(itLast - itFirst);
+        const size_t nBlocks = std::max<size_t>(std::min<size_t>(size_t(std::max(nNumThreads, 1)), nTotal), 1);
+        std::vector<CacheAligned<V>> vBlockTotals(nBlocks, CacheAligned<V>(tIdentity));
+        ElasticThreadPool thLoopPool(std::max(nNumThreads, 1), m_nPoolThreadStackSize);
+
+        // First pass, reduce each block.
+        for (size_t nBlock = 0; nBlock < nBlocks; ++nBlock)
+        {
+            thLoopPool.DetachTask(
+                [&, nBlock]()
+                {
+                    V tAccumulator = tIdentity;
+                    for (size_t nIter = GetBlockStart(nTotal, nBlocks, nBlock); nIter < GetBlockStart(nTotal, nBlocks, nBlock + 1); ++nIter)
+                    {
+                        tAccumulator = fnCombine(tAccumulator, itFirst[nIter]);
+                    }
+                    vBlockTotals[nBlock].tValue = tAccumulator;
+                });
+        }
+        thLoopPool.Wait();
+
+        // Turn the block totals into the starting value of each block.
+        V tRunning = tIdentity;
+        for (CacheAligned<V> &stBlockTotal : vBlockTotals)
+        {
+            V tBlockTotal = stBlockTotal.tValue;
+            stBlockTotal.tValue = tRunning;
+            tRunning = fnCombine(tRunning, tBlockTotal);
+        }
+
+        // Second pass, scan each block from its starting value.
+        for (size_t nBlock = 0; nBlock < nBlocks; ++nBlock)
+        {
+            thLoopPool.DetachTask(
+                [&, nBlock]()
+                {
+                    V tAccumulator = vBlockTotals[nBlock].tValue;
+                    for (size_t nIter = GetBlockStart(nTotal, nBlocks, nBlock); nIter < GetBlockStart(nTotal, nBlocks, nBlock + 1); ++nIter)
+                    {
+                        // Read before writing so the scan can run in place.
+                        V tValue = itFirst[nIter];
+                        if (bInclusive)
+                        {
+                            tAccumulator = fnCombine(tAccumulator, tValue);
+                            itOutput[nIter] = tAccumulator;
+                        }
+                        else
+                        {
+                            itOutput[nIter] = tAccumulator;
+                            tAccumulator = fnCombine(tAccumulator, tValue);
+                        }
+                    }
+                });
+        }
 
         // Wait for loop to finish.
-        m_thLoopPool.wait();
+        thLoopPool.Wait();
     }
 
     /******************************************************************************
@@ -436,7 +1011,7 @@ protected:
      * @author ClayJay3 (claytonraycowen@gmail.com)
      * @date 2023-09-09
      ******************************************************************************/
-    void ClearPoolQueue() { m_thPool.purge(); }
+    void ClearPoolQueue() { m_thPool.Purge(); }
 
     /******************************************************************************
      * @brief Waits for pool to finish executing tasks. This method will block
@@ -446,7 +1021,7 @@ protected:
      * @author ClayJay3 (claytonraycowen@gmail.com)
      * @date 2023-07-22
      ******************************************************************************/
-    void JoinPool() { m_thPool.wait(); }
+    void JoinPool() { m_thPool.Wait(); }
 
     /******************************************************************************
      * @brief Check if the internal pool threads are done executing code and the
@@ -461,7 +1036,7 @@ protected:
     bool PoolJoinable() const
     {
         // Check current number of running and queued tasks.
-        if (m_thPool.get_tasks_total() <= 0)
+        if (m_thPool.GetTasksTotal() <= 0)
         {
             // Threads are joinable.
             return true;
@@ -489,6 +1064,64 @@ protected:
         m_nMainThreadMaxIterationPerSecond = nMaxIterationsPerSecond;
     }
 
+    /******************************************************************************
+     * @brief Mutator for the Main Thread Stack Size private member. The main thread
+     *      is recreated with the new size the next time Start() is called.
+     *
+     * @param nBytes - Stack size of the main thread in bytes. 0 uses the system default.
+     *
+     * @note Rounded up to whole pages and PTHREAD_STACK_MIN.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMainThreadStackSize(const size_t nBytes)
+    {
+        // Assign member variables.
+        m_nMainThreadStackSize = nBytes;
+        m_bMainThreadStackSizeChanged = true;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Pool Thread Stack Size private member. The pool's
+     *      workers are replaced with the new size the next time work is queued, which
+     *      waits for running tasks. Queued tasks are kept. Pools made by
+     *      ParallelizeLoop(), ParallelReduce() and ParallelScan() use it too.
+     *
+     * @param nBytes - Stack size of each pool thread in bytes. 0 uses the system default.
+     *
+     * @note Rounded up to whole pages and PTHREAD_STACK_MIN.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPoolThreadStackSize(const size_t nBytes)
+    {
+        // Assign member variables.
+        m_nPoolThreadStackSize = nBytes;
+        m_bPoolThreadStackSizeChanged = true;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Main Thread Stack Size private member.
+     *
+     * @return size_t - The requested main thread stack size in bytes, 0 for the system default.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetMainThreadStackSize() const { return m_nMainThreadStackSize; }
+
+    /******************************************************************************
+     * @brief Accessor for the Pool Thread Stack Size private member.
+     *
+     * @return size_t - The requested pool thread stack size in bytes, 0 for the system default.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetPoolThreadStackSize() const { return m_nPoolThreadStackSize; }
+
     /******************************************************************************
      * @brief Accessor for the Pool Num Of Threads private member.
      *
@@ -497,7 +1130,7 @@ protected:
      * @author ClayJay3 (claytonraycowen@gmail.com)
      * @date 2023-09-09
      ******************************************************************************/
-    int GetPoolNumOfThreads() { return m_thPool.get_thread_count(); }
+    int GetPoolNumOfThreads() { return m_thPool.GetThreadCount(); }
 
     /******************************************************************************
      * @brief Accessor for the Pool Queue Size private member.
@@ -507,7 +1140,62 @@ protected:
      * @author clayjay3 (claytonraycowen@gmail.com)
      * @date 2024-03-14
      ******************************************************************************/
-    int GetPoolQueueLength() { return m_thPool.get_tasks_queued(); }
+    int GetPoolQueueLength() { return m_thPool.GetTasksQueued(); }
+
+    /******************************************************************************
+     * @brief Mutator for the pool queue capacity. By default the queue is unbounded,
+     *      so RunDetachedPool(999999) holds 999999 tasks in memory at once. With a
+     *      capacity, the policy decides what happens to tasks that don't fit:
+     *
+     *          eBlock - The submitting thread waits for room, so it can't outrun the pool.
+     *          eReject - The pool rejects the task and counts it, then the submitting thread
+     *                    runs it, so no PooledLinearCode() task or future is lost.
+     *          eCallerRuns - The submitting thread runs the task itself.
+     *
+     *      Only while the pool is paused to stop or restart the thread are tasks that
+     *      don't fit dropped, and their futures hold std::future_error.
+     *
+     * @param nCapacity - The most tasks that can wait in the queue. 0 for unbounded.
+     * @param ePolicy - What to do with a task that doesn't fit.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetPoolQueueCapacity(const size_t nCapacity, const ElasticThreadPool::QueueFullPolicy ePolicy = ElasticThreadPool::eBlock)
+    {
+        m_thPool.SetQueueCapacity(nCapacity, ePolicy);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the longest the pool queue has been since Start().
+     *
+     * @return size_t - The peak number of queued tasks.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetPoolPeakQueueLength() const { return m_thPool.GetPeakTasksQueued(); }
+
+    /******************************************************************************
+     * @brief Accessor for the number of tasks a full pool queue rejected since Start().
+     *
+     * @return uint64_t - The number of dropped tasks.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetPoolRejectedTaskCount() const { return m_thPool.GetRejectedTaskCount(); }
+
+    /******************************************************************************
+     * @brief Accessor for the number of tasks the submitting thread ran itself
+     *      because the pool queue was full, since Start().
+     *
+     * @return uint64_t - The number of tasks run by the caller.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetPoolCallerRunTaskCount() const { return m_thPool.GetCallerRunTaskCount(); }
 
     /******************************************************************************
      * @brief Accessor for the Pool Results private member. The action of getting
@@ -527,7 +1215,7 @@ protected:
         std::vector<T> vResults;
 
         // Loop the pool futures and get result.
-        for (std::future<T> fResult : m_vPoolReturns)
+        for (std::future<T> &fResult : m_vPoolReturns)
         {
             // Store returned value.
             vResults.emplace_back(fResult.get());
@@ -558,14 +1246,34 @@ private:
     // Declare private class member variables.
     /////////////////////////////////////////
 
-    BS::thread_pool m_thMainThread = BS::thread_pool(1);
-    BS::thread_pool m_thPool = BS::thread_pool(2);
+    // Members are grouped by which threads touch them and each group starts on a new cache line.
+    // This keeps the pool's internal locks, the control flags polled by the main loop, and the
+    // start handshake from invalidating each other's cache lines when written.
+    alignas(cachealign::nDestructiveSize) ElasticThreadPool m_thMainThread = ElasticThreadPool(1);
+    alignas(cachealign::nDestructiveSize) ElasticThreadPool m_thPool = ElasticThreadPool(2);
     std::vector<std::future<T>> m_vPoolReturns;
-    std::atomic_bool m_bStopThreads;
+    // Control flags. Read by the main loop every iteration, written rarely by other threads.
+    alignas(cachealign::nDestructiveSize) std::atomic_bool m_bStopThreads;
     std::atomic<AutonomyThreadState> m_eThreadState;
-    std::mutex m_muThreadRunningConditionMutex;
+    // Read-mostly configuration for the main loop.
+    alignas(cachealign::nDestructiveSize) int m_nMainThreadMaxIterationPerSecond;
+    // Thread stack sizes, 0 for the system default. Applied when the threads are next created.
+    size_t m_nMainThreadStackSize;
+    size_t m_nPoolThreadStackSize;
+    bool m_bMainThreadStackSizeChanged = false;
+    bool m_bPoolThreadStackSizeChanged = false;
+    // Start handshake between Start() and RunThread().
+    alignas(cachealign::nDestructiveSize) std::mutex m_muThreadRunningConditionMutex;
     std::condition_variable m_cdThreadRunningCondition;
-    int m_nMainThreadMaxIterationPerSecond;
+
+    // Main loop budget accounting. Written only by the main thread, read by anyone.
+    alignas(cachealign::nDestructiveSize) std::atomic<uint64_t> m_nOverrunCount = 0;
+    std::atomic<int64_t> m_nWorstOverrunMicroseconds = 0;
+    std::array<std::atomic<uint64_t>, nBudgetHistogramBuckets> m_aBudgetHistogram = {};
+    // Telemetry registration. Only the main thread publishes while it runs, publishers read the slot once.
+    std::atomic<int> m_nTelemetrySlot = -1;
+    std::chrono::microseconds m_tmTelemetryPublishInterval = std::chrono::microseconds(10000);
+    std::chrono::steady_clock::time_point m_tmLastTelemetryPublish;
 
     /////////////////////////////////////////
     // Declare and/or define private methods.
@@ -576,7 +1284,350 @@ private:
     virtual T PooledLinearCode() = 0;          // This is where user's offshoot, highly parallelizable code will go. Helpful for intensive short-lived tasks.
                                                // Can be ran from inside the ThreadedContinuousCode() method.
 
+    /******************************************************************************
+     * @brief Optional hook called from the main thread right after an iteration
+     *      of ThreadedContinuousCode() goes over its budget. Does nothing unless
+     *      overridden. Runs inside the main loop, so keep it short. Logging or
+     *      bumping a counter is fine, blocking is not.
+     *
+     * @param tmElapsed - How long the iteration took.
+     * @param tmBudget - How long it was allowed to take, 1 / the IPS limit.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    virtual void OnMainThreadOverrun(std::chrono::microseconds tmElapsed, std::chrono::microseconds tmBudget)
+    {
+        (void) tmElapsed;
+        (void) tmBudget;
+    }
+
+    /******************************************************************************
+     * @brief Copies this thread's stats into its registry slot. Only atomic stores
+     *      into the table plus a short uncontended lock to read the pool queue
+     *      length, so nothing on this path makes a syscall.
+     *
+     * @param nTelemetrySlot - The slot index the caller read, never negative.
+     * @param tmNow - The current time.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PublishTelemetry(const int nTelemetrySlot, std::chrono::steady_clock::time_point tmNow)
+    {
+        // Get this thread's slot.
+        ThreadTelemetrySlot &stSlot = ThreadRegistry::Instance().GetSlot(nTelemetrySlot);
+        m_tmLastTelemetryPublish = tmNow;
+
+        // Write everything between the sequence bumps.
+        ThreadRegistry::BeginWrite(stSlot);
+        stSlot.nState.store(int32_t(m_eThreadState.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        stSlot.nIPSLimit.store(m_nMainThreadMaxIterationPerSecond, std::memory_order_relaxed);
+        stSlot.nPoolThreads.store(int32_t(m_thPool.GetThreadCount()), std::memory_order_relaxed);
+        stSlot.nPoolQueueLength.store(int32_t(m_thPool.GetTasksQueued()), std::memory_order_relaxed);
+        stSlot.dCurrentIPS.store(m_IPS.GetExactIPS(), std::memory_order_relaxed);
+        stSlot.dAverageIPS.store(m_IPS.GetAverageIPS(), std::memory_order_relaxed);
+        stSlot.d1PercentLow.store(m_IPS.Get1PercentLow(), std::memory_order_relaxed);
+        stSlot.nOverrunCount.store(m_nOverrunCount.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        stSlot.nWorstOverrunMicroseconds.store(uint64_t(m_nWorstOverrunMicroseconds.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        for (size_t nIter = 0; nIter < nBudgetHistogramBuckets; ++nIter)
+        {
+            stSlot.aBudgetHistogram[nIter].store(m_aBudgetHistogram[nIter].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        stSlot.nUpdateTimeNanoseconds.store(std::chrono::duration_cast<std::chrono::nanoseconds>(tmNow.time_since_epoch()).count(), std::memory_order_relaxed);
+        ThreadRegistry::EndWrite(stSlot);
+    }
+
+    /******************************************************************************
+     * @brief Records one main loop iteration against its budget. Only relaxed
+     *      atomic adds on the fast path, the worst overrun and the hook are only
+     *      touched when the iteration went over.
+     *
+     * @param tmElapsed - How long the iteration took.
+     * @param tmBudget - How long it was allowed to take.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void AccountIteration(std::chrono::microseconds tmElapsed, std::chrono::microseconds tmBudget)
+    {
+        // Find the bucket for the share of the budget this iteration used.
+        int64_t nPercent = tmBudget.count() > 0 ? tmElapsed.count() * 100 / tmBudget.count() : 0;
+        size_t nBucket = 0;
+        while (nBucket < aBudgetHistogramEdges.size() && nPercent >= aBudgetHistogramEdges[nBucket])
+        {
+            ++nBucket;
+        }
+        m_aBudgetHistogram[nBucket].fetch_add(1, std::memory_order_relaxed);
+
+        // Check if the iteration went over budget.
+        if (tmElapsed > tmBudget)
+        {
+            m_nOverrunCount.fetch_add(1, std::memory_order_relaxed);
+            // Only the main thread writes, so a plain compare and store is enough.
+            int64_t nOverrun = (tmElapsed - tmBudget).count();
+            if (nOverrun > m_nWorstOverrunMicroseconds.load(std::memory_order_relaxed))
+            {
+                m_nWorstOverrunMicroseconds.store(nOverrun, std::memory_order_relaxed);
+            }
+            // Let the inheritor react.
+            this->OnMainThreadOverrun(tmElapsed, tmBudget);
+        }
+    }
+
     // Declare and define private interface methods.
+    /******************************************************************************
+     * @brief Queues one task in the pool. A bounded queue that rejects the task hands
+     *      it back, and it runs on the calling thread instead, so no task is lost to
+     *      eReject. Only a pool paused by Start(), the destructor or a forced stop drops
+     *      it, like Purge() would have.
+     *
+     * @tparam F - The type of the task. Takes no arguments.
+     * @param fnTask - The task.
+     * @return true - The task was queued or already ran.
+     * @return false - The pool is paused and full, the task was dropped.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+    bool DetachPoolTask(F &&fnTask)
+    {
+        // A rejected task is not moved from.
+        if (m_thPool.DetachTask(std::forward<F>(fnTask)))
+        {
+            return true;
+        }
+        // The owner is stopping or clearing the pool.
+        if (m_thPool.IsPaused())
+        {
+            return false;
+        }
+
+        // Run it here instead.
+        fnTask();
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Queues one task in the pool and returns a std::future for its result,
+     *      going through DetachPoolTask(). A dropped task leaves a std::future_error
+     *      with broken_promise in the future.
+     *
+     * @tparam F - The type of the task. Takes no arguments.
+     * @tparam R - The return type of the task.
+     * @param fnTask - The task.
+     * @return std::future<R> - The result of the task.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F, typename R = std::invoke_result_t<std::decay_t<F>>>
+    std::future<R> SubmitPoolFuture(F &&fnTask)
+    {
+        // Shared so the queued wrapper stays copyable.
+        std::shared_ptr<std::packaged_task<R()>> spTask = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fnTask));
+        std::future<R> fuResult = spTask->get_future();
+
+        this->DetachPoolTask([spTask]() { (*spTask)(); });
+
+        return fuResult;
+    }
+
+    /******************************************************************************
+     * @brief Queues one task in the pool, keeping its future for GetPoolResults()
+     *      unless it is detached.
+     *
+     * @tparam bDetached - True to drop the result.
+     * @tparam F - The type of the task. Takes no arguments and returns T, or anything if detached.
+     * @param fnTask - The task.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <bool bDetached, typename F>
+    void QueuePoolTask(F &&fnTask)
+    {
+        // Check if the result is wanted.
+        if constexpr (bDetached)
+        {
+            this->DetachPoolTask(
+                [fnTask = std::forward<F>(fnTask)]()
+                {
+                    ScratchArena::ResetGuard stScratchGuard(ScratchArena::ThreadLocal());
+                    fnTask();
+                });
+        }
+        else
+        {
+            m_vPoolReturns.emplace_back(this->SubmitPoolFuture(
+                [fnTask = std::forward<F>(fnTask)]() -> T
+                {
+                    ScratchArena::ResetGuard stScratchGuard(ScratchArena::ThreadLocal());
+                    return static_cast<T>(fnTask());
+                }));
+        }
+    }
+
+    /******************************************************************************
+     * @brief Shared by the indexed RunPool() and RunDetachedPool() overloads.
+     *
+     * @tparam bDetached - True to drop the results.
+     * @tparam F - The type of the callable.
+     * @param nNumTasksToQueue - The number of tasks to queue.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param fnTask - The callable, given each task's index.
+     * @param bForceStopCurrentThreads - Clears and waits for the pool first.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <bool bDetached, typename F>
+    void QueueIndexedTasks(const unsigned int nNumTasksToQueue, const unsigned int nNumThreads, F &&fnTask, const bool bForceStopCurrentThreads)
+    {
+        // Create instance variables. One shared copy of the callable for every task.
+        std::shared_ptr<std::decay_t<F>> spTask = std::make_shared<std::decay_t<F>>(std::forward<F>(fnTask));
+
+        // Resize or clear the pool if needed.
+        this->PreparePool(nNumThreads, bForceStopCurrentThreads);
+
+        // Queue one task per index.
+        for (unsigned int nIndex = 0; nIndex < nNumTasksToQueue; ++nIndex)
+        {
+            this->template QueuePoolTask<bDetached>([spTask, nIndex]() { return (*spTask)(nIndex); });
+        }
+    }
+
+    /******************************************************************************
+     * @brief Shared by the range RunPool() and RunDetachedPool() overloads.
+     *
+     * @tparam bDetached - True to drop the results.
+     * @tparam N - The integer type of the iterations.
+     * @tparam F - The type of the callable.
+     * @param tTotalIterations - The total iterations to split.
+     * @param nNumTasksToQueue - The number of ranges.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param fnTask - The callable, given each task's start and end.
+     * @param bForceStopCurrentThreads - Clears and waits for the pool first.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <bool bDetached, typename N, typename F>
+    void QueueRangeTasks(const N tTotalIterations, const unsigned int nNumTasksToQueue, const unsigned int nNumThreads, F &&fnTask, const bool bForceStopCurrentThreads)
+    {
+        // Create instance variables. One shared copy of the callable for every task.
+        std::shared_ptr<std::decay_t<F>> spTask = std::make_shared<std::decay_t<F>>(std::forward<F>(fnTask));
+        const N tRanges = tTotalIterations > N(0) ? std::min<N>(N(std::max(nNumTasksToQueue, 1u)), tTotalIterations) : N(0);
+
+        // Resize or clear the pool if needed.
+        this->PreparePool(nNumThreads, bForceStopCurrentThreads);
+
+        // Queue one task per range.
+        for (N tRange = 0; tRange < tRanges; ++tRange)
+        {
+            N tStart = GetBlockStart(tTotalIterations, tRanges, tRange);
+            N tEnd = GetBlockStart(tTotalIterations, tRanges, N(tRange + 1));
+            this->template QueuePoolTask<bDetached>([spTask, tStart, tEnd]() { return (*spTask)(tStart, tEnd); });
+        }
+    }
+
+    /******************************************************************************
+     * @brief Shared by the payload RunPool() and RunDetachedPool() overloads. The
+     *      payloads are moved into one shared vector so the queued tasks stay
+     *      copyable even when the payload is move only.
+     *
+     * @tparam bDetached - True to drop the results.
+     * @tparam P - The payload type.
+     * @tparam F - The type of the callable.
+     * @param vPayloads - One payload per task.
+     * @param nNumThreads - The number of threads to run user code in.
+     * @param fnTask - The callable, given each task's payload.
+     * @param bForceStopCurrentThreads - Clears and waits for the pool first.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <bool bDetached, typename P, typename F>
+    void QueuePayloadTasks(std::vector<P> &&vPayloads, const unsigned int nNumThreads, F &&fnTask, const bool bForceStopCurrentThreads)
+    {
+        // Create instance variables. Each task only touches its own element.
+        std::shared_ptr<std::decay_t<F>> spTask = std::make_shared<std::decay_t<F>>(std::forward<F>(fnTask));
+        std::shared_ptr<std::vector<P>> spPayloads = std::make_shared<std::vector<P>>(std::move(vPayloads));
+
+        // Resize or clear the pool if needed.
+        this->PreparePool(nNumThreads, bForceStopCurrentThreads);
+
+        // Queue one task per payload.
+        for (size_t nIndex = 0; nIndex < spPayloads->size(); ++nIndex)
+        {
+            this->template QueuePoolTask<bDetached>([spTask, spPayloads, nIndex]() { return (*spTask)(std::move((*spPayloads)[nIndex])); });
+        }
+    }
+
+    /******************************************************************************
+     * @brief Finds where a block starts when a range is split into nearly equal
+     *      blocks. The first tTotal % tBlocks blocks get one extra element.
+     *
+     * @tparam N - The index type.
+     * @param tTotal - The size of the range.
+     * @param tBlocks - The number of blocks.
+     * @param tBlock - The block index, tBlocks gives the end of the range.
+     * @return N - The index of the first element of the block.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename N>
+    static N GetBlockStart(const N tTotal, const N tBlocks, const N tBlock)
+    {
+        return tTotal / tBlocks * tBlock + std::min(tBlock, tTotal % tBlocks);
+    }
+
+    /******************************************************************************
+     * @brief Optionally clears the queue and waits for running tasks, then resizes
+     *      the pool if it doesn't have nNumThreads threads. The resize happens in
+     *      place, queued tasks and their results are kept and running tasks are not
+     *      waited on. Only a new stack size waits for running tasks, because every
+     *      worker has to be replaced. Shared by every method that queues pool tasks.
+     *
+     * @param nNumThreads - The number of threads the pool should have.
+     * @param bForceStopCurrentThreads - Clears the current tasks queue then waits for existing
+     *                                  tasks to stop.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PreparePool(const unsigned int nNumThreads, const bool bForceStopCurrentThreads)
+    {
+        // Check if the current pool tasks should be stopped before queueing more tasks.
+        if (bForceStopCurrentThreads)
+        {
+            // Pause queuing of new tasks to the threads, then purge them.
+            m_thPool.Pause();
+            m_thPool.Purge();
+            // Wait for threadpool to join.
+            m_thPool.Wait();
+            // Unpause queue.
+            m_thPool.Unpause();
+        }
+
+        // Check if the workers need new stacks.
+        if (m_bPoolThreadStackSizeChanged)
+        {
+            // Replace every worker once the running tasks are done. Queued tasks are kept.
+            m_thPool.SetStackSize(m_nPoolThreadStackSize);
+            m_thPool.Reset(nNumThreads);
+            m_bPoolThreadStackSizeChanged = false;
+        }
+        // Check if the pool needs to be resized.
+        else if (m_thPool.GetThreadCount() != nNumThreads)
+        {
+            // Add or retire workers without stopping anything.
+            m_thPool.Resize(nNumThreads);
+        }
+    }
+
     /******************************************************************************
      * @brief This method is ran in a separate thread. It is a middleware between the
      *      class member thread and the user code that handles graceful stopping of
@@ -604,6 +1655,8 @@ private:
 
             // Call method containing user code.
             this->ThreadedContinuousCode();
+            // Free everything the iteration put in its scratch arena.
+            ScratchArena::ThreadLocal().Reset();
 
             // Check if max IPS limit has been set.
             if (m_nMainThreadMaxIterationPerSecond > 0)
@@ -612,6 +1665,8 @@ private:
                 std::chrono::_V2::system_clock::time_point tmEndTime = std::chrono::high_resolution_clock::now();
                 // Get execution time of user code.
                 std::chrono::microseconds tmElapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(tmEndTime - tmStartTime);
+                // Record how much of the budget was used and whether the loop missed its rate.
+                this->AccountIteration(tmElapsedTime, std::chrono::microseconds(1000000 / m_nMainThreadMaxIterationPerSecond));
                 // Check if the elapsed time is slower than the max iterations per seconds.
                 if (tmElapsedTime.count() < (1.0 / m_nMainThreadMaxIterationPerSecond) * 1000000)
                 {
@@ -633,6 +1688,24 @@ private:
 
             // Call iteration per second tracking tick.
             m_IPS.Tick();
+
+            // Publish telemetry if this thread is registered and enough time has passed.
+            int nTelemetrySlot = m_nTelemetrySlot.load(std::memory_order_acquire);
+            if (nTelemetrySlot >= 0)
+            {
+                std::chrono::steady_clock::time_point tmNow = std::chrono::steady_clock::now();
+                if (tmNow - m_tmLastTelemetryPublish >= m_tmTelemetryPublishInterval)
+                {
+                    this->PublishTelemetry(nTelemetrySlot, tmNow);
+                }
+            }
+        }
+
+        // Publish the stopping state so readers don't see a stale running thread.
+        int nTelemetrySlot = m_nTelemetrySlot.load(std::memory_order_acquire);
+        if (nTelemetrySlot >= 0)
+        {
+            this->PublishTelemetry(nTelemetrySlot, std::chrono::steady_clock::now());
         }
 
         // Notify waiting start method that thread is now stopping.
@@ -1,6 +1,24 @@
 #include "./benchmarks/PrimeNumbersSingleThread.hpp"
 #include "./benchmarks/PrimeNumbersPooled.hpp"
+#include "./benchmarks/PrimeNumbersIndexed.hpp"
+#include "./benchmarks/FalseSharing.hpp"
+#include "./benchmarks/ChannelPipeline.hpp"
+#include "./benchmarks/MailboxSharing.hpp"
+#include "./benchmarks/IdleCost.hpp"
+#include "./benchmarks/IdleSubsystems.hpp"
+#include "./benchmarks/PooledContinuation.hpp"
+#include "./benchmarks/ResultStreaming.hpp"
+#include "./benchmarks/WorkloadSuite.hpp"
+#include "./benchmarks/RoverSystem.hpp"
+#include "./benchmarks/TaskGraphPipeline.hpp"
+#include "./benchmarks/ParallelReduction.hpp"
+#include "./benchmarks/PoolResize.hpp"
+#include "./benchmarks/ScratchAllocation.hpp"
+#include "./benchmarks/ThreadFootprint.hpp"
+#include "./util/BenchmarkBaseline.hpp"
 
+#include <cstring>
+#include <filesystem>
 #include <signal.h>
 #include <thread>
 
@@ -39,13 +57,56 @@ void SignalHandler(int nSignal)
 /******************************************************************************
  * @brief Autonomy main function.
  *
+ * @param argc - The number of arguments.
+ * @param argv - Optional flags. --runs N repeats the repeatable tests N times,
+ *          --save-baseline FILE writes every sample to a baseline file, and
+ *          --compare FILE reports each test as faster, slower, or unchanged against
+ *          a baseline file. Runs defaults to 5 when saving or comparing.
  * @return int - Exit status number.
  *
  * @author ClayJay3 (claytonraycowen@gmail.com)
  * @date 2023-06-20
  ******************************************************************************/
-int main()
+int main(int argc, char *argv[])
 {
+    // Parse arguments.
+    int nRuns = 0;
+    std::string szSaveBaselinePath;
+    std::string szCompareBaselinePath;
+    for (int nArg = 1; nArg < argc; ++nArg)
+    {
+        if (std::strcmp(argv[nArg], "--runs") == 0 && nArg + 1 < argc)
+        {
+            nRuns = std::max(std::atoi(argv[++nArg]), 1);
+        }
+        else if (std::strcmp(argv[nArg], "--save-baseline") == 0 && nArg + 1 < argc)
+        {
+            szSaveBaselinePath = argv[++nArg];
+        }
+        else if (std::strcmp(argv[nArg], "--compare") == 0 && nArg + 1 < argc)
+        {
+            szCompareBaselinePath = argv[++nArg];
+        }
+        else
+        {
+            std::cout << "Usage: " << argv[0] << " [--runs N] [--save-baseline FILE] [--compare FILE]" << std::endl;
+            return 1;
+        }
+    }
+    // One sample per test is enough to read, a comparison needs several.
+    if (nRuns == 0)
+    {
+        nRuns = szSaveBaselinePath.empty() && szCompareBaselinePath.empty() ? 1 : 5;
+    }
+    // Load the baseline first so a bad path fails before anything runs.
+    benchstats::BenchmarkResults stResults;
+    benchstats::BenchmarkResults stBaseline;
+    if (!szCompareBaselinePath.empty() && !stBaseline.Load(szCompareBaselinePath))
+    {
+        std::cout << "Unable to load baseline " << szCompareBaselinePath << "." << std::endl;
+        return 1;
+    }
+
     // Setup signal interrupt handler.
     struct sigaction stSigBreak;
     stSigBreak.sa_handler = SignalHandler;
@@ -54,6 +115,12 @@ int main()
     sigaction(SIGINT, &stSigBreak, nullptr);
     sigaction(SIGQUIT, &stSigBreak, nullptr);
 
+    // Publish thread telemetry where the TelemetryMonitor tool can read it.
+    if (!ThreadRegistry::Instance().OpenSharedMemory())
+    {
+        std::cout << "Thread telemetry is not shared, the shared memory segment couldn't be created or another process owns it." << std::endl;
+    }
+
     // Create instance objects.
     IPS IterPerSecond = IPS();
 
@@ -65,8 +132,8 @@ int main()
     std::cout << "Calculating Pooled Thread Primes..." << std::endl;
     // For calculating average time.
     double dTotalMicroseconds100Runs = 0.0;
-    // Run test 100 times.
-    for (int nIter = 0; nIter < 1; ++nIter)
+    // Run test nRuns times.
+    for (int nIter = 0; nIter < nRuns; ++nIter)
     {
         // Reset member variables for prime calculator.
         PrimeCalculatorTEST2.ClearPrimes();
@@ -76,11 +143,12 @@ int main()
         PrimeCalculatorTEST2.Join();
         // Add time taken to total.
         dTotalMicroseconds100Runs += PrimeCalculatorTEST2.GetCalculationTime();
+        stResults.Record("TEST1 Pooled Thread Primes Calculation Time", PrimeCalculatorTEST2.GetCalculationTime() / 1e6);
     }
     // Print TEST1 info.
-    std::cout << "\nAVERAGE Pooled Thread Primes Calculation Time: " << dTotalMicroseconds100Runs / 1e6 << " s" << std::endl;
+    std::cout << "\nAVERAGE Pooled Thread Primes Calculation Time: " << dTotalMicroseconds100Runs / nRuns / 1e6 << " s" << std::endl;
     // // Print out primes list.
-    // for (int nPrime : PrimeCalculatorTEST2.GetPrimes())
+    // for (uint64_t nPrime : PrimeCalculatorTEST2.GetPrimes())
     // {
     //     std::cout << nPrime << " ";
     // }
@@ -94,14 +162,15 @@ int main()
     std::cout << "Calculating Singlethread Primes..." << std::endl;
     // For calculating average time.
     dTotalMicroseconds100Runs = 0.0;
-    // Run test 100 times.
-    for (int nIter = 0; nIter < 1; ++nIter)
+    // Run test nRuns times.
+    for (int nIter = 0; nIter < nRuns; ++nIter)
     {
         // Run thread.
         PrimeCalculatorTEST1.Start();
         PrimeCalculatorTEST1.Join();
         // Add time taken to total.
         dTotalMicroseconds100Runs += PrimeCalculatorTEST1.GetCalculationTime();
+        stResults.Record("TEST2 Single Thread Primes Calculation Time", PrimeCalculatorTEST1.GetCalculationTime() / 1e6);
         // Reset member variables for prime calculator.
         PrimeCalculatorTEST1.ClearPrimes();
     }
@@ -109,14 +178,673 @@ int main()
     PrimeCalculatorTEST1.Start();
     PrimeCalculatorTEST1.Join();
     // Print TEST1 info.
-    std::cout << "AVERAGE Single Thread Primes Calculation Time: " << dTotalMicroseconds100Runs / 1e6 << " s" << std::endl;
+    std::cout << "AVERAGE Single Thread Primes Calculation Time: " << dTotalMicroseconds100Runs / nRuns / 1e6 << " s" << std::endl;
     // // Print out primes list.
-    // for (int nPrime : PrimeCalculatorTEST1.GetPrimes())
+    // for (uint64_t nPrime : PrimeCalculatorTEST1.GetPrimes())
     // {
     //     std::cout << nPrime << " ";
     // }
     // std::cout << std::endl;
 
+    /////////////////////////////////////////
+    // TEST 3: Packed vs padded counters written by several pool threads.
+    /////////////////////////////////////////
+    FalseSharingBenchmark FalseSharingTEST3 = FalseSharingBenchmark();
+    FalseSharingTEST3.SetWriterCount(4);
+    FalseSharingTEST3.SetIterationsPerWriter(10000000);
+    std::cout << "Measuring False Sharing..." << std::endl;
+    // Run the packed layout first, then the padded layout.
+    for (bool bPadded : {false, true})
+    {
+        // For calculating average time.
+        dTotalMicroseconds100Runs = 0.0;
+        // Run test nRuns times.
+        for (int nIter = 0; nIter < nRuns; ++nIter)
+        {
+            // Run thread.
+            FalseSharingTEST3.SetPadded(bPadded);
+            FalseSharingTEST3.Start();
+            FalseSharingTEST3.Join();
+            // Add time taken to total.
+            dTotalMicroseconds100Runs += FalseSharingTEST3.GetCalculationTime();
+            stResults.Record(std::string("TEST3 ") + (bPadded ? "Padded" : "Packed") + " Counters Time", FalseSharingTEST3.GetCalculationTime() / 1e6);
+        }
+        // Print TEST3 info.
+        std::cout << "AVERAGE " << (bPadded ? "Padded" : "Packed") << " Counters Time: " << dTotalMicroseconds100Runs / nRuns / 1e6 << " s (" << FalseSharingTEST3.GetTotalCount()
+                  << " increments)" << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 4: Camera -> detector -> planner pipeline connected by channels.
+    /////////////////////////////////////////
+    ChannelPipelineBenchmark ChannelPipelineTEST4 = ChannelPipelineBenchmark();
+    ChannelPipelineTEST4.SetCameraCount(2);
+    ChannelPipelineTEST4.SetFramesPerCamera(2000);
+    ChannelPipelineTEST4.SetFrameSize(640 * 480);
+    ChannelPipelineTEST4.SetChannelCapacity(8);
+    std::cout << "Running Channel Pipeline..." << std::endl;
+    // Run the pipeline once for each backpressure policy.
+    for (ChannelPolicy ePolicy : {ChannelPolicy::eBlock, ChannelPolicy::eDropOldest, ChannelPolicy::eDropNewest})
+    {
+        // Run pipeline.
+        ChannelPipelineTEST4.SetPolicy(ePolicy);
+        for (int nIter = 0; nIter < nRuns; ++nIter)
+        {
+            ChannelPipelineTEST4.Run();
+            stResults.Record(std::string("TEST4 ") + (ePolicy == ChannelPolicy::eBlock ? "Block" : (ePolicy == ChannelPolicy::eDropOldest ? "DropOldest" : "DropNewest"))
+                                 + " Pipeline Throughput",
+                             ChannelPipelineTEST4.GetThroughput(),
+                             "frames/s",
+                             false);
+        }
+        // Print TEST4 info.
+        std::cout << (ePolicy == ChannelPolicy::eBlock ? "Block" : (ePolicy == ChannelPolicy::eDropOldest ? "DropOldest" : "DropNewest"))
+                  << " Pipeline Throughput: " << ChannelPipelineTEST4.GetThroughput() << " frames/s, Latency p50/p99/max: " << ChannelPipelineTEST4.GetLatencyPercentile(0.50)
+                  << "/" << ChannelPipelineTEST4.GetLatencyPercentile(0.99) << "/" << ChannelPipelineTEST4.GetLatencyPercentile(1.0) << " us, "
+                  << ChannelPipelineTEST4.GetFramesReceived() << " received, " << ChannelPipelineTEST4.GetFramesDropped() << " dropped" << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 5: Newest frame shared with many readers through a shared mutex vs a latest-value mailbox.
+    /////////////////////////////////////////
+    MailboxSharingBenchmark MailboxSharingTEST5 = MailboxSharingBenchmark();
+    MailboxSharingTEST5.SetReaderCount(4);
+    MailboxSharingTEST5.SetFrameSize(640 * 480 * 3);
+    MailboxSharingTEST5.SetDuration(2.0);
+    std::cout << "Sharing Newest Frame..." << std::endl;
+    // Run the shared mutex first, then the mailbox.
+    for (MailboxSharingBenchmark::SharingMode eMode : {MailboxSharingBenchmark::eSharedMutex, MailboxSharingBenchmark::eMailbox})
+    {
+        // Run thread.
+        MailboxSharingTEST5.SetMode(eMode);
+        MailboxSharingTEST5.ClearResults();
+        MailboxSharingTEST5.Start();
+        MailboxSharingTEST5.Join();
+        // Print TEST5 info.
+        std::cout << (eMode == MailboxSharingBenchmark::eSharedMutex ? "Shared Mutex" : "Mailbox") << " Producer IPS: " << MailboxSharingTEST5.GetProducerIPS()
+                  << ", Reader Staleness avg/max: " << MailboxSharingTEST5.GetAverageStaleness() << "/" << MailboxSharingTEST5.GetMaxStaleness() << " frames, "
+                  << MailboxSharingTEST5.GetTotalReads() << " reads" << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 6: Hundreds of mostly idle subsystems as threads vs coroutines.
+    /////////////////////////////////////////
+    IdleSubsystemsBenchmark IdleSubsystemsTEST6 = IdleSubsystemsBenchmark();
+    IdleSubsystemsTEST6.SetSubsystemCount(200);
+    IdleSubsystemsTEST6.SetWorkerCount(4);
+    IdleSubsystemsTEST6.SetDuration(2.0);
+    std::cout << "Running Idle Subsystems..." << std::endl;
+    // Run as threads first, then as coroutines.
+    for (IdleSubsystemsBenchmark::ExecutionMode eMode : {IdleSubsystemsBenchmark::eThreads, IdleSubsystemsBenchmark::eCoroutines})
+    {
+        // Run subsystems.
+        IdleSubsystemsTEST6.SetMode(eMode);
+        IdleSubsystemsTEST6.Run();
+        // Print TEST6 info.
+        std::cout << (eMode == IdleSubsystemsBenchmark::eThreads ? "Threads" : "Coroutines") << " Peak Thread Count: " << IdleSubsystemsTEST6.GetPeakThreadCount()
+                  << ", Memory Added: " << IdleSubsystemsTEST6.GetMemoryDeltaKB() << " kB, Wake Lateness avg/max: " << IdleSubsystemsTEST6.GetAverageLateness() << "/"
+                  << IdleSubsystemsTEST6.GetMaxLateness() << " us, " << IdleSubsystemsTEST6.GetTotalWakeups() << " wakeups" << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 7: Main loop blocking on pooled batches vs chaining continuations onto them.
+    /////////////////////////////////////////
+    PooledContinuationBenchmark PooledContinuationTEST7 = PooledContinuationBenchmark();
+    PooledContinuationTEST7.SetBatchCount(50);
+    PooledContinuationTEST7.SetTasksPerBatch(8);
+    PooledContinuationTEST7.SetPoolThreads(4);
+    PooledContinuationTEST7.SetMainLoopRate(1000);
+    std::cout << "Running Pooled Batches..." << std::endl;
+    // Run blocking first, then continuations.
+    for (PooledContinuationBenchmark::WaitStyle eStyle : {PooledContinuationBenchmark::eBlocking, PooledContinuationBenchmark::eContinuation})
+    {
+        // Run thread.
+        PooledContinuationTEST7.SetStyle(eStyle);
+        PooledContinuationTEST7.ClearResults();
+        PooledContinuationTEST7.Start();
+        PooledContinuationTEST7.Join();
+        // Print TEST7 info.
+        std::cout << (eStyle == PooledContinuationBenchmark::eBlocking ? "Blocking" : "Continuation") << " Main Loop IPS: " << PooledContinuationTEST7.GetMainLoopIPS()
+                  << ", Total Time: " << PooledContinuationTEST7.GetTotalTime() << " s, Average Batch Latency: " << PooledContinuationTEST7.GetAverageBatchLatency() << " us, "
+                  << PooledContinuationTEST7.GetPrimesFound() << " primes" << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 8: Both prime calculators using the batched SIMD primality kernel.
+    /////////////////////////////////////////
+    std::cout << "Calculating Primes With The " << primality::GetBatchKernelName() << " Batched Kernel..." << std::endl;
+    // The single thread trial division primes from TEST2 are the reference.
+    std::vector<uint64_t> vReferencePrimesTEST8 = PrimeCalculatorTEST1.GetPrimes();
+    PrimeCalculatorTEST2.SetKernel(primality::PrimeTestKernel::eBatched);
+    PrimeCalculatorTEST1.SetKernel(primality::PrimeTestKernel::eBatched);
+    for (int nIter = 0; nIter < nRuns; ++nIter)
+    {
+        // Run pooled calculator.
+        PrimeCalculatorTEST2.ClearPrimes();
+        PrimeCalculatorTEST2.Start();
+        PrimeCalculatorTEST2.Join();
+        // Run single thread calculator.
+        PrimeCalculatorTEST1.ClearPrimes();
+        PrimeCalculatorTEST1.Start();
+        PrimeCalculatorTEST1.Join();
+        stResults.Record("TEST8 Batched Pooled Thread Primes Calculation Time", PrimeCalculatorTEST2.GetCalculationTime() / 1e6);
+        stResults.Record("TEST8 Batched Single Thread Primes Calculation Time", PrimeCalculatorTEST1.GetCalculationTime() / 1e6);
+    }
+    // Print TEST8 info.
+    std::cout << "Batched Pooled Thread Primes Calculation Time: " << PrimeCalculatorTEST2.GetCalculationTime() / 1e6
+              << " s, Matches Trial Division: " << (PrimeCalculatorTEST2.GetPrimes() == vReferencePrimesTEST8 ? "Yes" : "No") << std::endl;
+    std::cout << "Batched Single Thread Primes Calculation Time: " << PrimeCalculatorTEST1.GetCalculationTime() / 1e6
+              << " s, Matches Trial Division: " << (PrimeCalculatorTEST1.GetPrimes() == vReferencePrimesTEST8 ? "Yes" : "No") << std::endl;
+
+    /////////////////////////////////////////
+    // TEST 9: Both prime calculators using Miller-Rabin far past 32 bits.
+    /////////////////////////////////////////
+    std::cout << "Calculating Primes Above 10^15 With Miller-Rabin..." << std::endl;
+    PrimeCalculatorTEST2.SetKernel(primality::PrimeTestKernel::eMillerRabin);
+    PrimeCalculatorTEST2.SetPrimeCount(100000);
+    PrimeCalculatorTEST2.SetPrimeOffset(1000000000000000ULL);
+    PrimeCalculatorTEST1.SetKernel(primality::PrimeTestKernel::eMillerRabin);
+    PrimeCalculatorTEST1.SetPrimeCount(100000);
+    PrimeCalculatorTEST1.SetPrimeOffset(1000000000000000ULL);
+    for (int nIter = 0; nIter < nRuns; ++nIter)
+    {
+        // Run pooled calculator.
+        PrimeCalculatorTEST2.ClearPrimes();
+        PrimeCalculatorTEST2.Start();
+        PrimeCalculatorTEST2.Join();
+        // Run single thread calculator.
+        PrimeCalculatorTEST1.ClearPrimes();
+        PrimeCalculatorTEST1.Start();
+        PrimeCalculatorTEST1.Join();
+        stResults.Record("TEST9 Miller-Rabin Pooled Thread Primes Calculation Time", PrimeCalculatorTEST2.GetCalculationTime() / 1e6);
+        stResults.Record("TEST9 Miller-Rabin Single Thread Primes Calculation Time", PrimeCalculatorTEST1.GetCalculationTime() / 1e6);
+    }
+    // Print TEST9 info.
+    std::cout << "Miller-Rabin Pooled Thread Primes Calculation Time: " << PrimeCalculatorTEST2.GetCalculationTime() / 1e6
+              << " s, Matches Single Thread: " << (PrimeCalculatorTEST2.GetPrimes() == PrimeCalculatorTEST1.GetPrimes() ? "Yes" : "No") << std::endl;
+    std::cout << "Miller-Rabin Single Thread Primes Calculation Time: " << PrimeCalculatorTEST1.GetCalculationTime() / 1e6 << " s" << std::endl;
+
+    /////////////////////////////////////////
+    // TEST 10: Pooled prime calculator backed by a memory-mapped prime store.
+    /////////////////////////////////////////
+    PrimeStore stPrimeStoreTEST10;
+    // Keep the store out of the working directory, it is removed again after the test.
+    std::error_code errTempDirectoryTEST10;
+    std::filesystem::path pathPrimeStoreTEST10 = std::filesystem::temp_directory_path(errTempDirectoryTEST10) / "AutonomyThread_PrimeStore.bin";
+    std::cout << "Calculating Primes With A Persistent Prime Store..." << std::endl;
+    if (!errTempDirectoryTEST10 && stPrimeStoreTEST10.Open(pathPrimeStoreTEST10.string(), 0))
+    {
+        // Attach the store. Anything left over from an interrupted run is reused.
+        std::cout << "Prime Store Loaded With " << stPrimeStoreTEST10.GetCount() << " Primes" << (stPrimeStoreTEST10.WasReset() ? " (Stale File Reset)" : "")
+                  << std::endl;
+        PrimeCalculatorTEST2.SetKernel(primality::PrimeTestKernel::eBatched);
+        PrimeCalculatorTEST2.SetPrimeOffset(0);
+        if (!PrimeCalculatorTEST2.SetPrimeStore(&stPrimeStoreTEST10))
+        {
+            std::cout << "Prime Store Offset Doesn't Match, Computing Without It" << std::endl;
+        }
+        // Grow the count in steps. Each run only computes the new tail, the last run only reads the store.
+        for (int nCount : {500000, 999999, 999999})
+        {
+            PrimeCalculatorTEST2.SetPrimeCount(nCount);
+            PrimeCalculatorTEST2.ClearPrimes();
+            PrimeCalculatorTEST2.Start();
+            PrimeCalculatorTEST2.Join();
+            // Look at the last prime straight out of the mapped file.
+            uint64_t nLastPrime = 0;
+            PrimeCalculatorTEST2.ForEachPrimeChunk([&nLastPrime](std::span<const uint64_t> spChunk) { nLastPrime = spChunk.back(); });
+            // Print TEST10 info.
+            std::cout << "Prime Store Run To " << nCount << " Primes: " << PrimeCalculatorTEST2.GetCalculationTime() / 1e6
+                      << " s, Last Prime: " << nLastPrime << std::endl;
+        }
+        // Detach the store before it goes out of scope, then delete the file.
+        PrimeCalculatorTEST2.SetPrimeStore(nullptr);
+        stPrimeStoreTEST10.Close();
+        std::filesystem::remove(pathPrimeStoreTEST10, errTempDirectoryTEST10);
+    }
+    else
+    {
+        std::cout << "Unable to open " << pathPrimeStoreTEST10 << ", skipping." << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 11: Reading primes while they are calculated, streamed chunks vs repeated copies.
+    /////////////////////////////////////////
+    PrimeStreamConsumer StreamConsumerTEST11 = PrimeStreamConsumer();
+    std::cout << "Measuring Result Consumer Overhead..." << std::endl;
+    PrimeCalculatorTEST1.SetKernel(primality::PrimeTestKernel::eBatched);
+    PrimeCalculatorTEST1.SetPrimeOffset(0);
+    PrimeCalculatorTEST1.SetPrimeCount(999999);
+    // Run with no consumer first, then each consumer mode.
+    for (int nMode : {-1, int(PrimeStreamConsumer::eStreaming), int(PrimeStreamConsumer::eSnapshot)})
+    {
+        // Start the calculator, then the consumer. The consumer starts at the beginning of the stream either way.
+        PrimeCalculatorTEST1.ClearPrimes();
+        PrimeCalculatorTEST1.Start();
+        if (nMode >= 0)
+        {
+            StreamConsumerTEST11.SetMode(PrimeStreamConsumer::ConsumeMode(nMode));
+            StreamConsumerTEST11.SetStream(&PrimeCalculatorTEST1.GetPrimeStream());
+            StreamConsumerTEST11.Start();
+        }
+        // Wait for both to finish.
+        PrimeCalculatorTEST1.Join();
+        StreamConsumerTEST11.Join();
+
+        // Print TEST11 info.
+        if (nMode < 0)
+        {
+            std::cout << "No Consumer Calculation Time: " << PrimeCalculatorTEST1.GetCalculationTime() / 1e6 << " s" << std::endl;
+        }
+        else
+        {
+            std::cout << (nMode == PrimeStreamConsumer::eStreaming ? "Streaming" : "Snapshot") << " Consumer Calculation Time: " << PrimeCalculatorTEST1.GetCalculationTime() / 1e6
+                      << " s, Primes Read: " << StreamConsumerTEST11.GetPrimesRead() << ", Reads: " << StreamConsumerTEST11.GetChunksRead()
+                      << ", MB Copied: " << StreamConsumerTEST11.GetBytesCopied() / 1e6 << ", Checksum: " << StreamConsumerTEST11.GetChecksum() << std::endl;
+        }
+    }
+
+    /////////////////////////////////////////
+    // TEST 12: Ordered vs unordered pooled trial division, checked against the single thread calculator.
+    /////////////////////////////////////////
+    std::cout << "Measuring The Cost Of Ordered Pooled Output..." << std::endl;
+    // Get the reference primes from the single thread calculator.
+    PrimeCalculatorTEST1.SetKernel(primality::PrimeTestKernel::eBatched);
+    PrimeCalculatorTEST1.SetPrimeOffset(0);
+    PrimeCalculatorTEST1.SetPrimeCount(200000);
+    PrimeCalculatorTEST1.Start();
+    PrimeCalculatorTEST1.Join();
+    std::vector<uint64_t> vReferencePrimesTEST12 = PrimeCalculatorTEST1.GetPrimes();
+    // Run the pooled calculator with ordered output, then unordered output followed by a sort.
+    PrimeCalculatorTEST2.SetKernel(primality::PrimeTestKernel::eTrialDivision);
+    PrimeCalculatorTEST2.SetPrimeOffset(0);
+    PrimeCalculatorTEST2.SetPrimeCount(200000);
+    for (bool bOrdered : {true, false})
+    {
+        // Run thread.
+        PrimeCalculatorTEST2.SetOrderedOutput(bOrdered);
+        PrimeCalculatorTEST2.ClearPrimes();
+        PrimeCalculatorTEST2.Start();
+        PrimeCalculatorTEST2.Join();
+        // Unordered output has to be sorted before it can be compared.
+        std::chrono::system_clock::time_point tmSortStart = std::chrono::system_clock::now();
+        std::vector<uint64_t> vPrimes = PrimeCalculatorTEST2.GetPrimes();
+        if (!bOrdered)
+        {
+            std::sort(vPrimes.begin(), vPrimes.end());
+        }
+        double dSortTime = std::chrono::duration<double>(std::chrono::system_clock::now() - tmSortStart).count();
+        // Print TEST12 info.
+        std::cout << (bOrdered ? "Ordered" : "Unordered") << " Pooled Calculation Time: " << PrimeCalculatorTEST2.GetCalculationTime() / 1e6 << " s, "
+                  << (bOrdered ? "Prefix Sum And Scatter Time: " : "Copy And Sort Time: ") << (bOrdered ? PrimeCalculatorTEST2.GetOrderingTime() / 1e6 : dSortTime)
+                  << " s, Matches Single Thread: " << (vPrimes == vReferencePrimesTEST12 ? "Yes" : "No") << std::endl;
+    }
+    PrimeCalculatorTEST2.SetOrderedOutput(true);
+
+    /////////////////////////////////////////
+    // TEST 13: Scaling of memory, latency, compute, branch and wait bound workloads.
+    /////////////////////////////////////////
+    WorkloadBenchmark WorkloadTEST13 = WorkloadBenchmark();
+    std::cout << "Running Workload Suite..." << std::endl;
+    for (WorkloadBenchmark::WorkloadKernel eKernel : {WorkloadBenchmark::eMemoryStream,
+                                                      WorkloadBenchmark::ePointerChase,
+                                                      WorkloadBenchmark::eConvolution,
+                                                      WorkloadBenchmark::eParsing,
+                                                      WorkloadBenchmark::eSleepIO})
+    {
+        // Run every thread count on the same input, speedup is against one thread.
+        WorkloadTEST13.SetKernel(eKernel);
+        double dSingleThreadTime = 0.0;
+        uint64_t nSingleThreadChecksum = 0;
+        for (int nThreads : {1, 2, 4, 8})
+        {
+            // Run thread.
+            WorkloadTEST13.SetThreads(nThreads);
+            for (int nIter = 0; nIter < nRuns; ++nIter)
+            {
+                WorkloadTEST13.Start();
+                WorkloadTEST13.Join();
+                stResults.Record("TEST13 " + std::string(WorkloadBenchmark::GetKernelName(eKernel)) + " (" + std::to_string(nThreads) + " Threads) Time",
+                                 WorkloadTEST13.GetCalculationTime());
+            }
+            if (nThreads == 1)
+            {
+                dSingleThreadTime = WorkloadTEST13.GetCalculationTime();
+                nSingleThreadChecksum = WorkloadTEST13.GetChecksum();
+            }
+            // Print TEST13 info.
+            std::cout << WorkloadBenchmark::GetKernelName(eKernel) << " (" << nThreads << " Threads) Time: " << WorkloadTEST13.GetCalculationTime()
+                      << " s, Throughput: " << WorkloadTEST13.GetThroughput() << " " << WorkloadBenchmark::GetThroughputUnit(eKernel)
+                      << ", Speedup: " << dSingleThreadTime / WorkloadTEST13.GetCalculationTime()
+                      << "x, Checksum Matches: " << (WorkloadTEST13.GetChecksum() == nSingleThreadChecksum ? "Yes" : "No") << std::endl;
+        }
+    }
+
+    /////////////////////////////////////////
+    // TEST 14: Rover-like subsystems at different rates sharing the machine.
+    /////////////////////////////////////////
+    RoverSystemBenchmark RoverSystemTEST14 = RoverSystemBenchmark();
+    // Name, rate Hz, work us, burst every N iterations, burst tasks, burst threads, burst task work us.
+    RoverSystemTEST14.AddSubsystem({"Drive", 100, 500, 0, 0, 0, 0});
+    RoverSystemTEST14.AddSubsystem({"Camera0", 30, 3000, 0, 0, 0, 0});
+    RoverSystemTEST14.AddSubsystem({"Camera1", 30, 3000, 0, 0, 0, 0});
+    RoverSystemTEST14.AddSubsystem({"Detector", 15, 2000, 1, 4, 4, 4000});
+    RoverSystemTEST14.AddSubsystem({"Navigation", 10, 15000, 0, 0, 0, 0});
+    RoverSystemTEST14.AddSubsystem({"Telemetry", 5, 200, 0, 0, 0, 0});
+    RoverSystemTEST14.SetDuration(3.0);
+    std::cout << "Running Rover System..." << std::endl;
+    // Run all subsystems together. They publish telemetry while they run.
+    RoverSystemTEST14.Run();
+    // Print TEST14 info.
+    for (const RoverSubsystemResult &stResult : RoverSystemTEST14.GetResults())
+    {
+        std::cout << stResult.szName << " (" << stResult.nRateHz << " Hz) Achieved IPS: " << stResult.dAchievedIPS << ", Jitter: " << stResult.dJitterMicroseconds
+                  << " us, Worst Latency: " << stResult.dWorstLatency << " us, Deadline Misses: " << stResult.nDeadlineMisses << "/" << stResult.nIterations
+                  << ", Overruns: " << stResult.nOverruns << ", Worst Overrun: " << stResult.dWorstOverrun << " us, Budget Histogram:";
+        // Print iterations per share of the budget used.
+        for (size_t nBucket = 0; nBucket < stResult.aBudgetHistogram.size(); ++nBucket)
+        {
+            std::cout << (nBucket < AutonomyThread<void>::aBudgetHistogramEdges.size() ? " <" + std::to_string(AutonomyThread<void>::aBudgetHistogramEdges[nBucket]) : " >=" + std::to_string(AutonomyThread<void>::aBudgetHistogramEdges.back()))
+                      << "%:" << stResult.aBudgetHistogram[nBucket];
+        }
+        std::cout << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 15: Multi-stage per camera pipeline with a barrier per stage vs a task graph.
+    /////////////////////////////////////////
+    TaskGraphPipelineBenchmark TaskGraphPipelineTEST15 = TaskGraphPipelineBenchmark();
+    TaskGraphPipelineTEST15.SetCameraCount(4);
+    TaskGraphPipelineTEST15.SetFrameCount(200);
+    TaskGraphPipelineTEST15.SetPoolThreads(4);
+    std::cout << "Running Multi-Stage Camera Pipeline..." << std::endl;
+    // Run with barriers first, then the task graph.
+    uint64_t nBarrierChecksumTEST15 = 0;
+    for (TaskGraphPipelineBenchmark::ScheduleMode eMode : {TaskGraphPipelineBenchmark::eBarriers, TaskGraphPipelineBenchmark::eTaskGraph})
+    {
+        const char *szModeName = eMode == TaskGraphPipelineBenchmark::eBarriers ? "Barrier" : "Task Graph";
+        TaskGraphPipelineTEST15.SetMode(eMode);
+        for (int nIter = 0; nIter < nRuns; ++nIter)
+        {
+            // Run thread.
+            TaskGraphPipelineTEST15.Start();
+            TaskGraphPipelineTEST15.Join();
+            stResults.Record("TEST15 " + std::string(szModeName) + " Pipeline Throughput", TaskGraphPipelineTEST15.GetFramesPerSecond(), "frames/s", false);
+        }
+        if (eMode == TaskGraphPipelineBenchmark::eBarriers)
+        {
+            nBarrierChecksumTEST15 = TaskGraphPipelineTEST15.GetChecksum();
+        }
+        // Print TEST15 info.
+        std::cout << szModeName << " Pipeline Time: " << TaskGraphPipelineTEST15.GetTotalTime() << " s, Throughput: " << TaskGraphPipelineTEST15.GetFramesPerSecond()
+                  << " frames/s, Checksum Matches: " << (TaskGraphPipelineTEST15.GetChecksum() == nBarrierChecksumTEST15 ? "Yes" : "No") << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 16: Sums and prefix sums with per block accumulators vs a mutex and the standard parallel algorithms.
+    /////////////////////////////////////////
+    ParallelReductionBenchmark ParallelReductionTEST16 = ParallelReductionBenchmark();
+    ParallelReductionTEST16.SetThreads(4);
+    std::cout << "Running Parallel Reductions And Scans..." << std::endl;
+    // The reductions must agree with each other, and so must the scans.
+    uint64_t nReferenceResultTEST16 = 0;
+    for (ParallelReductionBenchmark::ReductionMethod eMethod : {ParallelReductionBenchmark::eMutexReduce,
+                                                                ParallelReductionBenchmark::eParallelReduce,
+                                                                ParallelReductionBenchmark::eStdReduce,
+                                                                ParallelReductionBenchmark::eSequentialScan,
+                                                                ParallelReductionBenchmark::eParallelScan,
+                                                                ParallelReductionBenchmark::eStdScan})
+    {
+        ParallelReductionTEST16.SetMethod(eMethod);
+        for (int nIter = 0; nIter < nRuns; ++nIter)
+        {
+            // Run thread.
+            ParallelReductionTEST16.Start();
+            ParallelReductionTEST16.Join();
+            stResults.Record("TEST16 " + std::string(ParallelReductionBenchmark::GetMethodName(eMethod)) + " Time", ParallelReductionTEST16.GetCalculationTime());
+        }
+        if (eMethod == ParallelReductionBenchmark::eMutexReduce || eMethod == ParallelReductionBenchmark::eSequentialScan)
+        {
+            nReferenceResultTEST16 = ParallelReductionTEST16.GetResult();
+        }
+        // Print TEST16 info.
+        std::cout << ParallelReductionBenchmark::GetMethodName(eMethod) << " Time: " << ParallelReductionTEST16.GetCalculationTime()
+                  << " s, Result Matches: " << (ParallelReductionTEST16.GetResult() == nReferenceResultTEST16 ? "Yes" : "No") << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 17: Pooled trial division claiming numbers from a shared counter vs tasks handed their own range.
+    /////////////////////////////////////////
+    PrimeCalculatorThreadIndexed PrimeCalculatorTEST17 = PrimeCalculatorThreadIndexed();
+    PrimeCalculatorTEST17.SetPrimeCount(200000);
+    std::cout << "Calculating Primes With Shared State vs Indexed Tasks..." << std::endl;
+    PrimeCalculatorTEST2.SetKernel(primality::PrimeTestKernel::eTrialDivision);
+    PrimeCalculatorTEST2.SetPrimeOffset(0);
+    PrimeCalculatorTEST2.SetPrimeCount(200000);
+    PrimeCalculatorTEST2.SetOrderedOutput(false);
+    for (int nIter = 0; nIter < nRuns; ++nIter)
+    {
+        // Run the shared counter calculator.
+        PrimeCalculatorTEST2.ClearPrimes();
+        PrimeCalculatorTEST2.Start();
+        PrimeCalculatorTEST2.Join();
+        // Run the indexed calculator.
+        PrimeCalculatorTEST17.Start();
+        PrimeCalculatorTEST17.Join();
+        stResults.Record("TEST17 Shared Counter Pooled Primes Calculation Time", PrimeCalculatorTEST2.GetCalculationTime() / 1e6);
+        stResults.Record("TEST17 Indexed Pooled Primes Calculation Time", PrimeCalculatorTEST17.GetCalculationTime() / 1e6);
+    }
+    PrimeCalculatorTEST2.SetOrderedOutput(true);
+    // Print TEST17 info.
+    std::vector<uint64_t> vSharedPrimesTEST17 = PrimeCalculatorTEST2.GetPrimes();
+    std::sort(vSharedPrimesTEST17.begin(), vSharedPrimesTEST17.end());
+    std::cout << "Shared Counter Pooled Primes Calculation Time: " << PrimeCalculatorTEST2.GetCalculationTime() / 1e6
+              << " s, Matches Single Thread: " << (vSharedPrimesTEST17 == vReferencePrimesTEST12 ? "Yes" : "No") << std::endl;
+    std::cout << "Indexed Pooled Primes Calculation Time: " << PrimeCalculatorTEST17.GetCalculationTime() / 1e6
+              << " s, Matches Single Thread: " << (PrimeCalculatorTEST17.GetPrimes() == vReferencePrimesTEST12 ? "Yes" : "No") << std::endl;
+
+    /////////////////////////////////////////
+    // TEST 18: Short lived buffers on many pool threads from the heap vs each thread's scratch arena.
+    /////////////////////////////////////////
+    ScratchAllocationBenchmark ScratchAllocationTEST18 = ScratchAllocationBenchmark();
+    ScratchAllocationTEST18.SetFrameCount(100);
+    ScratchAllocationTEST18.SetTasksPerFrame(64);
+    ScratchAllocationTEST18.SetPoolThreads(8);
+    std::cout << "Running Scratch Allocation Churn..." << std::endl;
+    // Run from the heap first, then from the arena.
+    uint64_t nHeapChecksumTEST18 = 0;
+    for (ScratchAllocationBenchmark::AllocationMode eMode : {ScratchAllocationBenchmark::eHeap, ScratchAllocationBenchmark::eArena})
+    {
+        const char *szModeName = eMode == ScratchAllocationBenchmark::eHeap ? "Heap" : "Scratch Arena";
+        ScratchAllocationTEST18.SetMode(eMode);
+        for (int nIter = 0; nIter < nRuns; ++nIter)
+        {
+            // Run thread.
+            ScratchAllocationTEST18.Start();
+            ScratchAllocationTEST18.Join();
+            stResults.Record("TEST18 " + std::string(szModeName) + " Buffer Throughput", ScratchAllocationTEST18.GetBuffersPerSecond(), "buffers/s", false);
+        }
+        if (eMode == ScratchAllocationBenchmark::eHeap)
+        {
+            nHeapChecksumTEST18 = ScratchAllocationTEST18.GetChecksum();
+        }
+        // Print TEST18 info.
+        std::cout << szModeName << " Allocation Time: " << ScratchAllocationTEST18.GetTotalTime() << " s, Throughput: " << ScratchAllocationTEST18.GetBuffersPerSecond()
+                  << " buffers/s, Checksum Matches: " << (ScratchAllocationTEST18.GetChecksum() == nHeapChecksumTEST18 ? "Yes" : "No") << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 19: Memory and creation time of idle AutonomyThreads with the default stack size vs a small one.
+    /////////////////////////////////////////
+    ThreadFootprintBenchmark ThreadFootprintTEST19 = ThreadFootprintBenchmark();
+    std::cout << "Running Thread Footprint... (default stack size " << threadstack::GetDefaultStackSize() / 1024 << " kB)" << std::endl;
+    for (size_t nStackSize : {size_t(0), size_t(256 * 1024)})
+    {
+        ThreadFootprintTEST19.SetStackSize(nStackSize);
+        for (int nInstances : {8, 32})
+        {
+            for (int nPoolThreads : {4, 16})
+            {
+                ThreadFootprintTEST19.SetInstanceCount(nInstances);
+                ThreadFootprintTEST19.SetPoolThreads(nPoolThreads);
+                std::string szCase = std::string(nStackSize == 0 ? "Default" : "256 kB") + " Stack " + std::to_string(nInstances) + "x" + std::to_string(nPoolThreads);
+                for (int nIter = 0; nIter < nRuns; ++nIter)
+                {
+                    // Run benchmark.
+                    ThreadFootprintTEST19.Run();
+                    stResults.Record("TEST19 " + szCase + " Creation Time Per Thread", ThreadFootprintTEST19.GetCreationTimePerThread(), "us");
+                }
+                // Print TEST19 info.
+                std::cout << szCase << " Threads: " << ThreadFootprintTEST19.GetThreadsAdded() << ", RSS: " << ThreadFootprintTEST19.GetResidentDeltaKB()
+                          << " kB, Virtual: " << ThreadFootprintTEST19.GetVirtualDeltaKB() << " kB, Page Tables: " << ThreadFootprintTEST19.GetPageTableDeltaKB()
+                          << " kB, Creation: " << ThreadFootprintTEST19.GetCreationTimePerThread() << " us/thread" << std::endl;
+            }
+        }
+    }
+
+    /////////////////////////////////////////
+    // TEST 20: CPU time and context switches of idle AutonomyThreads that are stopped, rate limited, or holding an idle pool.
+    /////////////////////////////////////////
+    IdleCostBenchmark IdleCostTEST20 = IdleCostBenchmark();
+    IdleCostTEST20.SetInstanceCount(50);
+    IdleCostTEST20.SetRate(20);
+    IdleCostTEST20.SetPoolThreads(4);
+    IdleCostTEST20.SetDuration(1.0);
+    std::cout << "Running Idle Cost..." << std::endl;
+    for (IdleCostBenchmark::IdleState eState : {IdleCostBenchmark::eStopped, IdleCostBenchmark::eRateLimited, IdleCostBenchmark::ePoolIdle})
+    {
+        IdleCostTEST20.SetState(eState);
+        std::string szStateName = IdleCostBenchmark::GetStateName(eState);
+        for (int nIter = 0; nIter < nRuns; ++nIter)
+        {
+            // Run benchmark.
+            IdleCostTEST20.Run();
+            stResults.Record("TEST20 " + szStateName + " CPU Time Per Second", IdleCostTEST20.GetCpuSecondsPerSecond(), "s/s");
+            stResults.Record("TEST20 " + szStateName + " Context Switches Per Second",
+                             IdleCostTEST20.GetVoluntaryPerSecond() + IdleCostTEST20.GetInvoluntaryPerSecond(),
+                             "switches/s");
+        }
+        // Print TEST20 info.
+        std::cout << szStateName << " Threads: " << IdleCostTEST20.GetThreadCount() << ", CPU: " << IdleCostTEST20.GetCpuSecondsPerSecond() * 1000.0
+                  << " ms/s, Voluntary Switches: " << IdleCostTEST20.GetVoluntaryPerSecond() << "/s, Involuntary Switches: " << IdleCostTEST20.GetInvoluntaryPerSecond()
+                  << "/s" << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 21: Switching the pool between 2 and 8 threads under load by rebuilding it vs resizing it live.
+    /////////////////////////////////////////
+    PoolResizeBenchmark PoolResizeTEST21 = PoolResizeBenchmark();
+    PoolResizeTEST21.SetIterationCount(100);
+    PoolResizeTEST21.SetTasksPerIteration(16);
+    PoolResizeTEST21.SetPoolSizes(2, 8);
+    std::cout << "Running Pool Resize Under Load..." << std::endl;
+    for (PoolResizeBenchmark::ResizeMode eMode : {PoolResizeBenchmark::eRebuild, PoolResizeBenchmark::eLiveResize})
+    {
+        const char *szModeName = eMode == PoolResizeBenchmark::eRebuild ? "Rebuild" : "Live Resize";
+        PoolResizeTEST21.SetMode(eMode);
+        // Longer tasks should only slow down the rebuild.
+        for (int nTaskWork : {20000, 200000})
+        {
+            PoolResizeTEST21.SetTaskWork(nTaskWork);
+            std::string szCase = std::string(szModeName) + " " + std::to_string(nTaskWork / 1000) + "k Work";
+            for (int nIter = 0; nIter < nRuns; ++nIter)
+            {
+                // Run thread.
+                PoolResizeTEST21.Start();
+                PoolResizeTEST21.Join();
+                stResults.Record("TEST21 " + szCase + " Average Resize Time", PoolResizeTEST21.GetAverageResizeTime());
+                stResults.Record("TEST21 " + szCase + " Throughput", PoolResizeTEST21.GetTasksPerSecond(), "tasks/s", false);
+            }
+            // Print TEST21 info.
+            std::cout << szCase << " Resize avg/max: " << PoolResizeTEST21.GetAverageResizeTime() * 1e6 << "/" << PoolResizeTEST21.GetMaxResizeTime() * 1e6
+                      << " us, Tasks Lost: " << PoolResizeTEST21.GetTasksLost() << ", Throughput: " << PoolResizeTEST21.GetTasksPerSecond() << " tasks/s" << std::endl;
+        }
+    }
+
+    /////////////////////////////////////////
+    // TEST 22: Pooled trial division with an unbounded pool queue vs a small bounded one that blocks, rejects or runs tasks on the caller.
+    /////////////////////////////////////////
+    std::cout << "Calculating Primes With Bounded Pool Queues..." << std::endl;
+    PrimeCalculatorTEST2.SetKernel(primality::PrimeTestKernel::eTrialDivision);
+    PrimeCalculatorTEST2.SetPrimeCount(200000);
+    struct QueuePolicyCase
+    {
+        const char *szName;
+        size_t nCapacity;
+        ElasticThreadPool::QueueFullPolicy ePolicy;
+    };
+    // The unordered engine queues one task per prime, the ordered one 256 blocks per round. Both overflow 16.
+    for (bool bOrdered : {false, true})
+    {
+        PrimeCalculatorTEST2.SetOrderedOutput(bOrdered);
+        for (const QueuePolicyCase &stCase : {QueuePolicyCase{"Unbounded", 0, ElasticThreadPool::eBlock},
+                                              QueuePolicyCase{"Block", 16, ElasticThreadPool::eBlock},
+                                              QueuePolicyCase{"Reject", 16, ElasticThreadPool::eReject},
+                                              QueuePolicyCase{"Caller Runs", 16, ElasticThreadPool::eCallerRuns}})
+        {
+            PrimeCalculatorTEST2.SetQueueCapacity(stCase.nCapacity, stCase.ePolicy);
+            std::string szCaseName = std::string(bOrdered ? "Ordered " : "Unordered ") + stCase.szName;
+            long nPeakGrowthKB = 0;
+            for (int nIter = 0; nIter < nRuns; ++nIter)
+            {
+                // Measure peak memory from here, the primes of the last run are freed first.
+                PrimeCalculatorTEST2.ClearPrimes();
+                procstats::ResetPeakResidentMemory();
+                long nBaseResidentKB = procstats::GetResidentMemoryKB();
+                // Run thread.
+                PrimeCalculatorTEST2.Start();
+                PrimeCalculatorTEST2.Join();
+                nPeakGrowthKB = procstats::GetPeakResidentMemoryKB() - nBaseResidentKB;
+                stResults.Record("TEST22 " + szCaseName + " Queue Primes Calculation Time", PrimeCalculatorTEST2.GetCalculationTime() / 1e6);
+                stResults.Record("TEST22 " + szCaseName + " Queue Peak Memory Growth", double(nPeakGrowthKB), "kB");
+            }
+            // Print TEST22 info.
+            std::vector<uint64_t> vPrimesTEST22 = PrimeCalculatorTEST2.GetPrimes();
+            std::sort(vPrimesTEST22.begin(), vPrimesTEST22.end());
+            double dCalculationTime = PrimeCalculatorTEST2.GetCalculationTime() / 1e6;
+            std::cout << szCaseName << " Queue Time: " << dCalculationTime << " s (" << (dCalculationTime > 0.0 ? vPrimesTEST22.size() / dCalculationTime : 0.0)
+                      << " primes/s), Peak Memory Growth: " << nPeakGrowthKB << " kB, Peak Queue: " << PrimeCalculatorTEST2.GetPeakQueueLength()
+                      << ", Rejected: " << PrimeCalculatorTEST2.GetRejectedTaskCount() << ", Caller Ran: " << PrimeCalculatorTEST2.GetCallerRunTaskCount()
+                      << ", Matches Single Thread: " << (vPrimesTEST22 == vReferencePrimesTEST12 ? "Yes" : "No") << std::endl;
+        }
+    }
+    PrimeCalculatorTEST2.SetQueueCapacity(0);
+    PrimeCalculatorTEST2.SetOrderedOutput(true);
+
+    /////////////////////////////////////////
+    // Baseline.
+    /////////////////////////////////////////
+    if (!szSaveBaselinePath.empty())
+    {
+        std::cout << (stResults.Save(szSaveBaselinePath) ? "Saved " : "Unable to save ") << stResults.GetMetricCount() << " metrics to baseline "
+                  << szSaveBaselinePath << "." << std::endl;
+    }
+    if (!szCompareBaselinePath.empty())
+    {
+        // Results from another machine or build aren't comparable, but still report them.
+        if (!(stBaseline.GetFingerprint() == stResults.GetFingerprint()))
+        {
+            std::cout << "WARNING: Baseline was recorded on a different machine or build (" << stBaseline.GetFingerprint().szCPUModel << ", "
+                      << stBaseline.GetFingerprint().szCompiler << ", " << stBaseline.GetFingerprint().szCompileFlags << ")." << std::endl;
+        }
+        // With 3 samples on each side the smallest possible p-value is 0.1.
+        if (nRuns < 4)
+        {
+            std::cout << "WARNING: Fewer than 4 runs can't show a significant change, use --runs 5 or more." << std::endl;
+        }
+        // Print one line per metric.
+        std::cout << "Comparison Against " << szCompareBaselinePath << ":" << std::endl;
+        for (const benchstats::BenchmarkComparison &stComparison : stResults.Compare(stBaseline))
+        {
+            static const char *aVerdictNames[] = {"FASTER", "SLOWER", "unchanged", "not in baseline"};
+            std::cout << aVerdictNames[stComparison.eVerdict] << ": " << stComparison.szName << ", Median: " << stComparison.dBaselineMedian << " -> "
+                      << stComparison.dCurrentMedian << " " << stComparison.szUnit << " (" << (stComparison.dChangePercent > 0.0 ? "+" : "")
+                      << stComparison.dChangePercent << "%), p: " << stComparison.stTest.dPValue << (stComparison.stTest.bExact ? " exact" : "")
+                      << ", Effect: " << stComparison.stTest.dEffectSize << ", Samples: " << stComparison.nBaselineSamples << "/" << stComparison.nCurrentSamples
+                      << std::endl;
+        }
+    }
+
     /////////////////////////////////////////
     // Cleanup.
     /////////////////////////////////////////
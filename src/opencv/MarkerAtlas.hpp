@@ -0,0 +1,519 @@
+/******************************************************************************
+ * @brief Defines and implements a single contiguous block of rendered marker
+ *      images with an index, kept in memory or mapped straight from a raw file.
+ *
+ * @file MarkerAtlas.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef MARKER_ATLAS_HPP
+#define MARKER_ATLAS_HPP
+
+/// \cond
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The header at the start of every atlas. The index of marker entries
+ *      follows it, then the pixel data starting on a page boundary.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct MarkerAtlasHeader
+{
+    uint64_t nMagic;         // Always MarkerAtlas::nMagic.
+    uint32_t nVersion;       // File format version.
+    uint32_t nIndexStart;    // Byte offset of the first index entry.
+    uint64_t nDataStart;     // Byte offset of the first marker's pixels.
+    uint64_t nCount;         // Number of markers.
+    uint32_t nMarkerSize;    // Width and height of every marker in pixels.
+    uint32_t nReserved;      // Padding, always zero.
+};
+
+/******************************************************************************
+ * @brief One index entry, identifying the marker stored in the matching cell.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct MarkerAtlasEntry
+{
+    int32_t nDictionary;    // cv::aruco::PredefinedDictionaryType.
+    int32_t nMarkerID;      // The marker's ID in that dictionary.
+};
+
+/******************************************************************************
+ * @brief Fixed size 8-bit grayscale marker images packed back to back, with an
+ *      index saying which marker is in each cell. The same layout is used in
+ *      memory and on disk, so a whole set of markers is saved with one write and
+ *      loaded with one mapping instead of a PNG decode per marker.
+ *
+ *      Cells can be written from several threads at once as long as each thread
+ *      writes different cells. Everything else is not thread safe.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class MarkerAtlas
+{
+public:
+    // Declare public constants.
+    static constexpr uint64_t nMagic = 0x53414c5441524b4d;    // "MKRATLAS" read little endian.
+    static constexpr uint32_t nVersion = 1;
+    static constexpr uint32_t nIndexStart = 64;
+    static constexpr uint64_t nPageSize = 4096;
+
+    // Declare and define public class methods.
+    MarkerAtlas() = default;
+    ~MarkerAtlas() { this->Close(); }
+    MarkerAtlas(const MarkerAtlas &) = delete;
+    MarkerAtlas &operator=(const MarkerAtlas &) = delete;
+
+    /******************************************************************************
+     * @brief Creates an empty atlas in memory. Every cell starts white.
+     *
+     * @param nCount - The number of markers.
+     * @param nMarkerSize - The width and height of every marker in pixels.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Allocate(uint64_t nCount, uint32_t nMarkerSize)
+    {
+        // Close anything already open.
+        this->Close();
+
+        // Size the buffer and write the header.
+        m_vMemory.assign(TotalSize(nCount, nMarkerSize), 255);
+        m_pBase = m_vMemory.data();
+        m_nSize = m_vMemory.size();
+        this->WriteHeader(nCount, nMarkerSize);
+    }
+
+    /******************************************************************************
+     * @brief Creates an empty atlas file and maps it writable, so markers are
+     *      rendered straight into the page cache. Overwrites an existing file.
+     *      Unlike Allocate(), cells start black instead of white.
+     *
+     * @param szPath - The path to the atlas file.
+     * @param nCount - The number of markers.
+     * @param nMarkerSize - The width and height of every marker in pixels.
+     * @return true - The file was created and mapped.
+     * @return false - The file couldn't be created, sized or mapped.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Create(const std::string &szPath, uint64_t nCount, uint32_t nMarkerSize)
+    {
+        // Close anything already open.
+        this->Close();
+
+        // Create the file at its final size.
+        size_t nSize = TotalSize(nCount, nMarkerSize);
+        m_nFileDescriptor = ::open(szPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (m_nFileDescriptor < 0 || ::ftruncate(m_nFileDescriptor, off_t(nSize)) != 0 || !this->Map(nSize, PROT_READ | PROT_WRITE))
+        {
+            this->Close();
+            return false;
+        }
+
+        // The cells are left as they are, every one is expected to be rendered.
+        this->WriteHeader(nCount, nMarkerSize);
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Maps an existing atlas file read only. This is how tests load a set
+     *      of markers, nothing is decoded or copied until a cell is touched.
+     *
+     * @param szPath - The path to the atlas file.
+     * @return true - The file was mapped and its header matches its size.
+     * @return false - The file couldn't be opened or isn't a valid atlas.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Open(const std::string &szPath)
+    {
+        // Close anything already open.
+        this->Close();
+
+        // Open and map the whole file.
+        struct stat stFileInfo;
+        m_nFileDescriptor = ::open(szPath.c_str(), O_RDONLY);
+        if (m_nFileDescriptor < 0 || ::fstat(m_nFileDescriptor, &stFileInfo) != 0 || size_t(stFileInfo.st_size) < sizeof(MarkerAtlasHeader) ||
+            !this->Map(size_t(stFileInfo.st_size), PROT_READ))
+        {
+            this->Close();
+            return false;
+        }
+
+        // Check the header describes this file.
+        const MarkerAtlasHeader *pHeader = this->GetHeader();
+        if (pHeader->nMagic != nMagic || pHeader->nVersion != nVersion || pHeader->nIndexStart != nIndexStart ||
+            pHeader->nDataStart != DataStart(pHeader->nCount) || m_nSize != TotalSize(pHeader->nCount, pHeader->nMarkerSize))
+        {
+            this->Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Unmaps a mapped atlas or frees an allocated one. Call Flush() first
+     *      if a created file has to be on disk before this returns.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Close()
+    {
+        // Unmap the file.
+        if (m_pMapping != nullptr)
+        {
+            ::munmap(m_pMapping, m_nSize);
+            m_pMapping = nullptr;
+        }
+        // Close the file.
+        if (m_nFileDescriptor >= 0)
+        {
+            ::close(m_nFileDescriptor);
+            m_nFileDescriptor = -1;
+        }
+        // Free the memory.
+        m_vMemory.clear();
+        m_vMemory.shrink_to_fit();
+        m_pBase = nullptr;
+        m_nSize = 0;
+    }
+
+    /******************************************************************************
+     * @brief Writes a mapped atlas back to its file.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Flush()
+    {
+        if (m_pMapping != nullptr)
+        {
+            ::msync(m_pMapping, m_nSize, MS_SYNC);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Saves the atlas to a raw file that Open() can map, in a single write.
+     *
+     * @param szPath - The path to the atlas file.
+     * @return true - The file was written.
+     * @return false - Nothing is open or the file couldn't be written.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Save(const std::string &szPath) const
+    {
+        // Check if there is anything to save.
+        if (m_pBase == nullptr)
+        {
+            return false;
+        }
+
+        // Write everything in as few calls as the kernel allows.
+        int nFileDescriptor = ::open(szPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (nFileDescriptor < 0)
+        {
+            return false;
+        }
+        size_t nWritten = 0;
+        while (nWritten < m_nSize)
+        {
+            ssize_t nResult = ::write(nFileDescriptor, m_pBase + nWritten, m_nSize - nWritten);
+            if (nResult <= 0)
+            {
+                break;
+            }
+            nWritten += size_t(nResult);
+        }
+        ::close(nFileDescriptor);
+
+        return nWritten == m_nSize;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for an index entry.
+     *
+     * @param nCell - The cell the marker is stored in.
+     * @param nDictionary - The marker's predefined dictionary.
+     * @param nMarkerID - The marker's ID.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetEntry(uint64_t nCell, int nDictionary, int nMarkerID) { this->GetIndexData()[nCell] = {int32_t(nDictionary), int32_t(nMarkerID)}; }
+
+    /******************************************************************************
+     * @brief Accessor for the index.
+     *
+     * @return std::span<const MarkerAtlasEntry> - One entry per cell, in cell order.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    std::span<const MarkerAtlasEntry> GetIndex() const
+    {
+        if (m_pBase == nullptr)
+        {
+            return {};
+        }
+        return std::span<const MarkerAtlasEntry>(reinterpret_cast<const MarkerAtlasEntry *>(m_pBase + nIndexStart), this->GetCount());
+    }
+
+    /******************************************************************************
+     * @brief Finds the cell holding a marker.
+     *
+     * @param nDictionary - The marker's predefined dictionary.
+     * @param nMarkerID - The marker's ID.
+     * @return int64_t - The cell, or -1 if the marker isn't in the atlas.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    int64_t Find(int nDictionary, int nMarkerID) const
+    {
+        std::span<const MarkerAtlasEntry> spIndex = this->GetIndex();
+        auto itEntry = std::find_if(spIndex.begin(),
+                                    spIndex.end(),
+                                    [&](const MarkerAtlasEntry &stEntry) { return stEntry.nDictionary == nDictionary && stEntry.nMarkerID == nMarkerID; });
+        return itEntry == spIndex.end() ? -1 : int64_t(itEntry - spIndex.begin());
+    }
+
+    /******************************************************************************
+     * @brief Accessor for a cell's pixels. The image is a header over the atlas, it
+     *      is only valid until Close() and is read only if the atlas was opened with Open().
+     *
+     * @param nCell - The cell to get.
+     * @return cv::Mat - The marker as a CV_8UC1 image, no data is copied.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    cv::Mat GetMarker(uint64_t nCell) const
+    {
+        int nMarkerSize = int(this->GetMarkerSize());
+        return cv::Mat(nMarkerSize, nMarkerSize, CV_8UC1, this->GetCellData(nCell));
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the first byte of a cell.
+     *
+     * @param nCell - The cell to get.
+     * @return uint8_t* - The cell's pixels, row major with no padding.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint8_t *GetCellData(uint64_t nCell) const
+    {
+        uint64_t nCellSize = uint64_t(this->GetMarkerSize()) * this->GetMarkerSize();
+        return m_pBase + this->GetHeader()->nDataStart + nCell * nCellSize;
+    }
+
+    /******************************************************************************
+     * @brief Tiles every marker into one grid image, for writing a single encoded
+     *      sheet or looking over a whole set at once.
+     *
+     * @param nColumns - The number of markers per row. 0 picks a roughly square grid.
+     * @return cv::Mat - The sheet, empty cells are white.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    cv::Mat BuildSheet(int nColumns = 0) const
+    {
+        // Pick the grid size.
+        int nCount = int(this->GetCount());
+        int nMarkerSize = int(this->GetMarkerSize());
+        if (nColumns <= 0)
+        {
+            nColumns = std::max(int(std::ceil(std::sqrt(double(nCount)))), 1);
+        }
+        int nRows = (nCount + nColumns - 1) / nColumns;
+
+        // Copy each cell into its place in the grid.
+        cv::Mat cvSheet(nRows * nMarkerSize, nColumns * nMarkerSize, CV_8UC1, cv::Scalar(255));
+        for (int nCell = 0; nCell < nCount; ++nCell)
+        {
+            this->GetMarker(nCell).copyTo(cvSheet(cv::Rect((nCell % nColumns) * nMarkerSize, (nCell / nColumns) * nMarkerSize, nMarkerSize, nMarkerSize)));
+        }
+
+        return cvSheet;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the number of markers.
+     *
+     * @return uint64_t - The number of cells in the atlas.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetCount() const { return m_pBase == nullptr ? 0 : this->GetHeader()->nCount; }
+
+    /******************************************************************************
+     * @brief Accessor for the marker size.
+     *
+     * @return uint32_t - The width and height of every marker in pixels.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint32_t GetMarkerSize() const { return m_pBase == nullptr ? 0 : this->GetHeader()->nMarkerSize; }
+
+    /******************************************************************************
+     * @brief Accessor for the total size of the atlas.
+     *
+     * @return size_t - The number of bytes in memory or on disk, header and index included.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetSizeBytes() const { return m_nSize; }
+
+    /******************************************************************************
+     * @brief Accessor for the Open status.
+     *
+     * @return true - The atlas is allocated or mapped.
+     * @return false - The atlas is closed.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsOpen() const { return m_pBase != nullptr; }
+
+private:
+    // Declare private member variables.
+    std::vector<uint8_t> m_vMemory;
+    int m_nFileDescriptor = -1;
+    void *m_pMapping = nullptr;
+    uint8_t *m_pBase = nullptr;
+    size_t m_nSize = 0;
+
+    /******************************************************************************
+     * @brief Offset of the pixel data, after the index and rounded up to a page.
+     *
+     * @param nCount - The number of markers.
+     * @return uint64_t - The byte offset of the first cell.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static uint64_t DataStart(uint64_t nCount)
+    {
+        uint64_t nIndexEnd = nIndexStart + nCount * sizeof(MarkerAtlasEntry);
+        return (nIndexEnd + nPageSize - 1) / nPageSize * nPageSize;
+    }
+
+    /******************************************************************************
+     * @brief Size of a whole atlas.
+     *
+     * @param nCount - The number of markers.
+     * @param nMarkerSize - The width and height of every marker in pixels.
+     * @return size_t - The number of bytes.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static size_t TotalSize(uint64_t nCount, uint32_t nMarkerSize) { return size_t(DataStart(nCount) + nCount * nMarkerSize * nMarkerSize); }
+
+    /******************************************************************************
+     * @brief Maps the whole file.
+     *
+     * @param nSize - The file size in bytes.
+     * @param nProtection - PROT_READ, optionally with PROT_WRITE.
+     * @return true - The file was mapped.
+     * @return false - mmap failed.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Map(size_t nSize, int nProtection)
+    {
+        void *pMapping = ::mmap(nullptr, nSize, nProtection, MAP_SHARED, m_nFileDescriptor, 0);
+        if (pMapping == MAP_FAILED)
+        {
+            return false;
+        }
+        m_pMapping = pMapping;
+        m_pBase = static_cast<uint8_t *>(pMapping);
+        m_nSize = nSize;
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Writes a header for a new atlas and clears the index.
+     *
+     * @param nCount - The number of markers.
+     * @param nMarkerSize - The width and height of every marker in pixels.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void WriteHeader(uint64_t nCount, uint32_t nMarkerSize)
+    {
+        // Clear everything before the pixel data.
+        std::memset(m_pBase, 0, DataStart(nCount));
+
+        MarkerAtlasHeader stHeader = {nMagic, nVersion, nIndexStart, DataStart(nCount), nCount, nMarkerSize, 0};
+        std::memcpy(m_pBase, &stHeader, sizeof(stHeader));
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the header at the start of the atlas.
+     *
+     * @return const MarkerAtlasHeader* - The header.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    const MarkerAtlasHeader *GetHeader() const { return reinterpret_cast<const MarkerAtlasHeader *>(m_pBase); }
+
+    /******************************************************************************
+     * @brief Accessor for the writable index.
+     *
+     * @return MarkerAtlasEntry* - The first index entry.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    MarkerAtlasEntry *GetIndexData() { return reinterpret_cast<MarkerAtlasEntry *>(m_pBase + nIndexStart); }
+};
+
+#endif
@@ -1,58 +1,643 @@
+/******************************************************************************
+ * @brief Generates ArUco marker images, either one at a time or in batches that
+ *      render in a thread pool and write through a bounded write-behind queue.
+ *
+ * @file TagGenerator.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mars Rover Design Team 2026 - All Rights Reserved
+ ******************************************************************************/
+
+#ifndef TAG_GENERATOR_HPP
+#define TAG_GENERATOR_HPP
+
+#include "../interfaces/AutonomyThread.hpp"
+#include "../util/Channel.hpp"
+#include "MarkerAtlas.hpp"
+
+/// \cond
 #include <opencv2/opencv.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Returns a predefined dictionary, building it only the first time it is
+ *      asked for. The dictionaries are never freed, so references stay valid.
+ *
+ * @param eDictionary - The predefined dictionary.
+ * @return const cv::aruco::Dictionary& - The cached dictionary.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+inline const cv::aruco::Dictionary &GetCachedArucoDictionary(cv::aruco::PredefinedDictionaryType eDictionary)
+{
+    // Create static cache. std::map never moves its elements, so handing out references is safe.
+    static std::mutex muCacheMutex;
+    static std::map<int, cv::aruco::Dictionary> mapDictionaryCache;
+
+    // Build the dictionary if this is the first time it is used.
+    std::lock_guard<std::mutex> lkCacheLock(muCacheMutex);
+    auto itDictionary = mapDictionaryCache.find(eDictionary);
+    if (itDictionary == mapDictionaryCache.end())
+    {
+        itDictionary = mapDictionaryCache.emplace(eDictionary, cv::aruco::getPredefinedDictionary(eDictionary)).first;
+    }
+
+    return itDictionary->second;
+}
+
+/******************************************************************************
+ * @brief Accessor for the number of markers in a predefined dictionary.
+ *
+ * @param eDictionary - The predefined dictionary.
+ * @return int - The number of marker IDs in the dictionary.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+inline int GetArucoMarkerCount(cv::aruco::PredefinedDictionaryType eDictionary)
+{
+    // Every row of the byte list is one marker.
+    return GetCachedArucoDictionary(eDictionary).bytesList.rows;
+}
+
+/******************************************************************************
+ * @brief Builds the file name a marker image is saved under.
+ *
+ * @param eDictionary - The predefined dictionary.
+ * @param sMarker - The marker ID.
+ * @return std::string - The file name, marker<dictionary>_<id>.png.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+inline std::string GetArucoMarkerFilename(cv::aruco::PredefinedDictionaryType eDictionary, unsigned short sMarker)
+{
+    std::string szMarkerFilename = "marker";
+    szMarkerFilename += std::to_string(eDictionary);
+    szMarkerFilename += "_";
+    szMarkerFilename += std::to_string(sMarker);
+    szMarkerFilename += ".png";
+
+    return szMarkerFilename;
+}
+
+/******************************************************************************
+ * @brief Renders one marker and writes it to a PNG in the working directory.
+ *      Markers outside the dictionary are skipped. Everything happens
+ *      synchronously on the calling thread, use ArucoBatchGenerator for many markers.
+ *
+ * @param eDictionary - The predefined dictionary.
+ * @param sMarker - The marker ID.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+inline void GenerateOpenCVArucoMarker(cv::aruco::PredefinedDictionaryType eDictionary, unsigned short sMarker)
+{
+    // Check the marker is in the dictionary.
+    if (sMarker >= GetArucoMarkerCount(eDictionary))
+    {
+        return;
+    }
+
+    // Render and write the marker.
+    cv::Mat cvMarkerImage;
+    cv::aruco::generateImageMarker(GetCachedArucoDictionary(eDictionary), sMarker, 200, cvMarkerImage, 1);
+    cv::imwrite(GetArucoMarkerFilename(eDictionary, sMarker), cvMarkerImage);
+}
 
-void GenerateOpenCVArucoMarker(cv::aruco::PredefinedDictionaryType eDictionary, unsigned short sMarker)
+/******************************************************************************
+ * @brief A range of marker IDs in one dictionary.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct ArucoMarkerRange
 {
-    switch (eDictionary)
+public:
+    // Declare public member variables.
+    cv::aruco::PredefinedDictionaryType eDictionary = cv::aruco::DICT_4X4_50;
+    int nFirstID = 0;
+    int nLastID = -1;    // Inclusive. -1 means the last marker in the dictionary.
+};
+
+/******************************************************************************
+ * @brief A rendered marker waiting to be encoded and written.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct MarkerImage
+{
+public:
+    // Declare public member variables.
+    std::filesystem::path pathFile;
+    cv::Mat cvImage;
+};
+
+/******************************************************************************
+ * @brief Write-behind stage for marker images. Renderers push images into a
+ *      bounded channel and return right away, this thread PNG encodes them and
+ *      writes them to disk. When the channel is full renderers block, so a slow
+ *      disk holds back rendering instead of filling memory with images.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class MarkerImageWriter : public AutonomyThread<void>
+{
+private:
+    // Declare and define private methods and variables.
+    MPSCChannel<MarkerImage> m_stQueue;
+    std::vector<uchar> m_vEncodeBuffer;
+    // Results.
+    std::atomic<uint64_t> m_nImagesWritten = 0;
+    std::atomic<uint64_t> m_nBytesWritten = 0;
+    std::atomic<uint64_t> m_nWriteFailures = 0;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
     {
-    case cv::aruco::DICT_4X4_50:
-    case cv::aruco::DICT_5X5_50:
-    case cv::aruco::DICT_6X6_50:
-    case cv::aruco::DICT_7X7_50:
-        if (sMarker > 49)
+        // Create instance variables.
+        MarkerImage stImage;
+
+        // Sleep until an image arrives.
+        if (m_stQueue.PopWait(stImage))
         {
-            return;
+            // Encode into a reused buffer and write the file in one go.
+            if (cv::imencode(".png", stImage.cvImage, m_vEncodeBuffer))
+            {
+                std::ofstream fsImage(stImage.pathFile, std::ios::binary | std::ios::trunc);
+                fsImage.write(reinterpret_cast<const char *>(m_vEncodeBuffer.data()), std::streamsize(m_vEncodeBuffer.size()));
+                if (fsImage)
+                {
+                    m_nImagesWritten.fetch_add(1, std::memory_order_relaxed);
+                    m_nBytesWritten.fetch_add(m_vEncodeBuffer.size(), std::memory_order_relaxed);
+                    return;
+                }
+            }
+            m_nWriteFailures.fetch_add(1, std::memory_order_relaxed);
         }
-        break;
-    case cv::aruco::DICT_4X4_100:
-    case cv::aruco::DICT_5X5_100:
-    case cv::aruco::DICT_6X6_100:
-    case cv::aruco::DICT_7X7_100:
-        if (sMarker > 99)
+        // Check if the renderers are done and everything has been written.
+        else if (m_stQueue.IsClosed() && m_stQueue.Empty())
         {
-            return;
+            // Request stop of main thread.
+            this->RequestStop();
         }
-        break;
-    case cv::aruco::DICT_4X4_250:
-    case cv::aruco::DICT_5X5_250:
-    case cv::aruco::DICT_6X6_250:
-    case cv::aruco::DICT_7X7_250:
-        if (sMarker > 249)
+    }
+
+    /******************************************************************************
+     * @brief Any highly parallelizable code that can be used in the main thread
+     *       goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override {}
+
+public:
+    /******************************************************************************
+     * @brief Construct a new Marker Image Writer object.
+     *
+     * @param nQueueCapacity - The max number of images waiting to be written.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    MarkerImageWriter(const size_t nQueueCapacity = 64) : m_stQueue(nQueueCapacity, ChannelPolicy::eBlock) {}
+
+    /******************************************************************************
+     * @brief Queues an image to be written. Blocks while the queue is full.
+     *
+     * @param stImage - The image to move into the queue.
+     * @return true - The image was queued.
+     * @return false - The writer has been closed.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Enqueue(MarkerImage &&stImage) { return m_stQueue.Push(std::move(stImage)); }
+
+    /******************************************************************************
+     * @brief Stops accepting images. The writer stops once the queue is drained.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Close() { m_stQueue.Close(); }
+
+    /******************************************************************************
+     * @brief Accessor for the Images Written private member.
+     *
+     * @return uint64_t - The number of images written to disk.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetImagesWritten() { return m_nImagesWritten.load(std::memory_order_relaxed); }
+
+    /******************************************************************************
+     * @brief Accessor for the Bytes Written private member.
+     *
+     * @return uint64_t - The number of encoded bytes written to disk.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetBytesWritten() { return m_nBytesWritten.load(std::memory_order_relaxed); }
+
+    /******************************************************************************
+     * @brief Accessor for the Write Failures private member.
+     *
+     * @return uint64_t - The number of images that couldn't be encoded or written.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetWriteFailures() { return m_nWriteFailures.load(std::memory_order_relaxed); }
+};
+
+/******************************************************************************
+ * @brief Generates every marker in a set of dictionary ranges. Markers are
+ *      rendered by pool tasks using cached dictionaries. In PNG mode they are
+ *      handed to a number of MarkerImageWriter threads that encode and write them
+ *      behind the renderers. In the atlas modes each task renders straight into its
+ *      own cell of a MarkerAtlas, in memory or mapped from a raw file, so there is
+ *      no per-marker encode or file. Runs once per Start(), like the prime calculators.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class ArucoBatchGenerator : public AutonomyThread<void>
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // Where the rendered markers go.
+    enum OutputMode
+    {
+        ePNGFiles,       // One PNG per marker in the output directory.
+        eMemoryAtlas,    // One atlas in memory. Nothing is written unless GetAtlas().Save() is called.
+        eMappedAtlas     // One atlas file, markers.atlas in the output directory, rendered in place.
+    };
+
+private:
+    /******************************************************************************
+     * @brief One marker to render.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    struct MarkerJob
+    {
+    public:
+        // Declare public member variables.
+        cv::aruco::PredefinedDictionaryType eDictionary;
+        int nMarkerID;
+    };
+
+    // Declare and define private methods and variables.
+    std::vector<ArucoMarkerRange> m_vRanges;
+    std::filesystem::path m_pathOutputDirectory = ".";
+    int m_nMarkerSize = 200;
+    int m_nBorderBits = 1;
+    int m_nRenderThreads = 4;
+    int m_nWriterCount = 2;
+    size_t m_nQueueCapacity = 64;
+    OutputMode m_eOutputMode = ePNGFiles;
+    bool m_bWriteSheet = false;
+    MarkerAtlas m_stAtlas;
+    // Per run state.
+    std::vector<MarkerJob> m_vJobs;
+    std::vector<std::unique_ptr<MarkerImageWriter>> m_vWriters;
+    alignas(cachealign::nDestructiveSize) std::atomic<size_t> m_nNextJob = 0;
+    // Results.
+    double m_dGenerationTime = -1.0;
+    double m_dRenderTime = -1.0;
+    uint64_t m_nMarkersWritten = 0;
+    uint64_t m_nBytesWritten = 0;
+    uint64_t m_nWriteFailures = 0;
+
+    /******************************************************************************
+     * @brief This code will run in a separate thread. Main code goes here.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ThreadedContinuousCode() override
+    {
+        // Create instance variables.
+        std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+
+        // Flatten the ranges into one job per marker.
+        m_vJobs.clear();
+        for (const ArucoMarkerRange &stRange : m_vRanges)
         {
-            return;
+            int nLastID = stRange.nLastID < 0 ? GetArucoMarkerCount(stRange.eDictionary) - 1 : std::min(stRange.nLastID, GetArucoMarkerCount(stRange.eDictionary) - 1);
+            for (int nMarkerID = stRange.nFirstID; nMarkerID <= nLastID; ++nMarkerID)
+            {
+                m_vJobs.push_back({stRange.eDictionary, nMarkerID});
+            }
+        }
+        std::filesystem::create_directories(m_pathOutputDirectory);
+
+        // Set up the atlas, or start the writers before the renderers so the queues are drained from the start.
+        m_vWriters.clear();
+        if (m_eOutputMode == eMemoryAtlas)
+        {
+            m_stAtlas.Allocate(m_vJobs.size(), m_nMarkerSize);
+        }
+        else if (m_eOutputMode == eMappedAtlas && !m_stAtlas.Create((m_pathOutputDirectory / "markers.atlas").string(), m_vJobs.size(), m_nMarkerSize))
+        {
+            // Nothing can be rendered without somewhere to put it.
+            m_vJobs.clear();
+        }
+        else if (m_eOutputMode == ePNGFiles)
+        {
+            m_stAtlas.Close();
+            for (int nWriter = 0; nWriter < m_nWriterCount; ++nWriter)
+            {
+                m_vWriters.emplace_back(std::make_unique<MarkerImageWriter>(m_nQueueCapacity));
+                m_vWriters.back()->Start();
+            }
+        }
+
+        // Render every marker in the pool.
+        m_nNextJob = 0;
+        this->RunDetachedPool(m_vJobs.size(), m_nRenderThreads);
+        this->JoinPool();
+        m_dRenderTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count();
+
+        // Let the writers drain their queues and stop.
+        m_nMarkersWritten = 0;
+        m_nBytesWritten = 0;
+        m_nWriteFailures = 0;
+        for (std::unique_ptr<MarkerImageWriter> &pWriter : m_vWriters)
+        {
+            pWriter->Close();
+            pWriter->Join();
+            m_nMarkersWritten += pWriter->GetImagesWritten();
+            m_nBytesWritten += pWriter->GetBytesWritten();
+            m_nWriteFailures += pWriter->GetWriteFailures();
+        }
+        // The atlas holds every marker already, the sheet is one more encode and write.
+        if (m_eOutputMode != ePNGFiles && m_stAtlas.IsOpen())
+        {
+            m_nMarkersWritten = m_stAtlas.GetCount();
+            m_nBytesWritten = m_eOutputMode == eMappedAtlas ? m_stAtlas.GetSizeBytes() : 0;
+            if (m_bWriteSheet)
+            {
+                std::vector<uchar> vEncodeBuffer;
+                std::ofstream fsSheet(m_pathOutputDirectory / "markers_sheet.png", std::ios::binary | std::ios::trunc);
+                if (cv::imencode(".png", m_stAtlas.BuildSheet(), vEncodeBuffer) &&
+                    fsSheet.write(reinterpret_cast<const char *>(vEncodeBuffer.data()), std::streamsize(vEncodeBuffer.size())))
+                {
+                    m_nBytesWritten += vEncodeBuffer.size();
+                }
+                else
+                {
+                    ++m_nWriteFailures;
+                }
+            }
+            // Make sure a mapped atlas is on disk before the clock stops, like the PNG files.
+            m_stAtlas.Flush();
         }
-        break;
-    case cv::aruco::DICT_4X4_1000:
-    case cv::aruco::DICT_5X5_1000:
-    case cv::aruco::DICT_6X6_1000:
-    case cv::aruco::DICT_7X7_1000:
-        if (sMarker > 999)
+
+        // Calculate elapsed time.
+        m_dGenerationTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count();
+        // Request stop of main thread.
+        this->RequestStop();
+    }
+
+    /******************************************************************************
+     * @brief Each pool task renders one marker and queues it for writing.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PooledLinearCode() override
+    {
+        // Claim a marker.
+        size_t nJob = m_nNextJob.fetch_add(1, std::memory_order_relaxed);
+        const MarkerJob &stJob = m_vJobs[nJob];
+
+        // Render atlas markers straight into their cell.
+        if (m_eOutputMode != ePNGFiles)
         {
+            uint8_t *pCell = m_stAtlas.GetCellData(nJob);
+            cv::Mat cvCell = m_stAtlas.GetMarker(nJob);
+            cv::aruco::generateImageMarker(GetCachedArucoDictionary(stJob.eDictionary), stJob.nMarkerID, m_nMarkerSize, cvCell, m_nBorderBits);
+            // OpenCV only reallocates if the size or type don't match, but copy back if it ever does.
+            if (cvCell.data != pCell)
+            {
+                cvCell.copyTo(m_stAtlas.GetMarker(nJob));
+            }
+            m_stAtlas.SetEntry(nJob, stJob.eDictionary, stJob.nMarkerID);
             return;
         }
-        break;
-    default:
-        break;
+
+        // Render it with the cached dictionary.
+        MarkerImage stImage;
+        stImage.pathFile = m_pathOutputDirectory / GetArucoMarkerFilename(stJob.eDictionary, stJob.nMarkerID);
+        cv::aruco::generateImageMarker(GetCachedArucoDictionary(stJob.eDictionary), stJob.nMarkerID, m_nMarkerSize, stImage.cvImage, m_nBorderBits);
+
+        // Hand it to a writer. Spread consecutive markers over the writers.
+        m_vWriters[nJob % m_vWriters.size()]->Enqueue(std::move(stImage));
     }
 
-    std::string szMarkerFilename = "marker";
-    szMarkerFilename += std::to_string(eDictionary);
-    szMarkerFilename += "_";
-    szMarkerFilename += std::to_string(sMarker);
-    szMarkerFilename += ".png";
+public:
+    // Declare and define public methods and variables.
+    ArucoBatchGenerator() = default;
 
-    cv::Mat cvMarkerImage;
-    cv::aruco::Dictionary cvDictionary = cv::aruco::getPredefinedDictionary(eDictionary);
-    cv::aruco::generateImageMarker(cvDictionary, sMarker, 200, cvMarkerImage, 1);
-    cv::imwrite(szMarkerFilename.c_str(), cvMarkerImage);
-}
\ No newline at end of file
+    /******************************************************************************
+     * @brief Adds a range of markers to generate.
+     *
+     * @param eDictionary - The predefined dictionary.
+     * @param nFirstID - The first marker ID.
+     * @param nLastID - The last marker ID, inclusive. -1 for the end of the dictionary.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void AddRange(cv::aruco::PredefinedDictionaryType eDictionary, int nFirstID = 0, int nLastID = -1) { m_vRanges.push_back({eDictionary, nFirstID, nLastID}); }
+
+    /******************************************************************************
+     * @brief Removes every range.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ClearRanges() { m_vRanges.clear(); }
+
+    /******************************************************************************
+     * @brief Mutator for the Output Directory private member. Created if missing.
+     *
+     * @param pathOutputDirectory - Where to write the marker images.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetOutputDirectory(const std::filesystem::path &pathOutputDirectory) { m_pathOutputDirectory = pathOutputDirectory; }
+
+    /******************************************************************************
+     * @brief Mutator for the Marker Size and Border Bits private members.
+     *
+     * @param nMarkerSize - The width and height of each image in pixels.
+     * @param nBorderBits - The width of the black border in marker bits.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetMarkerSize(int nMarkerSize, int nBorderBits = 1)
+    {
+        m_nMarkerSize = nMarkerSize;
+        m_nBorderBits = nBorderBits;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the thread count private members.
+     *
+     * @param nRenderThreads - The number of pool threads rendering markers.
+     * @param nWriterCount - The number of writer threads encoding and writing images.
+     * @param nQueueCapacity - The max number of images queued per writer.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetThreads(int nRenderThreads, int nWriterCount, size_t nQueueCapacity = 64)
+    {
+        m_nRenderThreads = nRenderThreads;
+        m_nWriterCount = std::max(nWriterCount, 1);
+        m_nQueueCapacity = nQueueCapacity;
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Output Mode private member.
+     *
+     * @param eOutputMode - Whether to write PNG files or render into an atlas.
+     * @param bWriteSheet - In the atlas modes, also write every marker tiled into markers_sheet.png.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetOutputMode(OutputMode eOutputMode, bool bWriteSheet = false)
+    {
+        m_eOutputMode = eOutputMode;
+        m_bWriteSheet = bWriteSheet;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the atlas from the last atlas mode run. Only valid after
+     *      Join() and until the next Start().
+     *
+     * @return const MarkerAtlas& - The atlas.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    const MarkerAtlas &GetAtlas() { return m_stAtlas; }
+
+    /******************************************************************************
+     * @brief Accessor for the number of markers the current ranges cover.
+     *
+     * @return size_t - The number of markers that will be generated.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetMarkerCount()
+    {
+        size_t nCount = 0;
+        for (const ArucoMarkerRange &stRange : m_vRanges)
+        {
+            int nLastID = stRange.nLastID < 0 ? GetArucoMarkerCount(stRange.eDictionary) - 1 : std::min(stRange.nLastID, GetArucoMarkerCount(stRange.eDictionary) - 1);
+            nCount += size_t(std::max(nLastID - stRange.nFirstID + 1, 0));
+        }
+
+        return nCount;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Generation Time private member.
+     *
+     * @return double - The time in seconds from the start of the run until every image was on disk.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetGenerationTime() { return m_dGenerationTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the Render Time private member.
+     *
+     * @return double - The time in seconds until every marker was rendered and queued. The
+     *          rest of the generation time is the writers catching up.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    double GetRenderTime() { return m_dRenderTime; }
+
+    /******************************************************************************
+     * @brief Accessor for the Markers Written private member.
+     *
+     * @return uint64_t - The number of images written in the last run, or put in the atlas.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetMarkersWritten() { return m_nMarkersWritten; }
+
+    /******************************************************************************
+     * @brief Accessor for the Bytes Written private member.
+     *
+     * @return uint64_t - The number of encoded bytes written in the last run.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetBytesWritten() { return m_nBytesWritten; }
+
+    /******************************************************************************
+     * @brief Accessor for the Write Failures private member.
+     *
+     * @return uint64_t - The number of images that couldn't be encoded or written in the last run.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetWriteFailures() { return m_nWriteFailures; }
+};
+
+#endif
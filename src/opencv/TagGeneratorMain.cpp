@@ -0,0 +1,149 @@
+#include "TagGenerator.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+
+/******************************************************************************
+ * @brief ArUco marker generation benchmark. Writes every marker in the 4X4
+ *      through 7X7 dictionaries one at a time on the main thread, then again with
+ *      ArucoBatchGenerator as PNG files and as atlases, and prints the throughput
+ *      of each. Then loads them back both ways. This is a mixed CPU and disk
+ *      workload, so results depend heavily on the output drive.
+ *
+ * @param argc - The number of arguments.
+ * @param argv - Optional output directory, defaults to ./markers.
+ * @return int - Exit status number.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+    // Create instance variables.
+    std::filesystem::path pathOutputDirectory = argc > 1 ? argv[1] : "markers";
+    std::vector<cv::aruco::PredefinedDictionaryType> vDictionaries = {cv::aruco::DICT_4X4_1000,
+                                                                      cv::aruco::DICT_5X5_1000,
+                                                                      cv::aruco::DICT_6X6_1000,
+                                                                      cv::aruco::DICT_7X7_1000};
+    int nThreads = std::max(int(std::thread::hardware_concurrency()), 1);
+
+    /////////////////////////////////////////
+    // TEST 1: One marker at a time, render and write on the same thread.
+    /////////////////////////////////////////
+    std::filesystem::path pathSequentialDirectory = pathOutputDirectory / "sequential";
+    std::filesystem::create_directories(pathSequentialDirectory);
+    std::cout << "Generating Markers Sequentially..." << std::endl;
+    // GenerateOpenCVArucoMarker writes to the working directory.
+    std::filesystem::path pathWorkingDirectory = std::filesystem::current_path();
+    std::filesystem::current_path(pathSequentialDirectory);
+    // Build dictionaries before timing, the batch generator shares the same cache.
+    size_t nSequentialMarkers = 0;
+    for (cv::aruco::PredefinedDictionaryType eDictionary : vDictionaries)
+    {
+        nSequentialMarkers += GetArucoMarkerCount(eDictionary);
+    }
+    std::chrono::steady_clock::time_point tmStartTime = std::chrono::steady_clock::now();
+    for (cv::aruco::PredefinedDictionaryType eDictionary : vDictionaries)
+    {
+        for (int nMarkerID = 0; nMarkerID < GetArucoMarkerCount(eDictionary); ++nMarkerID)
+        {
+            GenerateOpenCVArucoMarker(eDictionary, nMarkerID);
+        }
+    }
+    double dSequentialTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count();
+    std::filesystem::current_path(pathWorkingDirectory);
+    // Print TEST1 info.
+    std::cout << "Sequential Generation Time: " << dSequentialTime << " s, Markers: " << nSequentialMarkers
+              << ", Markers Per Second: " << nSequentialMarkers / dSequentialTime << std::endl;
+
+    /////////////////////////////////////////
+    // TEST 2: Pooled rendering with write-behind encoding and file writes.
+    /////////////////////////////////////////
+    ArucoBatchGenerator ArucoGeneratorTEST2 = ArucoBatchGenerator();
+    for (cv::aruco::PredefinedDictionaryType eDictionary : vDictionaries)
+    {
+        ArucoGeneratorTEST2.AddRange(eDictionary);
+    }
+    ArucoGeneratorTEST2.SetOutputDirectory(pathOutputDirectory / "batch");
+    std::cout << "Generating Markers In Batch..." << std::endl;
+    // Try a few splits between rendering and writing.
+    for (int nWriters : {1, 2, 4})
+    {
+        // Run thread.
+        ArucoGeneratorTEST2.SetThreads(nThreads, nWriters);
+        ArucoGeneratorTEST2.Start();
+        ArucoGeneratorTEST2.Join();
+        // Print TEST2 info.
+        std::cout << "Batch Generation Time (" << nThreads << " Render Threads, " << nWriters << " Writers): " << ArucoGeneratorTEST2.GetGenerationTime()
+                  << " s, Render Time: " << ArucoGeneratorTEST2.GetRenderTime() << " s, Markers: " << ArucoGeneratorTEST2.GetMarkersWritten()
+                  << ", Failures: " << ArucoGeneratorTEST2.GetWriteFailures() << ", MB Written: " << ArucoGeneratorTEST2.GetBytesWritten() / 1e6
+                  << ", Markers Per Second: " << ArucoGeneratorTEST2.GetMarkersWritten() / ArucoGeneratorTEST2.GetGenerationTime() << std::endl;
+    }
+
+    /////////////////////////////////////////
+    // TEST 3: Pooled rendering into a single atlas instead of one file per marker.
+    /////////////////////////////////////////
+    std::cout << "Generating Marker Atlases..." << std::endl;
+    ArucoGeneratorTEST2.SetOutputDirectory(pathOutputDirectory / "atlas");
+    ArucoGeneratorTEST2.SetThreads(nThreads, 1);
+    for (ArucoBatchGenerator::OutputMode eOutputMode : {ArucoBatchGenerator::eMemoryAtlas, ArucoBatchGenerator::eMappedAtlas})
+    {
+        // Run once with just the atlas, then again with the encoded sheet.
+        for (bool bWriteSheet : {false, true})
+        {
+            // Run thread.
+            ArucoGeneratorTEST2.SetOutputMode(eOutputMode, bWriteSheet);
+            ArucoGeneratorTEST2.Start();
+            ArucoGeneratorTEST2.Join();
+            // Print TEST3 info.
+            std::cout << (eOutputMode == ArucoBatchGenerator::eMemoryAtlas ? "Memory" : "Mapped") << " Atlas" << (bWriteSheet ? " With Sheet" : "")
+                      << " Generation Time: " << ArucoGeneratorTEST2.GetGenerationTime() << " s, Render Time: " << ArucoGeneratorTEST2.GetRenderTime()
+                      << " s, Markers: " << ArucoGeneratorTEST2.GetMarkersWritten() << ", Failures: " << ArucoGeneratorTEST2.GetWriteFailures()
+                      << ", MB Written: " << ArucoGeneratorTEST2.GetBytesWritten() / 1e6
+                      << ", Markers Per Second: " << ArucoGeneratorTEST2.GetMarkersWritten() / ArucoGeneratorTEST2.GetGenerationTime() << std::endl;
+        }
+    }
+
+    /////////////////////////////////////////
+    // TEST 4: Loading every marker back, one PNG at a time vs one atlas mapping.
+    /////////////////////////////////////////
+    std::cout << "Loading Markers..." << std::endl;
+    // Decode every PNG from the batch run.
+    uint64_t nPNGChecksum = 0;
+    size_t nPNGMarkers = 0;
+    tmStartTime = std::chrono::steady_clock::now();
+    for (const std::filesystem::directory_entry &stEntry : std::filesystem::directory_iterator(pathOutputDirectory / "batch"))
+    {
+        cv::Mat cvMarker = cv::imread(stEntry.path().string(), cv::IMREAD_GRAYSCALE);
+        nPNGChecksum += uint64_t(cv::sum(cvMarker)[0]);
+        nPNGMarkers += !cvMarker.empty();
+    }
+    double dPNGLoadTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count();
+    // Map the atlas and touch every marker.
+    MarkerAtlas stAtlasTEST4;
+    uint64_t nAtlasChecksum = 0;
+    tmStartTime = std::chrono::steady_clock::now();
+    if (stAtlasTEST4.Open((pathOutputDirectory / "atlas" / "markers.atlas").string()))
+    {
+        for (uint64_t nCell = 0; nCell < stAtlasTEST4.GetCount(); ++nCell)
+        {
+            nAtlasChecksum += uint64_t(cv::sum(stAtlasTEST4.GetMarker(nCell))[0]);
+        }
+    }
+    double dAtlasLoadTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tmStartTime).count();
+    // Print TEST4 info.
+    std::cout << "PNG Load Time: " << dPNGLoadTime << " s, Markers: " << nPNGMarkers << ", Markers Per Second: " << nPNGMarkers / dPNGLoadTime << std::endl;
+    std::cout << "Atlas Load Time: " << dAtlasLoadTime << " s, Markers: " << stAtlasTEST4.GetCount()
+              << ", Markers Per Second: " << stAtlasTEST4.GetCount() / dAtlasLoadTime << ", Matches PNG: " << (nAtlasChecksum == nPNGChecksum ? "Yes" : "No")
+              << std::endl;
+
+    /////////////////////////////////////////
+    // Cleanup.
+    /////////////////////////////////////////
+
+    // Successful exit.
+    return 0;
+}
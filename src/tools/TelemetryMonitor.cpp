@@ -0,0 +1,99 @@
+#include "../util/ThreadRegistry.hpp"
+
+/// \cond
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <signal.h>
+
+/// \endcond
+
+// Create a boolean used to handle a SIGINT and exit gracefully.
+volatile sig_atomic_t bMonitorStop = false;
+
+/******************************************************************************
+ * @brief Help function given to the C++ csignal standard library to run when
+ *      a CONTROL^C is given from the terminal.
+ *
+ * @param nSignal - Integer representing the interrupt value.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+void SignalHandler(int nSignal)
+{
+    // Update stop signal.
+    (void) nSignal;
+    bMonitorStop = true;
+}
+
+/******************************************************************************
+ * @brief Telemetry monitor. Maps the benchmark's telemetry segment read only and
+ *      prints a table of every registered thread a few times per second. Waits for
+ *      the segment to appear, so it can be started before the benchmark.
+ *
+ * @param argc - The number of arguments.
+ * @param argv - Optional segment name, defaults to /AutonomyThreadTelemetry, and
+ *          optional refresh period in milliseconds, defaults to 500.
+ * @return int - Exit status number.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+    // Create instance variables.
+    std::string szSegmentName = argc > 1 ? argv[1] : "/AutonomyThreadTelemetry";
+    int nRefreshMilliseconds = argc > 2 ? std::stoi(argv[2]) : 500;
+    static const char *aStateNames[] = {"Starting", "Running", "Stopping", "Stopped"};
+    ThreadTelemetryReader stReader;
+
+    // Setup signal interrupt handler.
+    signal(SIGINT, SignalHandler);
+    signal(SIGTERM, SignalHandler);
+
+    // Refresh until interrupted.
+    while (!bMonitorStop)
+    {
+        // Wait for the segment, and reopen it if the process restarted.
+        if (stReader.GetProcessID() < 0 || ::kill(stReader.GetProcessID(), 0) != 0)
+        {
+            if (!stReader.Open(szSegmentName))
+            {
+                std::cout << "Waiting for " << szSegmentName << "..." << std::endl;
+                std::this_thread::sleep_for(std::chrono::milliseconds(nRefreshMilliseconds));
+                continue;
+            }
+        }
+
+        // Print every registered thread.
+        int64_t nNow = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        std::printf("\n%-24s %-9s %7s %9s %9s %9s %5s %6s %9s %12s %8s\n",
+                    "Name", "State", "Limit", "IPS", "AvgIPS", "1%Low", "Pool", "Queue", "Overruns", "WorstOver", "Age ms");
+        for (const ThreadTelemetrySnapshot &stSnapshot : stReader.ReadAll())
+        {
+            std::printf("%-24s %-9s %7d %9.1f %9.1f %9.1f %5d %6d %9llu %10lluus %8.1f%s\n",
+                        stSnapshot.szName.c_str(),
+                        stSnapshot.nState >= 0 && stSnapshot.nState < 4 ? aStateNames[stSnapshot.nState] : "?",
+                        stSnapshot.nIPSLimit,
+                        stSnapshot.dCurrentIPS,
+                        stSnapshot.dAverageIPS,
+                        stSnapshot.d1PercentLow,
+                        stSnapshot.nPoolThreads,
+                        stSnapshot.nPoolQueueLength,
+                        static_cast<unsigned long long>(stSnapshot.nOverrunCount),
+                        static_cast<unsigned long long>(stSnapshot.nWorstOverrunMicroseconds),
+                        (nNow - stSnapshot.nUpdateTimeNanoseconds) / 1e6,
+                        stSnapshot.bTorn ? " (torn)" : "");
+        }
+        std::fflush(stdout);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(nRefreshMilliseconds));
+    }
+
+    // Successful exit.
+    return 0;
+}
@@ -0,0 +1,569 @@
+/******************************************************************************
+ * @brief Defines and implements storage of benchmark samples in a versioned
+ *      baseline file and the Mann-Whitney U comparison of a run against it.
+ *
+ * @file BenchmarkBaseline.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef BENCHMARK_BASELINE_HPP
+#define BENCHMARK_BASELINE_HPP
+
+/// \cond
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/utsname.h>
+
+/// \endcond
+
+// The build fills these in, see CMakeLists.txt.
+#ifndef AUTONOMYTHREAD_COMPILE_FLAGS
+#define AUTONOMYTHREAD_COMPILE_FLAGS "unknown"
+#endif
+#ifndef AUTONOMYTHREAD_BUILD_TYPE
+#define AUTONOMYTHREAD_BUILD_TYPE "unknown"
+#endif
+
+/******************************************************************************
+ * @brief Namespace containing the baseline file and the statistics used to
+ *      decide if a benchmark got faster or slower.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+namespace benchstats
+{
+    /******************************************************************************
+     * @brief Describes the machine and build that produced a set of samples.
+     *      Results are only comparable when these match.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    struct MachineFingerprint
+    {
+        std::string szCPUModel;
+        std::string szKernel;
+        std::string szCompiler;
+        std::string szCompileFlags;
+        std::string szBuildType;
+        unsigned int nHardwareThreads = 0;
+
+        /******************************************************************************
+         * @brief Compares every field.
+         *
+         * @param stOther - The fingerprint to compare against.
+         * @return true - Same machine and build.
+         * @return false - Something differs.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        bool operator==(const MachineFingerprint &stOther) const = default;
+    };
+
+    /******************************************************************************
+     * @brief Builds the fingerprint of this machine and binary.
+     *
+     * @return MachineFingerprint - The current fingerprint.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline MachineFingerprint GetMachineFingerprint()
+    {
+        // Create instance variables.
+        MachineFingerprint stFingerprint;
+        std::ifstream fsCPUInfo("/proc/cpuinfo");
+        std::string szLine;
+        struct utsname stUname;
+
+        // Use the first model name in /proc/cpuinfo.
+        stFingerprint.szCPUModel = "unknown";
+        while (std::getline(fsCPUInfo, szLine))
+        {
+            if (szLine.compare(0, 10, "model name") == 0 && szLine.find(':') != std::string::npos)
+            {
+                stFingerprint.szCPUModel = szLine.substr(std::min(szLine.find(':') + 2, szLine.size()));
+                break;
+            }
+        }
+        stFingerprint.szKernel = ::uname(&stUname) == 0 ? std::string(stUname.sysname) + " " + stUname.release + " " + stUname.machine : "unknown";
+        stFingerprint.szCompiler = __VERSION__;
+        stFingerprint.szCompileFlags = AUTONOMYTHREAD_COMPILE_FLAGS;
+        stFingerprint.szBuildType = AUTONOMYTHREAD_BUILD_TYPE;
+        stFingerprint.nHardwareThreads = std::thread::hardware_concurrency();
+
+        return stFingerprint;
+    }
+
+    /******************************************************************************
+     * @brief The outcome of a two sided Mann-Whitney U test.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    struct MannWhitneyResult
+    {
+        double dU = 0.0;             // U statistic of the second sample.
+        double dPValue = 1.0;        // Two sided p-value.
+        double dEffectSize = 0.0;    // Rank-biserial correlation, positive when the second sample is larger.
+        bool bExact = false;         // True if the p-value came from the exact distribution.
+    };
+
+    /******************************************************************************
+     * @brief Runs a two sided Mann-Whitney U test. Makes no assumption about the
+     *      shape of either distribution, which matters for timings since they are
+     *      skewed towards slow outliers. The exact null distribution is used for
+     *      small samples without ties, otherwise the normal approximation with tie
+     *      and continuity corrections.
+     *
+     * @param vA - The first sample. (the baseline)
+     * @param vB - The second sample. (the current run)
+     * @return MannWhitneyResult - U, p-value, and effect size. p is 1 if either sample is empty.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline MannWhitneyResult MannWhitneyU(const std::vector<double> &vA, const std::vector<double> &vB)
+    {
+        // Create instance variables.
+        MannWhitneyResult stResult;
+        const size_t nA = vA.size();
+        const size_t nB = vB.size();
+        if (nA == 0 || nB == 0)
+        {
+            return stResult;
+        }
+
+        // Rank both samples together, ties get the average of their ranks.
+        std::vector<std::pair<double, bool>> vPooled;
+        vPooled.reserve(nA + nB);
+        for (double dValue : vA)
+        {
+            vPooled.emplace_back(dValue, false);
+        }
+        for (double dValue : vB)
+        {
+            vPooled.emplace_back(dValue, true);
+        }
+        std::sort(vPooled.begin(), vPooled.end());
+        double dRankSumB = 0.0;
+        double dTieCorrection = 0.0;
+        for (size_t nStart = 0; nStart < vPooled.size();)
+        {
+            size_t nEnd = nStart;
+            while (nEnd < vPooled.size() && vPooled[nEnd].first == vPooled[nStart].first)
+            {
+                ++nEnd;
+            }
+            double dTies = double(nEnd - nStart);
+            double dRank = (nStart + 1 + nEnd) / 2.0;
+            for (size_t nIndex = nStart; nIndex < nEnd; ++nIndex)
+            {
+                dRankSumB += vPooled[nIndex].second ? dRank : 0.0;
+            }
+            dTieCorrection += dTies * dTies * dTies - dTies;
+            nStart = nEnd;
+        }
+
+        // U of B counts the pairs where B is larger, ties count half.
+        const double dPairs = double(nA) * double(nB);
+        stResult.dU = dRankSumB - double(nB) * double(nB + 1) / 2.0;
+        stResult.dEffectSize = 2.0 * stResult.dU / dPairs - 1.0;
+
+        // Small samples without ties, count arrangements for the exact distribution.
+        if (dTieCorrection == 0.0 && nA <= 20 && nB <= 20)
+        {
+            // vCounts[a][b][u] is the number of orderings of a and b values with statistic u, built up one value at a time.
+            const size_t nMaxU = nA * nB;
+            std::vector<std::vector<std::vector<double>>> vCounts(nA + 1, std::vector<std::vector<double>>(nB + 1));
+            for (size_t nI = 0; nI <= nA; ++nI)
+            {
+                for (size_t nJ = 0; nJ <= nB; ++nJ)
+                {
+                    vCounts[nI][nJ].assign(nI * nJ + 1, 0.0);
+                    if (nI == 0 || nJ == 0)
+                    {
+                        vCounts[nI][nJ][0] = 1.0;
+                        continue;
+                    }
+                    // The largest value is either from B, adding nI to U, or from A.
+                    for (size_t nU = 0; nU <= nI * nJ; ++nU)
+                    {
+                        vCounts[nI][nJ][nU] = (nU >= nI ? vCounts[nI][nJ - 1][nU - nI] : 0.0) + (nU <= (nI - 1) * nJ ? vCounts[nI - 1][nJ][nU] : 0.0);
+                    }
+                }
+            }
+            // Two sided, sum the tail on the side of the smaller U and double it.
+            size_t nU = size_t(std::min(stResult.dU, dPairs - stResult.dU));
+            double dTail = 0.0;
+            double dTotal = 0.0;
+            for (size_t nIndex = 0; nIndex <= nMaxU; ++nIndex)
+            {
+                dTail += nIndex <= nU ? vCounts[nA][nB][nIndex] : 0.0;
+                dTotal += vCounts[nA][nB][nIndex];
+            }
+            stResult.dPValue = std::min(1.0, 2.0 * dTail / dTotal);
+            stResult.bExact = true;
+            return stResult;
+        }
+
+        // Normal approximation.
+        const double dN = double(nA + nB);
+        const double dVariance = dPairs / 12.0 * ((dN + 1.0) - dTieCorrection / (dN * (dN - 1.0)));
+        if (dVariance <= 0.0)
+        {
+            // Every value is the same.
+            return stResult;
+        }
+        double dZ = (std::abs(stResult.dU - dPairs / 2.0) - 0.5) / std::sqrt(dVariance);
+        stResult.dPValue = std::min(1.0, std::erfc(std::max(dZ, 0.0) / std::sqrt(2.0)));
+
+        return stResult;
+    }
+
+    /******************************************************************************
+     * @brief Median of a sample.
+     *
+     * @param vSamples - The sample, copied so it can be partially sorted.
+     * @return double - The median, 0 if the sample is empty.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline double Median(std::vector<double> vSamples)
+    {
+        // Check for an empty sample.
+        if (vSamples.empty())
+        {
+            return 0.0;
+        }
+
+        // Average the two middle values of an even sample.
+        size_t nMiddle = vSamples.size() / 2;
+        std::nth_element(vSamples.begin(), vSamples.begin() + nMiddle, vSamples.end());
+        double dMedian = vSamples[nMiddle];
+        if (vSamples.size() % 2 == 0)
+        {
+            dMedian = (dMedian + *std::max_element(vSamples.begin(), vSamples.begin() + nMiddle)) / 2.0;
+        }
+
+        return dMedian;
+    }
+
+    /******************************************************************************
+     * @brief Every sample recorded for one benchmark metric.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    struct BenchmarkMetric
+    {
+        std::string szUnit;
+        bool bLowerIsBetter = true;
+        std::vector<double> vSamples;
+    };
+
+    /******************************************************************************
+     * @brief One line of a comparison report.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    struct BenchmarkComparison
+    {
+        enum Verdict
+        {
+            eFaster,
+            eSlower,
+            eUnchanged,
+            eNotInBaseline
+        };
+
+        std::string szName;
+        std::string szUnit;
+        size_t nBaselineSamples = 0;
+        size_t nCurrentSamples = 0;
+        double dBaselineMedian = 0.0;
+        double dCurrentMedian = 0.0;
+        double dChangePercent = 0.0;    // Change of the median, positive when the current median is larger.
+        MannWhitneyResult stTest;
+        Verdict eVerdict = eUnchanged;
+    };
+
+    /******************************************************************************
+     * @brief Collects benchmark samples by name and saves or loads them as a
+     *      versioned baseline file along with the machine fingerprint. The file is
+     *      plain text, one metric per line, so it can be kept next to the code and
+     *      diffed.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    class BenchmarkResults
+    {
+    public:
+        // Declare and define public class constants.
+        static constexpr const char *szFileMagic = "AutonomyThreadBaseline";
+        static constexpr int nFileVersion = 1;
+
+        /******************************************************************************
+         * @brief Construct a new Benchmark Results object for this machine.
+         *
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        BenchmarkResults() { m_stFingerprint = GetMachineFingerprint(); }
+
+        /******************************************************************************
+         * @brief Adds one sample to a metric, creating it on first use.
+         *
+         * @param szName - Unique name of the metric. Tabs and newlines are replaced with spaces.
+         * @param dValue - The sample.
+         * @param szUnit - The unit, only used in reports.
+         * @param bLowerIsBetter - True for times and latencies, false for throughputs.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        void Record(std::string szName, double dValue, const std::string &szUnit = "s", bool bLowerIsBetter = true)
+        {
+            // Keep the name on one field of one line.
+            std::replace_if(szName.begin(), szName.end(), [](char cChar) { return cChar == '\t' || cChar == '\n'; }, ' ');
+
+            // Add the sample.
+            BenchmarkMetric &stMetric = m_mMetrics[szName];
+            stMetric.szUnit = szUnit;
+            stMetric.bLowerIsBetter = bLowerIsBetter;
+            stMetric.vSamples.push_back(dValue);
+        }
+
+        /******************************************************************************
+         * @brief Writes the fingerprint and every sample to a baseline file.
+         *
+         * @param szPath - The file to write, replaced if it exists.
+         * @return true - The file was written.
+         * @return false - The file couldn't be opened or written.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        bool Save(const std::string &szPath) const
+        {
+            // Open the file.
+            std::ofstream fsBaseline(szPath, std::ios::trunc);
+            if (!fsBaseline)
+            {
+                return false;
+            }
+
+            // Write the header and fingerprint.
+            fsBaseline.precision(17);
+            fsBaseline << szFileMagic << "\t" << nFileVersion << "\n";
+            fsBaseline << "cpu\t" << m_stFingerprint.szCPUModel << "\n";
+            fsBaseline << "threads\t" << m_stFingerprint.nHardwareThreads << "\n";
+            fsBaseline << "kernel\t" << m_stFingerprint.szKernel << "\n";
+            fsBaseline << "compiler\t" << m_stFingerprint.szCompiler << "\n";
+            fsBaseline << "flags\t" << m_stFingerprint.szCompileFlags << "\n";
+            fsBaseline << "buildtype\t" << m_stFingerprint.szBuildType << "\n";
+
+            // Write one line per metric.
+            for (const auto &[szName, stMetric] : m_mMetrics)
+            {
+                fsBaseline << "metric\t" << szName << "\t" << stMetric.szUnit << "\t" << stMetric.bLowerIsBetter << "\t" << stMetric.vSamples.size();
+                for (double dSample : stMetric.vSamples)
+                {
+                    fsBaseline << "\t" << dSample;
+                }
+                fsBaseline << "\n";
+            }
+
+            return bool(fsBaseline.flush());
+        }
+
+        /******************************************************************************
+         * @brief Replaces the fingerprint and samples with the contents of a
+         *      baseline file.
+         *
+         * @param szPath - The file to read.
+         * @return true - The file was read.
+         * @return false - Missing file, wrong magic, or a different file version.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        bool Load(const std::string &szPath)
+        {
+            // Create instance variables.
+            std::ifstream fsBaseline(szPath);
+            std::string szLine;
+            std::string szMagic;
+            int nVersion = 0;
+
+            // Check the header.
+            if (!std::getline(fsBaseline, szLine))
+            {
+                return false;
+            }
+            std::istringstream(szLine) >> szMagic >> nVersion;
+            if (szMagic != szFileMagic || nVersion != nFileVersion)
+            {
+                return false;
+            }
+
+            // Read each tagged line.
+            m_stFingerprint = MachineFingerprint();
+            m_mMetrics.clear();
+            while (std::getline(fsBaseline, szLine))
+            {
+                // Split the line on tabs.
+                std::vector<std::string> vFields;
+                std::istringstream ssLine(szLine);
+                for (std::string szField; std::getline(ssLine, szField, '\t');)
+                {
+                    vFields.push_back(szField);
+                }
+                if (vFields.size() < 2)
+                {
+                    continue;
+                }
+
+                // Store the field.
+                const std::string &szTag = vFields[0];
+                if (szTag == "cpu")
+                {
+                    m_stFingerprint.szCPUModel = vFields[1];
+                }
+                else if (szTag == "threads")
+                {
+                    m_stFingerprint.nHardwareThreads = unsigned(std::stoul(vFields[1]));
+                }
+                else if (szTag == "kernel")
+                {
+                    m_stFingerprint.szKernel = vFields[1];
+                }
+                else if (szTag == "compiler")
+                {
+                    m_stFingerprint.szCompiler = vFields[1];
+                }
+                else if (szTag == "flags")
+                {
+                    m_stFingerprint.szCompileFlags = vFields[1];
+                }
+                else if (szTag == "buildtype")
+                {
+                    m_stFingerprint.szBuildType = vFields[1];
+                }
+                else if (szTag == "metric" && vFields.size() >= 5)
+                {
+                    BenchmarkMetric &stMetric = m_mMetrics[vFields[1]];
+                    stMetric.szUnit = vFields[2];
+                    stMetric.bLowerIsBetter = vFields[3] == "1";
+                    for (size_t nIndex = 5; nIndex < vFields.size(); ++nIndex)
+                    {
+                        stMetric.vSamples.push_back(std::stod(vFields[nIndex]));
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /******************************************************************************
+         * @brief Compares every metric of this run against a baseline. A metric is
+         *      only called faster or slower when the difference is significant and
+         *      the effect is large enough to matter, otherwise it is unchanged.
+         *
+         * @param stBaseline - The loaded baseline.
+         * @param dAlpha - Significance level of the Mann-Whitney U test.
+         * @param dMinimumEffect - Smallest absolute rank-biserial correlation that counts as a change.
+         * @return std::vector<BenchmarkComparison> - One entry per metric in this run, sorted by name.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        std::vector<BenchmarkComparison> Compare(const BenchmarkResults &stBaseline, double dAlpha = 0.05, double dMinimumEffect = 0.5) const
+        {
+            // Create instance variables.
+            std::vector<BenchmarkComparison> vComparisons;
+
+            // Compare each metric recorded by this run.
+            for (const auto &[szName, stMetric] : m_mMetrics)
+            {
+                BenchmarkComparison stComparison;
+                stComparison.szName = szName;
+                stComparison.szUnit = stMetric.szUnit;
+                stComparison.nCurrentSamples = stMetric.vSamples.size();
+                stComparison.dCurrentMedian = Median(stMetric.vSamples);
+
+                // Check that the baseline has it.
+                auto itBaseline = stBaseline.m_mMetrics.find(szName);
+                if (itBaseline == stBaseline.m_mMetrics.end())
+                {
+                    stComparison.eVerdict = BenchmarkComparison::eNotInBaseline;
+                    vComparisons.push_back(stComparison);
+                    continue;
+                }
+
+                // Test the two samples.
+                stComparison.nBaselineSamples = itBaseline->second.vSamples.size();
+                stComparison.dBaselineMedian = Median(itBaseline->second.vSamples);
+                stComparison.dChangePercent =
+                    stComparison.dBaselineMedian != 0.0 ? (stComparison.dCurrentMedian / stComparison.dBaselineMedian - 1.0) * 100.0 : 0.0;
+                stComparison.stTest = MannWhitneyU(itBaseline->second.vSamples, stMetric.vSamples);
+                if (stComparison.stTest.dPValue < dAlpha && std::abs(stComparison.stTest.dEffectSize) >= dMinimumEffect)
+                {
+                    // A larger current value is worse when lower is better.
+                    bool bLarger = stComparison.stTest.dEffectSize > 0.0;
+                    stComparison.eVerdict = bLarger == stMetric.bLowerIsBetter ? BenchmarkComparison::eSlower : BenchmarkComparison::eFaster;
+                }
+                vComparisons.push_back(stComparison);
+            }
+
+            return vComparisons;
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the machine fingerprint.
+         *
+         * @return const MachineFingerprint& - The fingerprint of this run or of the loaded file.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        const MachineFingerprint &GetFingerprint() const { return m_stFingerprint; }
+
+        /******************************************************************************
+         * @brief Accessor for the number of metrics.
+         *
+         * @return size_t - The number of distinct metric names recorded.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        size_t GetMetricCount() const { return m_mMetrics.size(); }
+
+    private:
+        // Declare private member variables.
+        MachineFingerprint m_stFingerprint;
+        std::map<std::string, BenchmarkMetric> m_mMetrics;
+    };
+}    // namespace benchstats
+
+#endif
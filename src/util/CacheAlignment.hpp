@@ -0,0 +1,82 @@
+/******************************************************************************
+ * @brief Defines cache line size constants and a small wrapper used to keep
+ *      frequently written shared state on its own cache line.
+ *
+ * @file CacheAlignment.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef CACHE_ALIGNMENT_HPP
+#define CACHE_ALIGNMENT_HPP
+
+/// \cond
+#include <cstddef>
+#include <new>
+#include <utility>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Namespace containing the cache line sizes used for laying out shared
+ *      state between threads.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+namespace cachealign
+{
+    // GCC warns about every use of the interference sizes since they can change with -mtune.
+    // This whole project is header only and compiled into one executable, so there is no ABI to break.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+#ifdef __cpp_lib_hardware_interference_size
+    // Minimum offset between two objects to avoid false sharing.
+    constexpr std::size_t nDestructiveSize = std::hardware_destructive_interference_size;
+    // Maximum size of contiguous memory to promote true sharing.
+    constexpr std::size_t nConstructiveSize = std::hardware_constructive_interference_size;
+#else
+    // Fallback for standard libraries that don't provide the interference sizes. 64 bytes is correct for x86 and most ARM cores.
+    constexpr std::size_t nDestructiveSize = 64;
+    constexpr std::size_t nConstructiveSize = 64;
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+}    // namespace cachealign
+
+/******************************************************************************
+ * @brief Wrapper that pads and aligns a value to its own cache line. Useful for
+ *      arrays of per-thread counters or accumulators where neighbouring elements
+ *      are written by different threads.
+ *
+ * @tparam T - The type of the wrapped value.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+template <typename T>
+struct alignas(cachealign::nDestructiveSize) CacheAligned
+{
+public:
+    // Declare public member variables.
+    T tValue;
+
+    /******************************************************************************
+     * @brief Construct a new Cache Aligned object. All arguments are forwarded to
+     *      the constructor of the wrapped value.
+     *
+     * @tparam Args - Types of the wrapped value constructor arguments.
+     * @param args - The wrapped value constructor arguments.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename... Args>
+    CacheAligned(Args &&...args) : tValue(std::forward<Args>(args)...) {}
+};
+
+#endif
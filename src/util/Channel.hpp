@@ -0,0 +1,645 @@
+/******************************************************************************
+ * @brief Defines and implements bounded lock-free channels used to hand data
+ *      from one AutonomyThread to another.
+ *
+ * @file Channel.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef CHANNEL_HPP
+#define CHANNEL_HPP
+
+#include "CacheAlignment.hpp"
+
+/// \cond
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief What a channel does when a producer pushes into a full buffer.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+enum class ChannelPolicy
+{
+    eBlock,         // The producer waits until the consumer makes room.
+    eDropOldest,    // The oldest queued item is thrown out to make room for the new one.
+    eDropNewest     // The new item is thrown out, the queue is left untouched.
+};
+
+/******************************************************************************
+ * @brief Interface for something that wants to be told when a channel has data,
+ *      instead of sleeping in PopWait(). Used to resume coroutines that await a channel.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class ChannelDataWaiter
+{
+public:
+    // Declare public methods.
+    virtual ~ChannelDataWaiter() = default;
+    virtual void OnDataAvailable() = 0;    // Called by the producer that pushed data, or by Close(). Must not block.
+};
+
+/******************************************************************************
+ * @brief A bounded ring buffer channel. Items are moved in and moved out, so
+ *      payloads that own heap memory (images, point clouds, vectors) are handed
+ *      over without copying their contents.
+ *
+ *      The push and pop paths are lock-free. Each slot carries a sequence number
+ *      that tells producers and the consumer whether it is free or full, so the
+ *      head and tail indices are the only shared state that is contended.
+ *      A mutex and condition variable are only touched when a thread actually
+ *      needs to sleep, which lets a consumer's ThreadedContinuousCode() block in
+ *      PopWait() until data arrives instead of spinning the main loop.
+ *
+ *      Only ONE thread may pop from a channel. With bMultiProducer set to false only
+ *      one thread may push, with it set to true any number of threads may push.
+ *
+ * @tparam T - The type of the items moved through the channel.
+ * @tparam bMultiProducer - Whether more than one thread pushes into this channel.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+template <typename T, bool bMultiProducer = false>
+class Channel
+{
+public:
+    /////////////////////////////////////////
+    // Declare and define public class methods.
+    /////////////////////////////////////////
+
+    /******************************************************************************
+     * @brief Construct a new Channel object.
+     *
+     * @param nCapacity - The max number of items the channel can hold. Rounded up to a power of two.
+     * @param ePolicy - What to do when a producer pushes into a full channel.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    Channel(const size_t nCapacity = 64, const ChannelPolicy ePolicy = ChannelPolicy::eBlock)
+    {
+        // Round the capacity up to a power of two so the index can be masked instead of divided.
+        size_t nRoundedCapacity = 2;
+        while (nRoundedCapacity < nCapacity)
+        {
+            nRoundedCapacity <<= 1;
+        }
+
+        // Initialize member variables.
+        m_nMask = nRoundedCapacity - 1;
+        m_ePolicy = ePolicy;
+        m_pSlots = std::make_unique<Slot[]>(nRoundedCapacity);
+        // Each slot starts out free for the producer at the same position.
+        for (size_t nIter = 0; nIter < nRoundedCapacity; ++nIter)
+        {
+            m_pSlots[nIter].nSequence.store(nIter, std::memory_order_relaxed);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Destroy the Channel object. Any items still queued are destroyed.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ~Channel()
+    {
+        // Wake anybody that is still waiting.
+        this->Close();
+
+        // Destroy queued items.
+        while (this->TryPopSlot(nullptr))
+        {
+        }
+    }
+
+    // Channels own their slots and are shared by reference between threads.
+    Channel(const Channel &) = delete;
+    Channel &operator=(const Channel &) = delete;
+
+    /******************************************************************************
+     * @brief Moves an item into the channel. What happens when the channel is full
+     *      depends on the policy given to the constructor.
+     *
+     * @param tItem - The item to move into the channel.
+     * @return true - The item was queued.
+     * @return false - The item was dropped because the channel is full (eDropNewest) or closed.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Push(T &&tItem)
+    {
+        // Loop until the item is queued or dropped.
+        while (!m_bClosed.load(std::memory_order_relaxed))
+        {
+            // Try to queue the item.
+            if (this->TryPushSlot(tItem))
+            {
+                // Wake the consumer if it is sleeping.
+                this->NotifyConsumer();
+                return true;
+            }
+
+            // The channel is full, handle it based on policy.
+            switch (m_ePolicy)
+            {
+            case ChannelPolicy::eDropNewest:
+                // Throw out the new item.
+                m_nDroppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            case ChannelPolicy::eDropOldest:
+                // Throw out the oldest item and try again. If the consumer got to it first there is room now anyway.
+                if (this->TryPopSlot(nullptr))
+                {
+                    m_nDroppedCount.fetch_add(1, std::memory_order_relaxed);
+                    this->NotifyProducers();
+                }
+                break;
+            case ChannelPolicy::eBlock:
+            default:
+                // Wait for the consumer to make room.
+                this->WaitForSpace();
+                break;
+            }
+        }
+
+        // Channel was closed.
+        return false;
+    }
+
+    /******************************************************************************
+     * @brief Moves the oldest item out of the channel without blocking.
+     *
+     * @param tItem - Reference that the item will be moved into.
+     * @return true - An item was popped.
+     * @return false - The channel is empty.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool TryPop(T &tItem)
+    {
+        // Try to pop an item.
+        if (this->TryPopSlot(&tItem))
+        {
+            // Wake any producer waiting for room.
+            this->NotifyProducers();
+            return true;
+        }
+
+        return false;
+    }
+
+    /******************************************************************************
+     * @brief Moves the oldest item out of the channel, sleeping until one arrives,
+     *      the channel is closed, or the timeout expires. Calling this from
+     *      ThreadedContinuousCode() lets a consuming AutonomyThread wake on data
+     *      instead of polling. Keep the timeout short enough that the main loop still
+     *      notices a RequestStop() in time.
+     *
+     * @param tItem - Reference that the item will be moved into.
+     * @param tmTimeout - The max amount of time to wait for an item.
+     * @return true - An item was popped.
+     * @return false - The timeout expired or the channel is closed and empty.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool PopWait(T &tItem, const std::chrono::microseconds tmTimeout = std::chrono::microseconds(10000))
+    {
+        // Fast path, data is already waiting.
+        if (this->TryPop(tItem))
+        {
+            return true;
+        }
+
+        // Create instance variables.
+        bool bPopped = false;
+        std::chrono::steady_clock::time_point tmDeadline = std::chrono::steady_clock::now() + tmTimeout;
+
+        // Tell producers a consumer is about to sleep. This must be visible before we check for data one last time.
+        m_nConsumersWaiting.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        {
+            // Sleep until data arrives.
+            std::unique_lock<std::mutex> lkWaitLock(m_muWaitMutex);
+            while (!(bPopped = this->TryPop(tItem)) && !m_bClosed.load(std::memory_order_relaxed))
+            {
+                // Wait for a producer to notify us.
+                if (m_cdDataAvailable.wait_until(lkWaitLock, tmDeadline) == std::cv_status::timeout)
+                {
+                    // Check one last time.
+                    bPopped = this->TryPop(tItem);
+                    break;
+                }
+            }
+        }
+        m_nConsumersWaiting.fetch_sub(1, std::memory_order_relaxed);
+
+        return bPopped;
+    }
+
+    /******************************************************************************
+     * @brief Registers a waiter that is called once when data is available or the
+     *      channel is closed. Only the single consumer may register, and only one
+     *      waiter can be registered at a time.
+     *
+     * @param pWaiter - The waiter to call.
+     * @return true - The waiter is registered and will be called later.
+     * @return false - Data is already available or the channel is closed, the waiter was not registered.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool RegisterDataWaiter(ChannelDataWaiter *pWaiter)
+    {
+        // Publish the waiter before checking for data one last time.
+        m_pDataWaiter.store(pWaiter, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Check if data showed up or the channel closed while registering.
+        if (!this->Empty() || m_bClosed.load(std::memory_order_relaxed))
+        {
+            // Take the waiter back. If a producer already took it, it will be called so stay registered.
+            return m_pDataWaiter.exchange(nullptr, std::memory_order_acq_rel) != pWaiter;
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Closes the channel. Pushes fail after this and all sleeping threads
+     *      are woken. Items that are already queued can still be popped.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Close()
+    {
+        // Set closed toggle.
+        m_bClosed.store(true, std::memory_order_seq_cst);
+
+        // Wake a registered waiter.
+        this->WakeDataWaiter();
+
+        // Wake everyone.
+        std::lock_guard<std::mutex> lkWaitLock(m_muWaitMutex);
+        m_cdDataAvailable.notify_all();
+        m_cdSpaceAvailable.notify_all();
+    }
+
+    /******************************************************************************
+     * @brief Reopens a closed channel so it can be reused. Only call this when no
+     *      threads are pushing or popping.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Reopen()
+    {
+        // Clear closed toggle and counters.
+        m_bClosed.store(false, std::memory_order_seq_cst);
+        m_nDroppedCount.store(0, std::memory_order_relaxed);
+    }
+
+    /******************************************************************************
+     * @brief Check if the channel has been closed.
+     *
+     * @return true - The channel is closed.
+     * @return false - The channel is open.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsClosed() const { return m_bClosed.load(std::memory_order_relaxed); }
+
+    /******************************************************************************
+     * @brief Check if the channel is empty. This is only a snapshot, producers may
+     *      push right after it is taken.
+     *
+     * @return true - The channel has no items queued.
+     * @return false - The channel has items queued.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Empty() const { return this->GetSize() == 0; }
+
+    /******************************************************************************
+     * @brief Accessor for the approximate number of queued items.
+     *
+     * @return size_t - The number of items queued when this was called.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetSize() const
+    {
+        // Get indices.
+        size_t nHead = m_nHead.load(std::memory_order_acquire);
+        size_t nTail = m_nTail.load(std::memory_order_acquire);
+
+        return nTail > nHead ? nTail - nHead : 0;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Capacity private member.
+     *
+     * @return size_t - The max number of items the channel can hold.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetCapacity() const { return m_nMask + 1; }
+
+    /******************************************************************************
+     * @brief Accessor for the Dropped Count private member.
+     *
+     * @return uint64_t - The number of items thrown out by the eDropOldest or eDropNewest policies.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetDroppedCount() const { return m_nDroppedCount.load(std::memory_order_relaxed); }
+
+private:
+    /////////////////////////////////////////
+    // Declare private structs.
+    /////////////////////////////////////////
+
+    // A single ring buffer slot. The item is constructed in place so T doesn't need to be default constructible in the buffer.
+    struct Slot
+    {
+        std::atomic<size_t> nSequence;
+        alignas(T) unsigned char aStorage[sizeof(T)];
+    };
+
+    /////////////////////////////////////////
+    // Declare private class member variables.
+    /////////////////////////////////////////
+
+    // Producer and consumer indices each get their own cache line.
+    alignas(cachealign::nDestructiveSize) std::atomic<size_t> m_nTail = 0;
+    alignas(cachealign::nDestructiveSize) std::atomic<size_t> m_nHead = 0;
+    // Read-only after construction.
+    alignas(cachealign::nDestructiveSize) size_t m_nMask;
+    ChannelPolicy m_ePolicy;
+    std::unique_ptr<Slot[]> m_pSlots;
+    // Sleep/wake state. Only touched when a thread needs to sleep or somebody is sleeping.
+    alignas(cachealign::nDestructiveSize) std::atomic<int> m_nConsumersWaiting = 0;
+    std::atomic<int> m_nProducersWaiting = 0;
+    std::atomic_bool m_bClosed = false;
+    std::atomic<uint64_t> m_nDroppedCount = 0;
+    std::atomic<ChannelDataWaiter *> m_pDataWaiter = nullptr;
+    std::mutex m_muWaitMutex;
+    std::condition_variable m_cdDataAvailable;
+    std::condition_variable m_cdSpaceAvailable;
+
+    /////////////////////////////////////////
+    // Declare and define private methods.
+    /////////////////////////////////////////
+
+    /******************************************************************************
+     * @brief Claims the next free slot and moves the item into it.
+     *
+     * @param tItem - The item to move into the channel. Left untouched on failure.
+     * @return true - The item was queued.
+     * @return false - The channel is full.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool TryPushSlot(T &tItem)
+    {
+        // Create instance variables.
+        Slot *pSlot;
+        size_t nPosition = m_nTail.load(std::memory_order_relaxed);
+
+        // Loop until a slot is claimed or the buffer is full.
+        while (true)
+        {
+            // Check the slot at the current tail.
+            pSlot = &m_pSlots[nPosition & m_nMask];
+            size_t nSequence = pSlot->nSequence.load(std::memory_order_acquire);
+            intptr_t nDifference = intptr_t(nSequence) - intptr_t(nPosition);
+
+            // The slot is free for this position.
+            if (nDifference == 0)
+            {
+                // Multiple producers race for the slot, a single producer just takes it.
+                if constexpr (bMultiProducer)
+                {
+                    if (m_nTail.compare_exchange_weak(nPosition, nPosition + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    m_nTail.store(nPosition + 1, std::memory_order_relaxed);
+                    break;
+                }
+            }
+            // The slot still holds an item from the last lap, buffer is full.
+            else if (nDifference < 0)
+            {
+                return false;
+            }
+            // Another producer claimed this position, reload the tail.
+            else
+            {
+                nPosition = m_nTail.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Move the item into the slot and publish it to the consumer.
+        new (pSlot->aStorage) T(std::move(tItem));
+        pSlot->nSequence.store(nPosition + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Claims the oldest full slot and moves the item out of it. The head is
+     *      always advanced with a CAS, because with eDropOldest a producer may pop
+     *      at the same time as the consumer.
+     *
+     * @param pOutItem - Pointer that the item will be moved into. Pass nullptr to just destroy the item.
+     * @return true - An item was popped.
+     * @return false - The channel is empty.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool TryPopSlot(T *pOutItem)
+    {
+        // Create instance variables.
+        Slot *pSlot;
+        size_t nPosition = m_nHead.load(std::memory_order_relaxed);
+
+        // Loop until a slot is claimed or the buffer is empty.
+        while (true)
+        {
+            // Check the slot at the current head.
+            pSlot = &m_pSlots[nPosition & m_nMask];
+            size_t nSequence = pSlot->nSequence.load(std::memory_order_acquire);
+            intptr_t nDifference = intptr_t(nSequence) - intptr_t(nPosition + 1);
+
+            // The slot holds a published item for this position.
+            if (nDifference == 0)
+            {
+                if (m_nHead.compare_exchange_weak(nPosition, nPosition + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            // Nothing has been published here yet, buffer is empty.
+            else if (nDifference < 0)
+            {
+                return false;
+            }
+            // Somebody else popped this position, reload the head.
+            else
+            {
+                nPosition = m_nHead.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Move the item out and hand the slot back to the producers for the next lap.
+        T *pItem = std::launder(reinterpret_cast<T *>(pSlot->aStorage));
+        if (pOutItem != nullptr)
+        {
+            *pOutItem = std::move(*pItem);
+        }
+        pItem->~T();
+        pSlot->nSequence.store(nPosition + m_nMask + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Wakes the consumer if it is sleeping in PopWait(). The fence pairs with
+     *      the one in PopWait() so either the consumer sees the new item or we see
+     *      that it is waiting.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void NotifyConsumer()
+    {
+        // Make the published item visible before checking for sleepers.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_nConsumersWaiting.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lkWaitLock(m_muWaitMutex);
+            m_cdDataAvailable.notify_one();
+        }
+
+        // Wake a registered waiter.
+        this->WakeDataWaiter();
+    }
+
+    /******************************************************************************
+     * @brief Calls the registered data waiter, if there is one. The waiter is
+     *      unregistered first so it is only ever called once.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void WakeDataWaiter()
+    {
+        // Cheap check first, most channels never have a waiter.
+        if (m_pDataWaiter.load(std::memory_order_relaxed) != nullptr)
+        {
+            // Take the waiter so nobody else calls it.
+            ChannelDataWaiter *pWaiter = m_pDataWaiter.exchange(nullptr, std::memory_order_acq_rel);
+            if (pWaiter != nullptr)
+            {
+                pWaiter->OnDataAvailable();
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Wakes any producers sleeping in WaitForSpace().
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void NotifyProducers()
+    {
+        // Make the freed slot visible before checking for sleepers.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_nProducersWaiting.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lkWaitLock(m_muWaitMutex);
+            m_cdSpaceAvailable.notify_all();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Puts a producer to sleep until the consumer frees a slot. Spins briefly
+     *      first since a fast consumer usually frees one within a few microseconds.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void WaitForSpace()
+    {
+        // Give the consumer a moment before paying for a sleep.
+        for (int nIter = 0; nIter < 64; ++nIter)
+        {
+            if (this->GetSize() <= m_nMask)
+            {
+                return;
+            }
+            std::this_thread::yield();
+        }
+
+        // Tell the consumer a producer is about to sleep.
+        m_nProducersWaiting.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        {
+            // Sleep until there is room. The timeout covers a push that raced with the last pop.
+            std::unique_lock<std::mutex> lkWaitLock(m_muWaitMutex);
+            m_cdSpaceAvailable.wait_for(lkWaitLock,
+                                        std::chrono::milliseconds(1),
+                                        [this] { return this->GetSize() <= m_nMask || m_bClosed.load(std::memory_order_relaxed); });
+        }
+        m_nProducersWaiting.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+// Convenience aliases for the two supported producer configurations.
+template <typename T>
+using SPSCChannel = Channel<T, false>;
+template <typename T>
+using MPSCChannel = Channel<T, true>;
+
+#endif
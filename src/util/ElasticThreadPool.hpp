@@ -0,0 +1,644 @@
+/******************************************************************************
+ * @brief Defines and implements a thread pool that can grow and shrink while
+ *      tasks are queued and running.
+ *
+ * @file ElasticThreadPool.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef ELASTIC_THREAD_POOL_HPP
+#define ELASTIC_THREAD_POOL_HPP
+
+#include "ThreadStack.hpp"
+
+/// \cond
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief A FIFO thread pool whose size can change at any time. Resize() returns
+ *      right away. Growing starts new workers that join in on the queue. Shrinking
+ *      lowers the target, and each extra worker leaves the next time it is between
+ *      tasks. Nothing is purged and no running task is waited on, so queued work
+ *      is never lost and a resize takes the same time however long the tasks are.
+ *
+ *      Retired workers are joined the next time the pool is resized or destroyed.
+ *      They have already left their loop by then, so the join doesn't block.
+ *
+ *      The queue is unbounded by default. SetQueueCapacity() bounds it, and a
+ *      QueueFullPolicy decides whether a submitter that finds it full waits, has
+ *      its task rejected, or runs the task itself.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class ElasticThreadPool
+{
+public:
+    /////////////////////////////////////////
+    // Define public enumerators specific to this class.
+    /////////////////////////////////////////
+
+    // What DetachTask() does when a bounded queue is full.
+    enum QueueFullPolicy
+    {
+        eBlock,         // Wait for a worker to take a task. Workers queueing into their own pool run the task instead.
+        eReject,        // Drop the task and return false.
+        eCallerRuns     // Run the task on the calling thread.
+    };
+
+    /******************************************************************************
+     * @brief Construct a new Elastic Thread Pool object.
+     *
+     * @param nNumThreads - The number of workers to start with.
+     * @param nStackSize - Stack size of each worker in bytes. 0 uses the system default.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    explicit ElasticThreadPool(const unsigned int nNumThreads, const size_t nStackSize = 0) : m_nStackSize(nStackSize) { this->Resize(nNumThreads); }
+
+    ElasticThreadPool(const ElasticThreadPool &) = delete;
+    ElasticThreadPool &operator=(const ElasticThreadPool &) = delete;
+
+    /******************************************************************************
+     * @brief Destroy the Elastic Thread Pool object. Waits for queued and running
+     *      tasks like BS::thread_pool does, then stops every worker.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ~ElasticThreadPool()
+    {
+        // Finish the queue, then retire everyone.
+        this->Wait();
+        this->StopWorkers();
+    }
+
+    /******************************************************************************
+     * @brief Queues a task without a way to get its result. If the queue is bounded
+     *      and full, the queue full policy decides what happens to it. A full queue
+     *      that is paused never drains, so it rejects the task whatever the policy
+     *      says, and a blocked caller is let go as soon as the pool is paused. A
+     *      rejected task is not moved from, so the caller can still run it.
+     *
+     * @tparam F - The type of the callable. Must be copyable.
+     * @param fnTask - The callable to run. Takes no arguments.
+     * @return true - The task was queued, or run by the caller.
+     * @return false - The queue was full and the task was rejected, or the pool was paused while full.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+    bool DetachTask(F &&fnTask)
+    {
+        {
+            std::unique_lock<std::mutex> lkPoolLock(m_muPoolMutex);
+
+            // Check if the queue is full.
+            if (m_nQueueCapacity > 0 && m_dqTasks.size() >= m_nQueueCapacity)
+            {
+                // A worker blocking on its own pool could wait for itself, it runs the task instead.
+                QueueFullPolicy ePolicy = m_ePolicy == eBlock && GetCurrentPool() == this ? eCallerRuns : m_ePolicy;
+                // Nothing leaves a paused queue, its owner is stopping or clearing it, so don't wait or run anything.
+                if (ePolicy == eReject || m_bPaused)
+                {
+                    ++m_nRejectedTasks;
+                    return false;
+                }
+                else if (ePolicy == eCallerRuns)
+                {
+                    ++m_nCallerRunTasks;
+                    lkPoolLock.unlock();
+                    fnTask();
+                    return true;
+                }
+
+                // Wait for room, or give up if the pool is paused, the owner is stopping or clearing it.
+                m_cvSpaceAvailable.wait(lkPoolLock, [this]() { return m_bPaused || m_nQueueCapacity == 0 || m_dqTasks.size() < m_nQueueCapacity; });
+                if (m_nQueueCapacity > 0 && m_dqTasks.size() >= m_nQueueCapacity)
+                {
+                    ++m_nRejectedTasks;
+                    return false;
+                }
+            }
+
+            m_dqTasks.emplace_back(std::forward<F>(fnTask));
+            m_nPeakTasksQueued = std::max(m_nPeakTasksQueued, m_dqTasks.size());
+        }
+        m_cvTaskAvailable.notify_one();
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Queues a task and returns a future for its result. Exceptions thrown
+     *      by the task are stored in the future. If a full queue rejects the task, the
+     *      future holds a std::future_error with broken_promise.
+     *
+     * @tparam F - The type of the callable. Must be copyable.
+     * @param fnTask - The callable to run. Takes no arguments.
+     * @return std::future<R> - The result of the callable.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F, typename R = std::invoke_result_t<std::decay_t<F>>>
+    std::future<R> SubmitTask(F &&fnTask)
+    {
+        // Create instance variables.
+        std::shared_ptr<std::promise<R>> spPromise = std::make_shared<std::promise<R>>();
+        std::future<R> fuResult = spPromise->get_future();
+
+        // Queue the task, completing the promise from the worker.
+        this->DetachTask(
+            [spPromise, fnTask = std::forward<F>(fnTask)]() mutable
+            {
+                try
+                {
+                    if constexpr (std::is_void_v<R>)
+                    {
+                        fnTask();
+                        spPromise->set_value();
+                    }
+                    else
+                    {
+                        spPromise->set_value(fnTask());
+                    }
+                }
+                catch (...)
+                {
+                    spPromise->set_exception(std::current_exception());
+                }
+            });
+
+        return fuResult;
+    }
+
+    /******************************************************************************
+     * @brief Changes the number of workers without waiting for anything. Queued
+     *      tasks stay queued and running tasks keep running.
+     *
+     * @param nNumThreads - The new number of workers. At least one is kept.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Resize(unsigned int nNumThreads)
+    {
+        // Create instance variables.
+        std::vector<threadstack::StackSizedThread> vExited;
+        nNumThreads = nNumThreads > 0 ? nNumThreads : 1;
+
+        {
+            std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+            m_nTargetThreads = nNumThreads;
+
+            // Collect workers that have already left.
+            vExited.swap(m_vExitedThreads);
+
+            // Start workers until the target is met. The stack size is set per worker, no process wide default is touched.
+            while (m_nLiveThreads < m_nTargetThreads)
+            {
+                m_vThreads.emplace_back(m_nStackSize, [this]() { this->WorkerLoop(); });
+                ++m_nLiveThreads;
+            }
+        }
+
+        // Extra workers retire when they are next between tasks.
+        m_cvTaskAvailable.notify_all();
+
+        // These have already returned from their loop.
+        for (threadstack::StackSizedThread &thExited : vExited)
+        {
+            thExited.Join();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Waits for the running tasks to finish, then replaces every worker with
+     *      a new one. Unlike BS::thread_pool::reset(), queued tasks are kept. Used to
+     *      apply a new stack size.
+     *
+     * @param nNumThreads - The number of workers afterwards.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Reset(const unsigned int nNumThreads)
+    {
+        // Hold the queue while the workers are swapped.
+        bool bWasPaused;
+        {
+            std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+            bWasPaused = m_bPaused;
+            m_bPaused = true;
+        }
+        this->Wait();
+        this->StopWorkers();
+
+        // Start fresh workers and restore the pause state.
+        {
+            std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+            m_bPaused = bWasPaused;
+        }
+        this->Resize(nNumThreads);
+    }
+
+    /******************************************************************************
+     * @brief Mutator for the Stack Size private member. Only workers started after
+     *      this call get the new size, use Reset() to replace the current ones.
+     *
+     * @param nBytes - Stack size of each worker in bytes. 0 uses the system default.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetStackSize(const size_t nBytes)
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        m_nStackSize = nBytes;
+    }
+
+    /******************************************************************************
+     * @brief Bounds the queue. Tasks that are already queued are kept even if there
+     *      are more of them than the new capacity.
+     *
+     * @param nCapacity - The most tasks that can wait in the queue. 0 for unbounded.
+     * @param ePolicy - What to do with a task that doesn't fit.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetQueueCapacity(const size_t nCapacity, const QueueFullPolicy ePolicy = eBlock)
+    {
+        {
+            std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+            m_nQueueCapacity = nCapacity;
+            m_ePolicy = ePolicy;
+        }
+        m_cvSpaceAvailable.notify_all();
+    }
+
+    /******************************************************************************
+     * @brief Zeroes the peak queue length and the rejected and caller run counts.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void ResetQueueStatistics()
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        m_nPeakTasksQueued = m_dqTasks.size();
+        m_nRejectedTasks = 0;
+        m_nCallerRunTasks = 0;
+    }
+
+    /******************************************************************************
+     * @brief Stops workers from taking new tasks. Running tasks finish.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Pause()
+    {
+        {
+            std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+            m_bPaused = true;
+        }
+        // Blocked submitters would wait on a queue that no longer drains.
+        m_cvSpaceAvailable.notify_all();
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the paused state.
+     *
+     * @return true - Workers don't take new tasks.
+     * @return false - Workers take tasks.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsPaused() const
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        return m_bPaused;
+    }
+
+    /******************************************************************************
+     * @brief Lets workers take tasks again.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Unpause()
+    {
+        {
+            std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+            m_bPaused = false;
+        }
+        m_cvTaskAvailable.notify_all();
+    }
+
+    /******************************************************************************
+     * @brief Drops every task that hasn't started.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Purge()
+    {
+        {
+            std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+            m_dqTasks.clear();
+        }
+        m_cvTasksDone.notify_all();
+        m_cvSpaceAvailable.notify_all();
+    }
+
+    /******************************************************************************
+     * @brief Blocks until no task is running and the queue is empty, or only
+     *      running tasks are left if the pool is paused.
+     *
+     * @note Throws std::logic_error if called from one of this pool's workers, that
+     *      would wait for itself forever.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Wait()
+    {
+        // Check for a worker waiting on its own pool.
+        if (GetCurrentPool() == this)
+        {
+            throw std::logic_error("ElasticThreadPool::Wait() called from one of its own workers.");
+        }
+
+        std::unique_lock<std::mutex> lkPoolLock(m_muPoolMutex);
+        m_cvTasksDone.wait(lkPoolLock, [this]() { return m_nTasksRunning == 0 && (m_bPaused || m_dqTasks.empty()); });
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Target Threads private member.
+     *
+     * @return unsigned int - The number of workers the pool is sized for. Retiring
+     *                      workers may still be finishing a task.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    unsigned int GetThreadCount() const
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        return m_nTargetThreads;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the number of workers that haven't retired yet.
+     *
+     * @return unsigned int - Workers still in their loop.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    unsigned int GetLiveThreadCount() const
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        return m_nLiveThreads;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the number of queued tasks.
+     *
+     * @return size_t - Tasks that haven't started.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetTasksQueued() const
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        return m_dqTasks.size();
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the number of running tasks.
+     *
+     * @return size_t - Tasks a worker is executing.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetTasksRunning() const
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        return m_nTasksRunning;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the number of unfinished tasks.
+     *
+     * @return size_t - Queued plus running tasks.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetTasksTotal() const
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        return m_nTasksRunning + m_dqTasks.size();
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Peak Tasks Queued private member.
+     *
+     * @return size_t - The longest the queue has been since the last ResetQueueStatistics().
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetPeakTasksQueued() const
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        return m_nPeakTasksQueued;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Rejected Tasks private member.
+     *
+     * @return uint64_t - Tasks dropped by a full queue since the last ResetQueueStatistics().
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetRejectedTaskCount() const
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        return m_nRejectedTasks;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Caller Run Tasks private member.
+     *
+     * @return uint64_t - Tasks run by the submitting thread since the last ResetQueueStatistics().
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetCallerRunTaskCount() const
+    {
+        std::lock_guard<std::mutex> lkPoolLock(m_muPoolMutex);
+        return m_nCallerRunTasks;
+    }
+
+private:
+    // Declare private member variables.
+    mutable std::mutex m_muPoolMutex;
+    std::condition_variable m_cvTaskAvailable;
+    std::condition_variable m_cvTasksDone;
+    std::condition_variable m_cvSpaceAvailable;
+    std::deque<std::function<void()>> m_dqTasks;
+    std::vector<threadstack::StackSizedThread> m_vThreads;
+    std::vector<threadstack::StackSizedThread> m_vExitedThreads;
+    unsigned int m_nTargetThreads = 0;
+    unsigned int m_nLiveThreads = 0;
+    size_t m_nTasksRunning = 0;
+    size_t m_nStackSize;
+    bool m_bPaused = false;
+    // Bounded queue settings and statistics.
+    size_t m_nQueueCapacity = 0;
+    QueueFullPolicy m_ePolicy = eBlock;
+    size_t m_nPeakTasksQueued = 0;
+    uint64_t m_nRejectedTasks = 0;
+    uint64_t m_nCallerRunTasks = 0;
+
+    /******************************************************************************
+     * @brief Accessor for the pool the calling thread works for.
+     *
+     * @return ElasticThreadPool*& - The pool, or nullptr outside of a worker.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static ElasticThreadPool *&GetCurrentPool()
+    {
+        thread_local ElasticThreadPool *pCurrentPool = nullptr;
+        return pCurrentPool;
+    }
+
+    /******************************************************************************
+     * @brief Retires every worker and joins them. Running tasks finish first.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void StopWorkers()
+    {
+        // Create instance variables.
+        std::vector<threadstack::StackSizedThread> vExited;
+
+        // Lower the target to nothing and wake everyone.
+        std::unique_lock<std::mutex> lkPoolLock(m_muPoolMutex);
+        m_nTargetThreads = 0;
+        lkPoolLock.unlock();
+        m_cvTaskAvailable.notify_all();
+
+        // Wait for every worker to leave its loop.
+        lkPoolLock.lock();
+        m_cvTasksDone.wait(lkPoolLock, [this]() { return m_nLiveThreads == 0; });
+        vExited.swap(m_vExitedThreads);
+        lkPoolLock.unlock();
+
+        for (threadstack::StackSizedThread &thExited : vExited)
+        {
+            thExited.Join();
+        }
+    }
+
+    /******************************************************************************
+     * @brief The loop each worker runs. Takes tasks from the front of the queue
+     *      and leaves when there are more workers than the target.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void WorkerLoop()
+    {
+        // Create instance variables.
+        GetCurrentPool() = this;
+        std::unique_lock<std::mutex> lkPoolLock(m_muPoolMutex);
+
+        while (true)
+        {
+            // Sleep until there is work or too many workers.
+            m_cvTaskAvailable.wait(lkPoolLock, [this]() { return m_nLiveThreads > m_nTargetThreads || (!m_bPaused && !m_dqTasks.empty()); });
+
+            // Retire between tasks, so nothing queued or running is dropped.
+            if (m_nLiveThreads > m_nTargetThreads)
+            {
+                break;
+            }
+
+            // Run the next task without the lock.
+            std::function<void()> fnTask = std::move(m_dqTasks.front());
+            m_dqTasks.pop_front();
+            ++m_nTasksRunning;
+            bool bBounded = m_nQueueCapacity > 0;
+            lkPoolLock.unlock();
+            // Let a blocked submitter in.
+            if (bBounded)
+            {
+                m_cvSpaceAvailable.notify_one();
+            }
+            fnTask();
+            fnTask = nullptr;
+            lkPoolLock.lock();
+            --m_nTasksRunning;
+
+            // Wake anyone waiting for the pool to drain.
+            if (m_nTasksRunning == 0 && (m_bPaused || m_dqTasks.empty()))
+            {
+                m_cvTasksDone.notify_all();
+            }
+        }
+
+        // Hand this thread over to be joined and drop out of the list.
+        --m_nLiveThreads;
+        for (std::vector<threadstack::StackSizedThread>::iterator itThread = m_vThreads.begin(); itThread != m_vThreads.end(); ++itThread)
+        {
+            if (itThread->IsCurrentThread())
+            {
+                m_vExitedThreads.emplace_back(std::move(*itThread));
+                m_vThreads.erase(itThread);
+                break;
+            }
+        }
+        m_cvTasksDone.notify_all();
+        GetCurrentPool() = nullptr;
+    }
+};
+
+#endif
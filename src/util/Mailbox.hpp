@@ -0,0 +1,336 @@
+/******************************************************************************
+ * @brief Defines and implements a lock-free latest-value mailbox used to share
+ *      the newest frame or pose between threads without a queue.
+ *
+ * @file Mailbox.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef MAILBOX_HPP
+#define MAILBOX_HPP
+
+#include "CacheAlignment.hpp"
+
+/// \cond
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief A mailbox that only ever holds the newest value. With one reader this
+ *      is a classic triple buffer, with N readers it keeps N + 2 buffers.
+ *
+ *      The producer always writes into a buffer that no reader holds and is not
+ *      the current value, then publishes it with a single atomic store. It never
+ *      waits on readers, no matter how long they hold a value. Readers pin the
+ *      newest buffer with a reference count and read it in place, so large values
+ *      like images are never copied and a reader always sees a complete value.
+ *
+ *      Only ONE thread may publish. At most nMaxReaders ReadHandles may be alive
+ *      at once, otherwise the producer may run out of free buffers and has to spin.
+ *
+ * @tparam T - The type of the value. Must be default constructible.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+template <typename T>
+class LatestValueMailbox
+{
+private:
+    /////////////////////////////////////////
+    // Declare private structs.
+    /////////////////////////////////////////
+
+    // A single buffer. The reader count gets its own cache line since every reader writes it.
+    struct Buffer
+    {
+        alignas(cachealign::nDestructiveSize) std::atomic<int> nReaders = 0;
+        uint64_t nSequence = 0;
+        T tValue;
+    };
+
+public:
+    /******************************************************************************
+     * @brief A pinned view of the value that was newest when Read() was called.
+     *      The buffer stays untouched by the producer until the handle is destroyed.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    class ReadHandle
+    {
+    public:
+        /******************************************************************************
+         * @brief Construct a new, empty Read Handle object.
+         *
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        ReadHandle() = default;
+
+        /******************************************************************************
+         * @brief Construct a new Read Handle object by taking over another one.
+         *
+         * @param stOther - The handle to take the pinned buffer from.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        ReadHandle(ReadHandle &&stOther) noexcept : m_pBuffer(std::exchange(stOther.m_pBuffer, nullptr)) {}
+
+        /******************************************************************************
+         * @brief Releases the currently pinned buffer and takes over another handle's.
+         *
+         * @param stOther - The handle to take the pinned buffer from.
+         * @return ReadHandle& - A reference to this object.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        ReadHandle &operator=(ReadHandle &&stOther) noexcept
+        {
+            // Check for self assignment.
+            if (this != &stOther)
+            {
+                this->Release();
+                m_pBuffer = std::exchange(stOther.m_pBuffer, nullptr);
+            }
+
+            return *this;
+        }
+
+        // Handles pin a buffer, copying one would release it twice.
+        ReadHandle(const ReadHandle &) = delete;
+        ReadHandle &operator=(const ReadHandle &) = delete;
+
+        /******************************************************************************
+         * @brief Destroy the Read Handle object and unpin the buffer.
+         *
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        ~ReadHandle() { this->Release(); }
+
+        /******************************************************************************
+         * @brief Unpins the buffer early. The handle is empty afterwards.
+         *
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        void Release()
+        {
+            // Check if a buffer is pinned.
+            if (m_pBuffer != nullptr)
+            {
+                m_pBuffer->nReaders.fetch_sub(1, std::memory_order_release);
+                m_pBuffer = nullptr;
+            }
+        }
+
+        /******************************************************************************
+         * @brief Check if the handle holds a value. It is empty if nothing has been
+         *      published yet.
+         *
+         * @return true - The handle holds a value.
+         * @return false - The handle is empty.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        bool IsValid() const { return m_pBuffer != nullptr; }
+
+        /******************************************************************************
+         * @brief Accessor for the pinned value.
+         *
+         * @return const T& - The value. Only valid while this handle is alive.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        const T &Get() const { return m_pBuffer->tValue; }
+
+        /******************************************************************************
+         * @brief Accessor for the sequence number of the pinned value. The first
+         *      published value is 1.
+         *
+         * @return uint64_t - The sequence number, or 0 if the handle is empty.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        uint64_t GetSequence() const { return m_pBuffer != nullptr ? m_pBuffer->nSequence : 0; }
+
+    private:
+        // Only the mailbox can pin buffers.
+        friend class LatestValueMailbox<T>;
+        ReadHandle(Buffer *pBuffer) : m_pBuffer(pBuffer) {}
+
+        // Declare private member variables.
+        Buffer *m_pBuffer = nullptr;
+    };
+
+    /////////////////////////////////////////
+    // Declare and define public class methods.
+    /////////////////////////////////////////
+
+    /******************************************************************************
+     * @brief Construct a new Latest Value Mailbox object.
+     *
+     * @param nMaxReaders - The max number of ReadHandles alive at the same time.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    LatestValueMailbox(const int nMaxReaders = 1)
+    {
+        // One buffer per reader, one for the newest value and one for the producer.
+        m_nBufferCount = (nMaxReaders > 0 ? nMaxReaders : 1) + 2;
+        m_pBuffers = std::make_unique<Buffer[]>(m_nBufferCount);
+        m_nWriteIndex = 0;
+    }
+
+    // Readers hold pointers into the buffers.
+    LatestValueMailbox(const LatestValueMailbox &) = delete;
+    LatestValueMailbox &operator=(const LatestValueMailbox &) = delete;
+
+    /******************************************************************************
+     * @brief Accessor for the buffer the producer should fill next. The buffer
+     *      holds an older value, so containers and images can reuse their memory.
+     *      Call Publish() once it is filled.
+     *
+     * @return T& - The buffer to write into.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    T &BeginWrite() { return m_pBuffers[m_nWriteIndex].tValue; }
+
+    /******************************************************************************
+     * @brief Publishes the buffer returned by BeginWrite() as the newest value and
+     *      picks a free buffer for the next write. Never waits on readers.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Publish()
+    {
+        // Stamp and publish the buffer.
+        m_pBuffers[m_nWriteIndex].nSequence = m_nPublishCount.load(std::memory_order_relaxed) + 1;
+        m_nLatestIndex.store(m_nWriteIndex, std::memory_order_seq_cst);
+        m_nPublishCount.fetch_add(1, std::memory_order_release);
+
+        // Find a buffer that is neither the newest value nor pinned by a reader. One always exists unless there are too many readers.
+        int nCandidate = m_nWriteIndex;
+        do
+        {
+            nCandidate = (nCandidate + 1) % m_nBufferCount;
+            if (nCandidate == m_nWriteIndex)
+            {
+                // Every buffer is pinned, more readers than promised. Let them finish.
+                std::this_thread::yield();
+            }
+        } while (nCandidate == m_nLatestIndex.load(std::memory_order_relaxed) || m_pBuffers[nCandidate].nReaders.load(std::memory_order_seq_cst) != 0);
+
+        // Start writing to the free buffer.
+        m_nWriteIndex = nCandidate;
+    }
+
+    /******************************************************************************
+     * @brief Moves a value into the mailbox and publishes it.
+     *
+     * @param tValue - The new value.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Publish(T &&tValue)
+    {
+        this->BeginWrite() = std::move(tValue);
+        this->Publish();
+    }
+
+    /******************************************************************************
+     * @brief Copies a value into the mailbox and publishes it.
+     *
+     * @param tValue - The new value.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Publish(const T &tValue)
+    {
+        this->BeginWrite() = tValue;
+        this->Publish();
+    }
+
+    /******************************************************************************
+     * @brief Pins the newest value. If the producer replaces the value between
+     *      looking it up and pinning it, the lookup is retried.
+     *
+     * @return ReadHandle - A handle to the newest value, empty if nothing has been published.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ReadHandle Read()
+    {
+        // Check if anything has been published.
+        if (m_nPublishCount.load(std::memory_order_acquire) == 0)
+        {
+            return ReadHandle();
+        }
+
+        // Loop until the newest buffer is pinned.
+        while (true)
+        {
+            // Pin the newest buffer.
+            int nIndex = m_nLatestIndex.load(std::memory_order_seq_cst);
+            m_pBuffers[nIndex].nReaders.fetch_add(1, std::memory_order_seq_cst);
+
+            // If it is still the newest value, the producer can't have picked it for writing.
+            if (m_nLatestIndex.load(std::memory_order_seq_cst) == nIndex)
+            {
+                return ReadHandle(&m_pBuffers[nIndex]);
+            }
+
+            // The producer moved on, unpin and try again.
+            m_pBuffers[nIndex].nReaders.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Publish Count private member.
+     *
+     * @return uint64_t - The number of values published so far. Also the sequence of the newest value.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetPublishCount() const { return m_nPublishCount.load(std::memory_order_acquire); }
+
+private:
+    /////////////////////////////////////////
+    // Declare private class member variables.
+    /////////////////////////////////////////
+
+    // Read by every reader, written by the producer on publish.
+    alignas(cachealign::nDestructiveSize) std::atomic<int> m_nLatestIndex = 0;
+    std::atomic<uint64_t> m_nPublishCount = 0;
+    // Only touched by the producer.
+    alignas(cachealign::nDestructiveSize) int m_nWriteIndex;
+    int m_nBufferCount;
+    std::unique_ptr<Buffer[]> m_pBuffers;
+};
+
+#endif
@@ -0,0 +1,311 @@
+/******************************************************************************
+ * @brief Defines and implements a deterministic 64-bit Miller-Rabin primality
+ *      test using Montgomery multiplication.
+ *
+ * @file MillerRabin.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef MILLER_RABIN_HPP
+#define MILLER_RABIN_HPP
+
+#include "PrimalityKernel.hpp"
+
+/// \cond
+#include <cstdint>
+#include <limits>
+
+/// \endcond
+
+namespace primality
+{
+    /******************************************************************************
+     * @brief Multiplies two 64-bit numbers into a 128-bit product.
+     *
+     * @param nA - The first factor.
+     * @param nB - The second factor.
+     * @param nHigh - Receives the upper 64 bits of the product.
+     * @return uint64_t - The lower 64 bits of the product.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline uint64_t MultiplyWide(uint64_t nA, uint64_t nB, uint64_t &nHigh)
+    {
+#ifdef __SIZEOF_INT128__
+        // Let the compiler use the native 64x64 -> 128 multiply. __extension__ keeps pedantic builds quiet about the non-standard type.
+        __extension__ typedef unsigned __int128 uint128;
+        uint128 nProduct = static_cast<uint128>(nA) * nB;
+        nHigh = uint64_t(nProduct >> 64);
+        return uint64_t(nProduct);
+#else
+        // Schoolbook multiply on 32-bit halves.
+        uint64_t nALow = nA & 0xFFFFFFFF, nAHigh = nA >> 32;
+        uint64_t nBLow = nB & 0xFFFFFFFF, nBHigh = nB >> 32;
+        uint64_t nLowLow = nALow * nBLow;
+        uint64_t nHighLow = nAHigh * nBLow;
+        uint64_t nLowHigh = nALow * nBHigh;
+        uint64_t nCross = (nLowLow >> 32) + (nHighLow & 0xFFFFFFFF) + nLowHigh;
+        nHigh = nAHigh * nBHigh + (nHighLow >> 32) + (nCross >> 32);
+        return (nCross << 32) | (nLowLow & 0xFFFFFFFF);
+#endif
+    }
+
+    /******************************************************************************
+     * @brief Montgomery arithmetic modulo an odd 64-bit number. Numbers are kept
+     *      in Montgomery form (a * 2^64 mod n) so that modular multiplication only
+     *      needs multiplies, a subtract and a compare instead of a 128-bit division.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    class Montgomery64
+    {
+    public:
+        /******************************************************************************
+         * @brief Construct a new Montgomery 64 object.
+         *
+         * @param nModulus - The modulus. Must be odd.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        Montgomery64(uint64_t nModulus) : m_nModulus(nModulus)
+        {
+            // Newton's iteration for n^-1 mod 2^64, each step doubles the correct bits.
+            m_nInverse = nModulus;
+            for (int nIter = 0; nIter < 5; ++nIter)
+            {
+                m_nInverse *= 2 - nModulus * m_nInverse;
+            }
+
+            // 2^64 mod n is one in Montgomery form.
+            m_nOne = (0 - nModulus) % nModulus;
+            // 2^128 mod n converts into Montgomery form. Get it by doubling 2^64 mod n another 64 times without overflowing.
+            m_nRSquared = m_nOne;
+            for (int nIter = 0; nIter < 64; ++nIter)
+            {
+                m_nRSquared = m_nRSquared >= nModulus - m_nRSquared ? m_nRSquared - (nModulus - m_nRSquared) : m_nRSquared + m_nRSquared;
+            }
+        }
+
+        /******************************************************************************
+         * @brief Converts a number into Montgomery form.
+         *
+         * @param nValue - The number.
+         * @return uint64_t - The number times 2^64 mod n.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        uint64_t ToMontgomery(uint64_t nValue) const { return this->Multiply(nValue % m_nModulus, m_nRSquared); }
+
+        /******************************************************************************
+         * @brief Multiplies two numbers in Montgomery form.
+         *
+         * @param nA - The first factor.
+         * @param nB - The second factor.
+         * @return uint64_t - The product in Montgomery form.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        uint64_t Multiply(uint64_t nA, uint64_t nB) const
+        {
+            uint64_t nHigh = 0;
+            uint64_t nLow = MultiplyWide(nA, nB, nHigh);
+            return this->Reduce(nHigh, nLow);
+        }
+
+        /******************************************************************************
+         * @brief Raises a number in Montgomery form to a power.
+         *
+         * @param nBase - The base in Montgomery form.
+         * @param nExponent - The exponent.
+         * @return uint64_t - The result in Montgomery form.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        uint64_t Power(uint64_t nBase, uint64_t nExponent) const
+        {
+            // Square and multiply.
+            uint64_t nResult = m_nOne;
+            while (nExponent > 0)
+            {
+                if (nExponent & 1)
+                {
+                    nResult = this->Multiply(nResult, nBase);
+                }
+                nBase = this->Multiply(nBase, nBase);
+                nExponent >>= 1;
+            }
+
+            return nResult;
+        }
+
+        /******************************************************************************
+         * @brief Accessor for one in Montgomery form.
+         *
+         * @return uint64_t - 2^64 mod n.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        uint64_t GetOne() const { return m_nOne; }
+
+        /******************************************************************************
+         * @brief Accessor for minus one in Montgomery form.
+         *
+         * @return uint64_t - n - (2^64 mod n).
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        uint64_t GetMinusOne() const { return m_nModulus - m_nOne; }
+
+    private:
+        // Declare private member variables.
+        uint64_t m_nModulus;
+        uint64_t m_nInverse;
+        uint64_t m_nOne;
+        uint64_t m_nRSquared;
+
+        /******************************************************************************
+         * @brief Montgomery reduction. Divides a 128-bit number by 2^64 modulo n.
+         *
+         * @param nHigh - The upper 64 bits. Must be less than n.
+         * @param nLow - The lower 64 bits.
+         * @return uint64_t - The reduced number in [0, n).
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        uint64_t Reduce(uint64_t nHigh, uint64_t nLow) const
+        {
+            // q * n has the same lower 64 bits as the input, so only the upper halves need subtracting.
+            uint64_t nQuotient = nLow * m_nInverse;
+            uint64_t nProductHigh = 0;
+            MultiplyWide(nQuotient, m_nModulus, nProductHigh);
+            return nHigh >= nProductHigh ? nHigh - nProductHigh : nHigh - nProductHigh + m_nModulus;
+        }
+    };
+
+    /******************************************************************************
+     * @brief Deterministic Miller-Rabin test for any 64-bit number. The seven
+     *      bases used have no strong pseudoprime below 2^64.
+     *
+     * @param nNum - The number to test.
+     * @return true - The number is prime.
+     * @return false - The number is not prime.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline bool IsPrime64(uint64_t nNum)
+    {
+        // Handle small numbers and small factors with plain division, it is cheaper than a full test.
+        constexpr uint64_t aSmallPrimes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+        if (nNum < 2)
+        {
+            return false;
+        }
+        for (uint64_t nPrime : aSmallPrimes)
+        {
+            if (nNum % nPrime == 0)
+            {
+                return nNum == nPrime;
+            }
+        }
+        // Anything left below 41^2 has no small factor and must be prime.
+        if (nNum < 41 * 41)
+        {
+            return true;
+        }
+
+        // Write n - 1 as d * 2^s with d odd.
+        uint64_t nOddPart = nNum - 1;
+        int nTwos = 0;
+        while ((nOddPart & 1) == 0)
+        {
+            nOddPart >>= 1;
+            ++nTwos;
+        }
+
+        // Run a strong probable prime test for every base.
+        constexpr uint64_t aBases[] = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+        Montgomery64 stMont(nNum);
+        for (uint64_t nBase : aBases)
+        {
+            // A base that is a multiple of n says nothing.
+            if (nBase % nNum == 0)
+            {
+                continue;
+            }
+
+            // x = a^d, n passes this base if x is 1, or x reaches -1 by squaring.
+            uint64_t nValue = stMont.Power(stMont.ToMontgomery(nBase), nOddPart);
+            if (nValue == stMont.GetOne() || nValue == stMont.GetMinusOne())
+            {
+                continue;
+            }
+            bool bPassed = false;
+            for (int nIter = 1; nIter < nTwos && !bPassed; ++nIter)
+            {
+                nValue = stMont.Multiply(nValue, nValue);
+                bPassed = nValue == stMont.GetMinusOne();
+            }
+            if (!bPassed)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Tests a batch of 64-bit candidates. Batches that fit in 32 bits go
+     *      through the SIMD kernel, anything larger is tested with Miller-Rabin.
+     *
+     * @param pCandidates - The candidates to test.
+     * @param nCount - The number of candidates. Must be at most nBatchSize.
+     * @param bForceMillerRabin - Always use Miller-Rabin, even for small candidates.
+     * @return uint32_t - A bitmask with bit i set if pCandidates[i] is prime.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline uint32_t IsPrimeBatch64(const uint64_t *pCandidates, int nCount, bool bForceMillerRabin = false)
+    {
+        // Create instance variables.
+        uint32_t nPrimeMask = 0;
+        uint64_t nMax = 0;
+        for (int nLane = 0; nLane < nCount; ++nLane)
+        {
+            nMax = pCandidates[nLane] > nMax ? pCandidates[nLane] : nMax;
+        }
+
+        // Use the SIMD kernel if everything fits.
+        if (!bForceMillerRabin && nMax <= std::numeric_limits<uint32_t>::max())
+        {
+            uint32_t aNarrow[nBatchSize];
+            for (int nLane = 0; nLane < nCount; ++nLane)
+            {
+                aNarrow[nLane] = uint32_t(pCandidates[nLane]);
+            }
+            return IsPrimeBatch(aNarrow, nCount);
+        }
+
+        // Test each lane with Miller-Rabin.
+        for (int nLane = 0; nLane < nCount; ++nLane)
+        {
+            nPrimeMask |= uint32_t(IsPrime64(pCandidates[nLane])) << nLane;
+        }
+
+        return nPrimeMask;
+    }
+}    // namespace primality
+
+#endif
@@ -0,0 +1,461 @@
+/******************************************************************************
+ * @brief Defines and implements a future with continuations, used to chain
+ *      follow-up work onto pool tasks without blocking the main thread.
+ *
+ * @file PoolFuture.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef POOL_FUTURE_HPP
+#define POOL_FUTURE_HPP
+
+/// \cond
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/// \endcond
+
+// Forward declare the promise so the future can befriend it.
+template <typename R>
+class PoolPromise;
+
+/******************************************************************************
+ * @brief A shared, copyable future whose result can be waited on, polled, or
+ *      handed to a continuation with Then(). Continuations run on the thread that
+ *      completes the future, usually a pool thread, or immediately on the calling
+ *      thread if the future is already ready. Keep them short and never call
+ *      JoinPool(), RunPool() or Start() from inside one.
+ *
+ * @tparam R - The type of the result. May be void.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+template <typename R>
+class PoolFuture
+{
+private:
+    /////////////////////////////////////////
+    // Declare private types.
+    /////////////////////////////////////////
+
+    // Storage for the result, void results are stored as an empty placeholder.
+    using StoredType = std::conditional_t<std::is_void_v<R>, std::monostate, R>;
+
+    // State shared between the promise and every copy of the future.
+    struct SharedState
+    {
+        std::mutex muStateMutex;
+        std::condition_variable cdReadyCondition;
+        bool bReady = false;
+        std::optional<StoredType> tValue = std::nullopt;
+        std::exception_ptr pException = nullptr;
+        std::vector<std::function<void()>> vContinuations;
+    };
+
+    // The result type of a continuation given to Then().
+    template <typename F>
+    using ContinuationResult = typename std::conditional_t<std::is_void_v<R>, std::invoke_result<F>, std::invoke_result<F, const StoredType &>>::type;
+
+public:
+    /////////////////////////////////////////
+    // Declare and define public class methods.
+    /////////////////////////////////////////
+
+    /******************************************************************************
+     * @brief Construct a new, empty Pool Future object. It never becomes ready.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    PoolFuture() = default;
+
+    /******************************************************************************
+     * @brief Check if the future is attached to a promise.
+     *
+     * @return true - The future can become ready.
+     * @return false - The future is empty.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsValid() const { return m_pState != nullptr; }
+
+    /******************************************************************************
+     * @brief Check if the result is available without blocking.
+     *
+     * @return true - The result or an exception has been set.
+     * @return false - The work is still running.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsReady() const
+    {
+        std::lock_guard<std::mutex> lkStateLock(m_pState->muStateMutex);
+        return m_pState->bReady;
+    }
+
+    /******************************************************************************
+     * @brief Blocks the calling thread until the result is available.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Wait() const
+    {
+        std::unique_lock<std::mutex> lkStateLock(m_pState->muStateMutex);
+        m_pState->cdReadyCondition.wait(lkStateLock, [this] { return m_pState->bReady; });
+    }
+
+    /******************************************************************************
+     * @brief Blocks until the result is available and returns it. Rethrows the
+     *      exception if the work threw one.
+     *
+     * @return const R& - The result, nothing for void futures.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    decltype(auto) Get() const
+    {
+        // Wait for the result.
+        this->Wait();
+
+        // Pass on any exception.
+        if (m_pState->pException)
+        {
+            std::rethrow_exception(m_pState->pException);
+        }
+
+        if constexpr (!std::is_void_v<R>)
+        {
+            return static_cast<const R &>(*m_pState->tValue);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Registers a callback that runs once the future is ready, whether it
+     *      holds a result or an exception. Runs it immediately if already ready.
+     *
+     * @param fnCallback - The callback to run. Takes no arguments.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void OnReady(std::function<void()> fnCallback) const
+    {
+        // Queue the callback if the result isn't ready yet.
+        {
+            std::lock_guard<std::mutex> lkStateLock(m_pState->muStateMutex);
+            if (!m_pState->bReady)
+            {
+                m_pState->vContinuations.emplace_back(std::move(fnCallback));
+                return;
+            }
+        }
+
+        // Already ready, run it now.
+        fnCallback();
+    }
+
+    /******************************************************************************
+     * @brief Chains a continuation onto this future. The continuation is given the
+     *      result and its own return value becomes the result of the returned future.
+     *      If this future holds an exception, the continuation is skipped and the
+     *      exception is passed on.
+     *
+     * @tparam F - The type of the continuation. Must be copyable.
+     * @param fnContinuation - The continuation. MUST ACCEPT const R& (or nothing for void futures).
+     * @return PoolFuture<...> - A future for the continuation's result.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+    PoolFuture<ContinuationResult<std::decay_t<F>>> Then(F &&fnContinuation) const
+    {
+        // Create instance variables.
+        using U = ContinuationResult<std::decay_t<F>>;
+        PoolPromise<U> stPromise;
+        PoolFuture<U> stResult = stPromise.GetFuture();
+
+        // Run the continuation once this future is ready.
+        this->OnReady(
+            [pState = m_pState, stPromise, fnContinuation = std::forward<F>(fnContinuation)]() mutable
+            {
+                // Pass on exceptions without running the continuation.
+                if (pState->pException)
+                {
+                    stPromise.SetException(pState->pException);
+                    return;
+                }
+
+                try
+                {
+                    // Build the argument list based on whether this future has a result.
+                    auto fnInvoke = [&]() -> decltype(auto)
+                    {
+                        if constexpr (std::is_void_v<R>)
+                        {
+                            return fnContinuation();
+                        }
+                        else
+                        {
+                            return fnContinuation(static_cast<const StoredType &>(*pState->tValue));
+                        }
+                    };
+
+                    // Store the continuation's result.
+                    if constexpr (std::is_void_v<U>)
+                    {
+                        fnInvoke();
+                        stPromise.SetValue();
+                    }
+                    else
+                    {
+                        stPromise.SetValue(fnInvoke());
+                    }
+                }
+                catch (...)
+                {
+                    stPromise.SetException(std::current_exception());
+                }
+            });
+
+        return stResult;
+    }
+
+private:
+    // Only promises can attach futures to a shared state.
+    friend class PoolPromise<R>;
+    explicit PoolFuture(std::shared_ptr<SharedState> pState) : m_pState(std::move(pState)) {}
+
+    // Declare private member variables.
+    std::shared_ptr<SharedState> m_pState = nullptr;
+};
+
+/******************************************************************************
+ * @brief The producing side of a PoolFuture. Copies share the same state, so a
+ *      promise can be captured by value in a pool task. The result can only be
+ *      set once, later calls are ignored.
+ *
+ * @tparam R - The type of the result. May be void.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+template <typename R>
+class PoolPromise
+{
+private:
+    // Use the future's state layout.
+    using SharedState = typename PoolFuture<R>::SharedState;
+
+public:
+    /******************************************************************************
+     * @brief Construct a new Pool Promise object with a fresh shared state.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    PoolPromise() : m_pState(std::make_shared<SharedState>()) {}
+
+    /******************************************************************************
+     * @brief Accessor for a future attached to this promise.
+     *
+     * @return PoolFuture<R> - The future. Can be called any number of times.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    PoolFuture<R> GetFuture() const { return PoolFuture<R>(m_pState); }
+
+    /******************************************************************************
+     * @brief Stores the result and runs all continuations.
+     *
+     * @param tArgs - The result, or nothing for void promises.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename... Args>
+    void SetValue(Args &&...tArgs)
+    {
+        this->Complete([&]() { m_pState->tValue.emplace(std::forward<Args>(tArgs)...); });
+    }
+
+    /******************************************************************************
+     * @brief Stores an exception and runs all continuations.
+     *
+     * @param pException - The exception to pass on to whoever reads the result.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void SetException(std::exception_ptr pException)
+    {
+        this->Complete([&]() { m_pState->pException = pException; });
+    }
+
+private:
+    // Declare private member variables.
+    std::shared_ptr<SharedState> m_pState;
+
+    /******************************************************************************
+     * @brief Stores the outcome under the lock, wakes waiters, then runs the queued
+     *      continuations outside of the lock.
+     *
+     * @param fnStore - Callable that stores the result or exception.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+    void Complete(F &&fnStore)
+    {
+        // Create instance variables.
+        std::vector<std::function<void()>> vContinuations;
+
+        // Store the outcome and take the continuations.
+        {
+            std::lock_guard<std::mutex> lkStateLock(m_pState->muStateMutex);
+            // The result can only be set once.
+            if (m_pState->bReady)
+            {
+                return;
+            }
+            fnStore();
+            m_pState->bReady = true;
+            vContinuations.swap(m_pState->vContinuations);
+        }
+        m_pState->cdReadyCondition.notify_all();
+
+        // Run continuations on this thread.
+        for (std::function<void()> &fnContinuation : vContinuations)
+        {
+            fnContinuation();
+        }
+    }
+};
+
+/******************************************************************************
+ * @brief Combines a list of futures into one that becomes ready once all of
+ *      them are. If any of them holds an exception, the first one found is
+ *      passed on.
+ *
+ * @tparam R - The result type of the futures.
+ * @param vFutures - The futures to wait for.
+ * @return PoolFuture<std::vector<R>> - The results in the same order, or PoolFuture<void> for void futures.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+template <typename R>
+PoolFuture<std::conditional_t<std::is_void_v<R>, void, std::vector<R>>> WhenAll(const std::vector<PoolFuture<R>> &vFutures)
+{
+    // Create instance variables.
+    using U = std::conditional_t<std::is_void_v<R>, void, std::vector<R>>;
+    PoolPromise<U> stPromise;
+    PoolFuture<U> stResult = stPromise.GetFuture();
+    std::shared_ptr<std::atomic<size_t>> pRemaining = std::make_shared<std::atomic<size_t>>(vFutures.size());
+
+    // Collects the results once everything is done.
+    auto fnFinish = [stPromise, vFutures]() mutable
+    {
+        // Pass on the first exception.
+        for (const PoolFuture<R> &stFuture : vFutures)
+        {
+            try
+            {
+                stFuture.Get();
+            }
+            catch (...)
+            {
+                stPromise.SetException(std::current_exception());
+                return;
+            }
+        }
+
+        if constexpr (std::is_void_v<R>)
+        {
+            stPromise.SetValue();
+        }
+        else
+        {
+            std::vector<R> vResults;
+            vResults.reserve(vFutures.size());
+            for (const PoolFuture<R> &stFuture : vFutures)
+            {
+                vResults.emplace_back(stFuture.Get());
+            }
+            stPromise.SetValue(std::move(vResults));
+        }
+    };
+
+    // Nothing to wait for.
+    if (vFutures.empty())
+    {
+        fnFinish();
+        return stResult;
+    }
+
+    // The last future to finish collects the results. Share one copy of the list between all callbacks.
+    std::shared_ptr<decltype(fnFinish)> pFinish = std::make_shared<decltype(fnFinish)>(std::move(fnFinish));
+    for (const PoolFuture<R> &stFuture : vFutures)
+    {
+        stFuture.OnReady(
+            [pRemaining, pFinish]()
+            {
+                if (pRemaining->fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    (*pFinish)();
+                }
+            });
+    }
+
+    return stResult;
+}
+
+/******************************************************************************
+ * @brief Combines a list of futures into one that becomes ready as soon as any
+ *      of them is, with the index of that future. The others keep running.
+ *
+ * @tparam R - The result type of the futures.
+ * @param vFutures - The futures to race. Must not be empty.
+ * @return PoolFuture<size_t> - The index of the first future to become ready.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+template <typename R>
+PoolFuture<size_t> WhenAny(const std::vector<PoolFuture<R>> &vFutures)
+{
+    // Create instance variables.
+    PoolPromise<size_t> stPromise;
+    PoolFuture<size_t> stResult = stPromise.GetFuture();
+
+    // The promise ignores every result after the first.
+    for (size_t nIter = 0; nIter < vFutures.size(); ++nIter)
+    {
+        vFutures[nIter].OnReady([stPromise, nIter]() mutable { stPromise.SetValue(nIter); });
+    }
+
+    return stResult;
+}
+
+#endif
@@ -0,0 +1,408 @@
+/******************************************************************************
+ * @brief Defines and implements a batched primality test that checks many
+ *      32-bit candidates at once with SIMD, picking AVX-512, AVX2 or a scalar
+ *      fallback at runtime.
+ *
+ * @file PrimalityKernel.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef PRIMALITY_KERNEL_HPP
+#define PRIMALITY_KERNEL_HPP
+
+/// \cond
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define PRIMALITY_KERNEL_X86_SIMD 1
+#endif
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Namespace containing the batched primality kernel.
+ *
+ *      Divisibility is tested without integer division. For a candidate n and a
+ *      trial prime p with precomputed reciprocal 1/p, q = round(n * (1/p)) is the
+ *      nearest quotient and r = n - q * p is exact in double precision for n < 2^32.
+ *      p divides n exactly when r is zero. Every lane of a batch is tested against
+ *      the same trial prime, so the loop maps directly onto SIMD multiply, round,
+ *      and compare instructions.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+namespace primality
+{
+    /////////////////////////////////////////
+    // Declare public enums and constants.
+    /////////////////////////////////////////
+
+    // Which primality test the prime benchmarks use.
+    enum class PrimeTestKernel
+    {
+        eTrialDivision,    // The original one candidate at a time test using integer %.
+        eBatched,          // Wheel generated candidates tested in batches by the SIMD kernel.
+        eMillerRabin       // Wheel generated candidates tested with 64-bit Miller-Rabin. See MillerRabin.hpp.
+    };
+
+    // Number of candidates tested per call.
+    constexpr int nBatchSize = 16;
+    // Primes skipped by the wheel. Callers that start from 2 must add these themselves.
+    constexpr uint32_t aWheelPrimes[] = {2, 3, 5};
+    // Offsets within each block of 30 that are not multiples of 2, 3 or 5.
+    constexpr uint32_t aWheelOffsets[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+
+    /******************************************************************************
+     * @brief Table of every prime below 2^16 and its reciprocal. That is enough
+     *      trial divisors for any 32-bit candidate. Built once on first use.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    struct TrialPrimeTable
+    {
+    public:
+        // Declare public member variables.
+        std::vector<double> vPrimes;
+        std::vector<double> vReciprocals;
+
+        /******************************************************************************
+         * @brief Construct a new Trial Prime Table object with a sieve of Eratosthenes.
+         *
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        TrialPrimeTable()
+        {
+            // Sieve every number below 2^16.
+            constexpr uint32_t nLimit = 1 << 16;
+            std::vector<bool> vComposite(nLimit, false);
+            for (uint32_t nNum = 2; nNum < nLimit; ++nNum)
+            {
+                // Check if this number survived the sieve.
+                if (!vComposite[nNum])
+                {
+                    vPrimes.push_back(double(nNum));
+                    vReciprocals.push_back(1.0 / double(nNum));
+                    for (uint32_t nMultiple = nNum * nNum; nMultiple < nLimit; nMultiple += nNum)
+                    {
+                        vComposite[nMultiple] = true;
+                    }
+                }
+            }
+        }
+    };
+
+    /******************************************************************************
+     * @brief Accessor for the shared trial prime table.
+     *
+     * @return const TrialPrimeTable& - The table.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline const TrialPrimeTable &GetTrialPrimeTable()
+    {
+        // Function local statics are initialized once and thread safe.
+        static const TrialPrimeTable stTable;
+        return stTable;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the nth number on the 2-3-5 wheel. These are the only
+     *      numbers above 5 that can be prime.
+     *
+     * @param nIndex - The position on the wheel. Index 0 is 1, index 1 is 7.
+     * @return uint64_t - The candidate.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline uint64_t WheelCandidate(uint64_t nIndex) { return 30 * (nIndex / 8) + aWheelOffsets[nIndex % 8]; }
+
+    /******************************************************************************
+     * @brief Accessor for the first position on the wheel whose candidate is at
+     *      least nNum. Used to start searching from an offset.
+     *
+     * @param nNum - The smallest candidate wanted.
+     * @return uint64_t - The position on the wheel.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline uint64_t WheelIndexAtOrAbove(uint64_t nNum)
+    {
+        // Start at the block of 30 containing the number and step forward.
+        uint64_t nIndex = (nNum / 30) * 8;
+        while (WheelCandidate(nIndex) < nNum)
+        {
+            ++nIndex;
+        }
+
+        return nIndex;
+    }
+
+    /******************************************************************************
+     * @brief Scalar version of the batch test. Used when the CPU has no AVX2 or
+     *      isn't x86.
+     *
+     * @param pCandidates - The candidates to test.
+     * @param nCount - The number of candidates. Must be at most nBatchSize.
+     * @return uint32_t - A bitmask with bit i set if pCandidates[i] is prime.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline uint32_t IsPrimeBatchScalar(const uint32_t *pCandidates, int nCount)
+    {
+        // Create instance variables.
+        const TrialPrimeTable &stTable = GetTrialPrimeTable();
+        uint32_t nPrimeMask = 0;
+
+        // Test each candidate on its own.
+        for (int nLane = 0; nLane < nCount; ++nLane)
+        {
+            // Numbers below two aren't prime.
+            double dNum = double(pCandidates[nLane]);
+            bool bIsPrime = pCandidates[nLane] >= 2;
+            for (size_t i = 0; bIsPrime && i < stTable.vPrimes.size(); ++i)
+            {
+                // Stop once the trial prime passes the square root.
+                double dPrime = stTable.vPrimes[i];
+                if (dPrime * dPrime > dNum)
+                {
+                    break;
+                }
+                // Remainder through the reciprocal.
+                double dQuotient = std::nearbyint(dNum * stTable.vReciprocals[i]);
+                bIsPrime = (dNum - dQuotient * dPrime) != 0.0;
+            }
+            nPrimeMask |= uint32_t(bIsPrime) << nLane;
+        }
+
+        return nPrimeMask;
+    }
+
+#ifdef PRIMALITY_KERNEL_X86_SIMD
+    /******************************************************************************
+     * @brief AVX2 version of the batch test. Tests eight candidates per group with
+     *      two vectors of four doubles and stops as soon as every lane is composite
+     *      or the trial prime passes the largest candidate's square root.
+     *
+     * @param pCandidates - The candidates to test.
+     * @param nCount - The number of candidates. Must be at most nBatchSize.
+     * @return uint32_t - A bitmask with bit i set if pCandidates[i] is prime.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    __attribute__((target("avx2"))) inline uint32_t IsPrimeBatchAVX2(const uint32_t *pCandidates, int nCount)
+    {
+        // Create instance variables.
+        const TrialPrimeTable &stTable = GetTrialPrimeTable();
+        uint32_t nPrimeMask = 0;
+
+        // Handle eight candidates at a time.
+        for (int nGroup = 0; nGroup < nCount; nGroup += 8)
+        {
+            // Widen the group to doubles. Unused lanes get 0, which is never reported prime.
+            alignas(32) double aNums[8] = {};
+            double dMax = 0.0;
+            int nLanes = nCount - nGroup < 8 ? nCount - nGroup : 8;
+            for (int nLane = 0; nLane < nLanes; ++nLane)
+            {
+                aNums[nLane] = double(pCandidates[nGroup + nLane]);
+                dMax = aNums[nLane] > dMax ? aNums[nLane] : dMax;
+            }
+            __m256d vNumsLow = _mm256_load_pd(aNums);
+            __m256d vNumsHigh = _mm256_load_pd(aNums + 4);
+            __m256d vCompositeLow = _mm256_setzero_pd();
+            __m256d vCompositeHigh = _mm256_setzero_pd();
+            const __m256d vZero = _mm256_setzero_pd();
+
+            // Test every lane against each trial prime up to the largest square root.
+            for (size_t i = 0; i < stTable.vPrimes.size(); ++i)
+            {
+                double dPrime = stTable.vPrimes[i];
+                if (dPrime * dPrime > dMax)
+                {
+                    break;
+                }
+
+                // r = n - round(n * (1/p)) * p, p divides n when r is zero. n == p is not a divisor hit.
+                __m256d vPrime = _mm256_set1_pd(dPrime);
+                __m256d vReciprocal = _mm256_set1_pd(stTable.vReciprocals[i]);
+                __m256d vQuotientLow = _mm256_round_pd(_mm256_mul_pd(vNumsLow, vReciprocal), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                __m256d vQuotientHigh = _mm256_round_pd(_mm256_mul_pd(vNumsHigh, vReciprocal), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                __m256d vRemainderLow = _mm256_sub_pd(vNumsLow, _mm256_mul_pd(vQuotientLow, vPrime));
+                __m256d vRemainderHigh = _mm256_sub_pd(vNumsHigh, _mm256_mul_pd(vQuotientHigh, vPrime));
+                vCompositeLow = _mm256_or_pd(vCompositeLow, _mm256_and_pd(_mm256_cmp_pd(vRemainderLow, vZero, _CMP_EQ_OQ), _mm256_cmp_pd(vNumsLow, vPrime, _CMP_NEQ_OQ)));
+                vCompositeHigh = _mm256_or_pd(vCompositeHigh, _mm256_and_pd(_mm256_cmp_pd(vRemainderHigh, vZero, _CMP_EQ_OQ), _mm256_cmp_pd(vNumsHigh, vPrime, _CMP_NEQ_OQ)));
+
+                // Stop early once every lane has a divisor.
+                if ((_mm256_movemask_pd(vCompositeLow) | (_mm256_movemask_pd(vCompositeHigh) << 4)) == 0xFF)
+                {
+                    break;
+                }
+            }
+
+            // A lane is prime if it is at least two and had no divisor.
+            uint32_t nComposite = uint32_t(_mm256_movemask_pd(vCompositeLow) | (_mm256_movemask_pd(vCompositeHigh) << 4));
+            for (int nLane = 0; nLane < nLanes; ++nLane)
+            {
+                bool bIsPrime = aNums[nLane] >= 2.0 && !(nComposite & (1u << nLane));
+                nPrimeMask |= uint32_t(bIsPrime) << (nGroup + nLane);
+            }
+        }
+
+        return nPrimeMask;
+    }
+
+    /******************************************************************************
+     * @brief AVX-512 version of the batch test. Tests all sixteen candidates at
+     *      once with two vectors of eight doubles and mask registers.
+     *
+     * @param pCandidates - The candidates to test.
+     * @param nCount - The number of candidates. Must be at most nBatchSize.
+     * @return uint32_t - A bitmask with bit i set if pCandidates[i] is prime.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    __attribute__((target("avx512f"))) inline uint32_t IsPrimeBatchAVX512(const uint32_t *pCandidates, int nCount)
+    {
+        // Create instance variables.
+        const TrialPrimeTable &stTable = GetTrialPrimeTable();
+
+        // Widen the batch to doubles. Unused lanes get 0, which is never reported prime.
+        alignas(64) double aNums[16] = {};
+        double dMax = 0.0;
+        for (int nLane = 0; nLane < nCount; ++nLane)
+        {
+            aNums[nLane] = double(pCandidates[nLane]);
+            dMax = aNums[nLane] > dMax ? aNums[nLane] : dMax;
+        }
+        __m512d vNumsLow = _mm512_load_pd(aNums);
+        __m512d vNumsHigh = _mm512_load_pd(aNums + 8);
+        __mmask8 nCompositeLow = 0;
+        __mmask8 nCompositeHigh = 0;
+        const __m512d vZero = _mm512_setzero_pd();
+
+        // Test every lane against each trial prime up to the largest square root.
+        for (size_t i = 0; i < stTable.vPrimes.size(); ++i)
+        {
+            double dPrime = stTable.vPrimes[i];
+            if (dPrime * dPrime > dMax)
+            {
+                break;
+            }
+
+            // r = n - round(n * (1/p)) * p, p divides n when r is zero. n == p is not a divisor hit.
+            __m512d vPrime = _mm512_set1_pd(dPrime);
+            __m512d vReciprocal = _mm512_set1_pd(stTable.vReciprocals[i]);
+            // The zero-masked round is used because GCC warns about the undefined source of the unmasked one.
+            __m512d vQuotientLow = _mm512_maskz_roundscale_pd(0xFF, _mm512_mul_pd(vNumsLow, vReciprocal), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            __m512d vQuotientHigh = _mm512_maskz_roundscale_pd(0xFF, _mm512_mul_pd(vNumsHigh, vReciprocal), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            __m512d vRemainderLow = _mm512_sub_pd(vNumsLow, _mm512_mul_pd(vQuotientLow, vPrime));
+            __m512d vRemainderHigh = _mm512_sub_pd(vNumsHigh, _mm512_mul_pd(vQuotientHigh, vPrime));
+            nCompositeLow |= _mm512_cmp_pd_mask(vRemainderLow, vZero, _CMP_EQ_OQ) & _mm512_cmp_pd_mask(vNumsLow, vPrime, _CMP_NEQ_OQ);
+            nCompositeHigh |= _mm512_cmp_pd_mask(vRemainderHigh, vZero, _CMP_EQ_OQ) & _mm512_cmp_pd_mask(vNumsHigh, vPrime, _CMP_NEQ_OQ);
+
+            // Stop early once every lane has a divisor.
+            if ((nCompositeLow & nCompositeHigh) == 0xFF)
+            {
+                break;
+            }
+        }
+
+        // A lane is prime if it is at least two and had no divisor.
+        uint32_t nComposite = uint32_t(nCompositeLow) | (uint32_t(nCompositeHigh) << 8);
+        uint32_t nPrimeMask = 0;
+        for (int nLane = 0; nLane < nCount; ++nLane)
+        {
+            bool bIsPrime = aNums[nLane] >= 2.0 && !(nComposite & (1u << nLane));
+            nPrimeMask |= uint32_t(bIsPrime) << nLane;
+        }
+
+        return nPrimeMask;
+    }
+#endif
+
+    // Signature shared by every version of the batch test.
+    using BatchKernel = uint32_t (*)(const uint32_t *, int);
+
+    /******************************************************************************
+     * @brief Picks the widest batch test the CPU supports. Checked once.
+     *
+     * @return BatchKernel - The batch test to use.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline BatchKernel GetBatchKernel()
+    {
+        // Check the CPU features once.
+        static const BatchKernel pfnKernel = []() -> BatchKernel
+        {
+#ifdef PRIMALITY_KERNEL_X86_SIMD
+            if (__builtin_cpu_supports("avx512f"))
+            {
+                return IsPrimeBatchAVX512;
+            }
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return IsPrimeBatchAVX2;
+            }
+#endif
+            return IsPrimeBatchScalar;
+        }();
+
+        return pfnKernel;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the name of the batch test picked for this CPU.
+     *
+     * @return const char* - "AVX-512", "AVX2" or "Scalar".
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline const char *GetBatchKernelName()
+    {
+#ifdef PRIMALITY_KERNEL_X86_SIMD
+        if (GetBatchKernel() == IsPrimeBatchAVX512)
+        {
+            return "AVX-512";
+        }
+        if (GetBatchKernel() == IsPrimeBatchAVX2)
+        {
+            return "AVX2";
+        }
+#endif
+        return "Scalar";
+    }
+
+    /******************************************************************************
+     * @brief Tests up to nBatchSize candidates with the best batch test for this CPU.
+     *
+     * @param pCandidates - The candidates to test.
+     * @param nCount - The number of candidates. Must be at most nBatchSize.
+     * @return uint32_t - A bitmask with bit i set if pCandidates[i] is prime.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline uint32_t IsPrimeBatch(const uint32_t *pCandidates, int nCount) { return GetBatchKernel()(pCandidates, nCount); }
+}    // namespace primality
+
+#endif
@@ -0,0 +1,444 @@
+/******************************************************************************
+ * @brief Defines and implements a memory-mapped, on-disk store of prime numbers
+ *      that can be reloaded between runs and extended in place.
+ *
+ * @file PrimeStore.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef PRIME_STORE_HPP
+#define PRIME_STORE_HPP
+
+/// \cond
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief The header at the start of every prime store file. The compute
+ *      parameters and the data checksum let a stale or damaged file be detected
+ *      before any of it is used.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct PrimeStoreHeader
+{
+    uint64_t nMagic;             // Always PrimeStore::nMagic.
+    uint32_t nVersion;           // File format version.
+    uint32_t nDataStart;         // Byte offset of the first prime.
+    uint64_t nOffset;            // The primes are the first ones at or above this number.
+    uint64_t nCount;             // Number of primes stored.
+    uint64_t nDataChecksum;      // Checksum of the first nCount primes.
+    uint64_t nHeaderChecksum;    // Checksum of every field above.
+};
+
+/******************************************************************************
+ * @brief A file of consecutive primes that is mapped straight into memory.
+ *      Opening an existing file only validates it, so results computed by an
+ *      earlier run are available immediately as a std::span. New primes are
+ *      appended to the end of the mapping and the header is updated after the
+ *      data, so an interrupted append leaves the previous contents valid.
+ *
+ *      Not thread safe. Spans returned by GetPrimes() are invalidated by Append()
+ *      and Close().
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class PrimeStore
+{
+public:
+    // Declare public constants.
+    static constexpr uint64_t nMagic = 0x53454d4952504154;    // "TAPRIMES" read little endian.
+    static constexpr uint32_t nVersion = 1;
+    static constexpr uint32_t nDataStart = 64;
+    static constexpr size_t nMinimumCapacity = 4096;
+
+    // Declare and define public class methods.
+    PrimeStore() = default;
+    ~PrimeStore() { this->Close(); }
+    PrimeStore(const PrimeStore &) = delete;
+    PrimeStore &operator=(const PrimeStore &) = delete;
+
+    /******************************************************************************
+     * @brief Opens or creates a store file and maps it. If the file exists but was
+     *      computed with a different offset, is a different format or fails its
+     *      checksum, it is emptied and WasReset() returns true.
+     *
+     * @param szPath - The path to the store file.
+     * @param nOffset - The number the stored primes must start from.
+     * @return true - The store is open and valid.
+     * @return false - The file couldn't be opened, sized or mapped.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Open(const std::string &szPath, uint64_t nOffset)
+    {
+        // Close anything already open.
+        this->Close();
+        m_bWasReset = false;
+
+        // Open or create the file.
+        m_nFileDescriptor = ::open(szPath.c_str(), O_RDWR | O_CREAT, 0644);
+        if (m_nFileDescriptor < 0)
+        {
+            return false;
+        }
+
+        // Map whatever is already there, or size a new file.
+        struct stat stFileInfo;
+        if (::fstat(m_nFileDescriptor, &stFileInfo) != 0)
+        {
+            this->Close();
+            return false;
+        }
+        size_t nFileSize = size_t(stFileInfo.st_size);
+        if (nFileSize < nDataStart + nMinimumCapacity * sizeof(uint64_t))
+        {
+            // Too small to be a store, or new. Either way it gets a fresh header below.
+            m_bWasReset = nFileSize > 0;
+            nFileSize = nDataStart + nMinimumCapacity * sizeof(uint64_t);
+            if (::ftruncate(m_nFileDescriptor, off_t(nFileSize)) != 0)
+            {
+                this->Close();
+                return false;
+            }
+        }
+        if (!this->Map(nFileSize))
+        {
+            this->Close();
+            return false;
+        }
+
+        // Validate the existing contents and start over if they don't match.
+        if (!this->IsValid(nOffset, nFileSize))
+        {
+            m_bWasReset = m_bWasReset || this->GetHeader()->nMagic != 0;
+            this->WriteHeader(nOffset, 0, nChecksumSeed);
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Flushes and unmaps the store and closes the file.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Close()
+    {
+        // Unmap the file.
+        if (m_pMapping != nullptr)
+        {
+            ::msync(m_pMapping, m_nMappedSize, MS_SYNC);
+            ::munmap(m_pMapping, m_nMappedSize);
+            m_pMapping = nullptr;
+            m_nMappedSize = 0;
+        }
+        // Close the file.
+        if (m_nFileDescriptor >= 0)
+        {
+            ::close(m_nFileDescriptor);
+            m_nFileDescriptor = -1;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Appends primes to the end of the store, growing the file if needed.
+     *      The primes must be sorted and continue on from the last stored prime.
+     *
+     * @param spPrimes - The primes to append.
+     * @return true - The primes were appended.
+     * @return false - The store isn't open or the file couldn't be grown.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Append(std::span<const uint64_t> spPrimes)
+    {
+        // Check if the store is open.
+        if (m_pMapping == nullptr)
+        {
+            return false;
+        }
+
+        // Grow the file geometrically so repeated appends stay cheap.
+        uint64_t nCount = this->GetHeader()->nCount;
+        size_t nNeeded = nDataStart + (nCount + spPrimes.size()) * sizeof(uint64_t);
+        if (nNeeded > m_nMappedSize)
+        {
+            size_t nNewSize = std::max(nNeeded, nDataStart + 2 * (m_nMappedSize - nDataStart));
+            ::munmap(m_pMapping, m_nMappedSize);
+            m_pMapping = nullptr;
+            if (::ftruncate(m_nFileDescriptor, off_t(nNewSize)) != 0 || !this->Map(nNewSize))
+            {
+                this->Close();
+                return false;
+            }
+        }
+
+        // Write the data first, then publish it by updating the header.
+        uint64_t *pData = this->GetData();
+        std::copy(spPrimes.begin(), spPrimes.end(), pData + nCount);
+        uint64_t nChecksum = Checksum(spPrimes, this->GetHeader()->nDataChecksum);
+        this->WriteHeader(this->GetHeader()->nOffset, nCount + spPrimes.size(), nChecksum);
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Writes the mapped pages back to the file.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Flush()
+    {
+        if (m_pMapping != nullptr)
+        {
+            ::msync(m_pMapping, m_nMappedSize, MS_SYNC);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the stored primes. Zero-copy, the span points into the
+     *      mapped file.
+     *
+     * @return std::span<const uint64_t> - The stored primes in ascending order.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    std::span<const uint64_t> GetPrimes() const
+    {
+        if (m_pMapping == nullptr)
+        {
+            return {};
+        }
+        return std::span<const uint64_t>(this->GetData(), this->GetHeader()->nCount);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the number of stored primes.
+     *
+     * @return uint64_t - The number of primes in the store.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetCount() const { return m_pMapping == nullptr ? 0 : this->GetHeader()->nCount; }
+
+    /******************************************************************************
+     * @brief Accessor for the offset the store was computed from.
+     *
+     * @return uint64_t - The stored primes are the first ones at or above this number.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetOffset() const { return m_pMapping == nullptr ? 0 : this->GetHeader()->nOffset; }
+
+    /******************************************************************************
+     * @brief Accessor for where the search for more primes should continue.
+     *
+     * @return uint64_t - One past the last stored prime, or the offset if the store is empty.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetResumePoint() const
+    {
+        uint64_t nCount = this->GetCount();
+        return nCount == 0 ? this->GetOffset() : this->GetData()[nCount - 1] + 1;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Open status.
+     *
+     * @return true - The store is open.
+     * @return false - The store is closed.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsOpen() const { return m_pMapping != nullptr; }
+
+    /******************************************************************************
+     * @brief Accessor for the Was Reset private member.
+     *
+     * @return true - The last Open() found a stale or damaged file and emptied it.
+     * @return false - The file was new or valid.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool WasReset() const { return m_bWasReset; }
+
+private:
+    // Declare private constants.
+    static constexpr uint64_t nChecksumSeed = 0xcbf29ce484222325;
+    static constexpr uint64_t nChecksumPrime = 0x100000001b3;
+
+    // Declare private member variables.
+    int m_nFileDescriptor = -1;
+    void *m_pMapping = nullptr;
+    size_t m_nMappedSize = 0;
+    bool m_bWasReset = false;
+
+    /******************************************************************************
+     * @brief FNV-1a style checksum folded over 64-bit words. Continuing from a
+     *      previous result gives the same checksum as hashing everything at once,
+     *      so appends only hash the new data.
+     *
+     * @param spWords - The words to hash.
+     * @param nChecksum - The checksum of everything before these words.
+     * @return uint64_t - The updated checksum.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static uint64_t Checksum(std::span<const uint64_t> spWords, uint64_t nChecksum)
+    {
+        for (uint64_t nWord : spWords)
+        {
+            nChecksum = (nChecksum ^ nWord) * nChecksumPrime;
+        }
+
+        return nChecksum;
+    }
+
+    /******************************************************************************
+     * @brief Checksum of every header field before nHeaderChecksum.
+     *
+     * @param stHeader - The header.
+     * @return uint64_t - The header checksum.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static uint64_t HeaderChecksum(const PrimeStoreHeader &stHeader)
+    {
+        const uint64_t aFields[] = {stHeader.nMagic,
+                                    (uint64_t(stHeader.nVersion) << 32) | stHeader.nDataStart,
+                                    stHeader.nOffset,
+                                    stHeader.nCount,
+                                    stHeader.nDataChecksum};
+        return Checksum(aFields, nChecksumSeed);
+    }
+
+    /******************************************************************************
+     * @brief Maps the whole file.
+     *
+     * @param nSize - The file size in bytes.
+     * @return true - The file was mapped.
+     * @return false - mmap failed.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Map(size_t nSize)
+    {
+        void *pMapping = ::mmap(nullptr, nSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_nFileDescriptor, 0);
+        if (pMapping == MAP_FAILED)
+        {
+            return false;
+        }
+        m_pMapping = pMapping;
+        m_nMappedSize = nSize;
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Checks the header and data against the expected parameters.
+     *
+     * @param nOffset - The offset the caller wants.
+     * @param nFileSize - The size of the file in bytes.
+     * @return true - The store can be used as is.
+     * @return false - The store is stale or damaged.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsValid(uint64_t nOffset, size_t nFileSize) const
+    {
+        // Check the header itself.
+        const PrimeStoreHeader *pHeader = this->GetHeader();
+        if (pHeader->nMagic != nMagic || pHeader->nVersion != nVersion || pHeader->nDataStart != nDataStart ||
+            pHeader->nHeaderChecksum != HeaderChecksum(*pHeader))
+        {
+            return false;
+        }
+        // Check the compute parameters and that the data fits in the file.
+        if (pHeader->nOffset != nOffset || pHeader->nCount > (nFileSize - nDataStart) / sizeof(uint64_t))
+        {
+            return false;
+        }
+
+        // Check the data.
+        return Checksum(std::span<const uint64_t>(this->GetData(), pHeader->nCount), nChecksumSeed) == pHeader->nDataChecksum;
+    }
+
+    /******************************************************************************
+     * @brief Writes a complete header with a fresh header checksum.
+     *
+     * @param nOffset - The offset the primes start from.
+     * @param nCount - The number of primes stored.
+     * @param nDataChecksum - The checksum of the stored primes.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void WriteHeader(uint64_t nOffset, uint64_t nCount, uint64_t nDataChecksum)
+    {
+        PrimeStoreHeader stHeader = {};
+        stHeader.nMagic = nMagic;
+        stHeader.nVersion = nVersion;
+        stHeader.nDataStart = nDataStart;
+        stHeader.nOffset = nOffset;
+        stHeader.nCount = nCount;
+        stHeader.nDataChecksum = nDataChecksum;
+        stHeader.nHeaderChecksum = HeaderChecksum(stHeader);
+        std::memcpy(m_pMapping, &stHeader, sizeof(stHeader));
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the header inside the mapping.
+     *
+     * @return PrimeStoreHeader* - The mapped header.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    PrimeStoreHeader *GetHeader() const { return static_cast<PrimeStoreHeader *>(m_pMapping); }
+
+    /******************************************************************************
+     * @brief Accessor for the prime array inside the mapping.
+     *
+     * @return uint64_t* - The first stored prime.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t *GetData() const { return reinterpret_cast<uint64_t *>(static_cast<char *>(m_pMapping) + nDataStart); }
+};
+
+#endif
@@ -0,0 +1,182 @@
+/******************************************************************************
+ * @brief Defines and implements helpers for reading the resource usage of this
+ *      process from the Linux /proc filesystem.
+ *
+ * @file ProcessStats.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef PROCESS_STATS_HPP
+#define PROCESS_STATS_HPP
+
+/// \cond
+#include <fstream>
+#include <string>
+#include <sys/resource.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Namespace containing functions that report the resource usage of the
+ *      current process. All functions return -1 if the value can't be read.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+namespace procstats
+{
+    /******************************************************************************
+     * @brief Reads a numeric field out of /proc/self/status.
+     *
+     * @param szField - The name of the field without the colon. (VmRSS, Threads, etc.)
+     * @return long - The value of the field. Memory fields are in kB.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline long ReadStatusField(const std::string &szField)
+    {
+        // Open the status file for this process.
+        std::ifstream fsStatus("/proc/self/status");
+        std::string szLine;
+
+        // Loop through each line and look for the field.
+        while (std::getline(fsStatus, szLine))
+        {
+            // Check if this line is the field we want.
+            if (szLine.compare(0, szField.size(), szField) == 0 && szLine.size() > szField.size() && szLine[szField.size()] == ':')
+            {
+                // Parse the number after the colon.
+                return std::stol(szLine.substr(szField.size() + 1));
+            }
+        }
+
+        // Field not found.
+        return -1;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the number of threads in this process.
+     *
+     * @return long - The number of threads.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline long GetThreadCount() { return ReadStatusField("Threads"); }
+
+    /******************************************************************************
+     * @brief Accessor for the resident memory of this process.
+     *
+     * @return long - The resident set size in kB.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline long GetResidentMemoryKB() { return ReadStatusField("VmRSS"); }
+
+    /******************************************************************************
+     * @brief Accessor for the virtual memory of this process.
+     *
+     * @return long - The virtual memory size in kB.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline long GetVirtualMemoryKB() { return ReadStatusField("VmSize"); }
+
+    /******************************************************************************
+     * @brief Accessor for the page table memory of this process.
+     *
+     * @return long - The size of the page tables in kB.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline long GetPageTableKB() { return ReadStatusField("VmPTE"); }
+
+    /******************************************************************************
+     * @brief Accessor for the peak resident memory of this process.
+     *
+     * @return long - The most resident memory since start or the last ResetPeakResidentMemory(), in kB.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline long GetPeakResidentMemoryKB() { return ReadStatusField("VmHWM"); }
+
+    /******************************************************************************
+     * @brief Sets the peak resident memory back to the current resident memory, so
+     *      the peak of one section of code can be measured. Freed heap memory is given
+     *      back to the system first, or new allocations would reuse it without the
+     *      peak moving.
+     *
+     * @return true - The peak was reset.
+     * @return false - The kernel doesn't allow it, the peak covers the whole run.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline bool ResetPeakResidentMemory()
+    {
+#ifdef __GLIBC__
+        malloc_trim(0);
+#endif
+        // Writing 5 to clear_refs resets VmHWM. (Linux 4.0+)
+        std::ofstream fsClearRefs("/proc/self/clear_refs");
+        fsClearRefs << "5";
+        fsClearRefs.flush();
+        return fsClearRefs.good();
+    }
+
+    /******************************************************************************
+     * @brief CPU time and context switches used by every thread of this process
+     *      so far. Take two and subtract them to measure an interval.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    struct ResourceUsage
+    {
+    public:
+        // Declare public member variables.
+        double dCpuSeconds = -1.0;
+        long nVoluntaryContextSwitches = -1;
+        long nInvoluntaryContextSwitches = -1;
+    };
+
+    /******************************************************************************
+     * @brief Accessor for the CPU time and context switches of this process.
+     *
+     * @return ResourceUsage - User plus system time, and voluntary and involuntary
+     *                      context switches summed over all threads.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline ResourceUsage GetResourceUsage()
+    {
+        // Create instance variables.
+        ResourceUsage stUsage;
+        rusage stRawUsage;
+
+        // Ask the kernel for the totals.
+        if (getrusage(RUSAGE_SELF, &stRawUsage) == 0)
+        {
+            stUsage.dCpuSeconds = double(stRawUsage.ru_utime.tv_sec + stRawUsage.ru_stime.tv_sec) +
+                                  double(stRawUsage.ru_utime.tv_usec + stRawUsage.ru_stime.tv_usec) / 1e6;
+            stUsage.nVoluntaryContextSwitches = stRawUsage.ru_nvcsw;
+            stUsage.nInvoluntaryContextSwitches = stRawUsage.ru_nivcsw;
+        }
+
+        return stUsage;
+    }
+}    // namespace procstats
+
+#endif
@@ -0,0 +1,454 @@
+/******************************************************************************
+ * @brief Defines and implements an append-only result stream that lets other
+ *      threads read a benchmark's results in chunks while it is still running.
+ *
+ * @file ResultStream.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef RESULT_STREAM_HPP
+#define RESULT_STREAM_HPP
+
+#include "CacheAlignment.hpp"
+
+/// \cond
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief An append-only stream of results stored in fixed-size chunks. Chunks
+ *      are never moved or freed while the stream is in use, so readers get
+ *      std::spans straight into them instead of copies. A chunk becomes visible
+ *      to readers when it fills up, or when the stream is closed for the last
+ *      partial chunk.
+ *
+ *      Only ONE thread may push at a time; callers with several producers must
+ *      serialize Push() themselves. Readers never take a lock and never make the
+ *      producer wait. Clear() frees the chunks, so it must only be called when
+ *      nobody is reading.
+ *
+ * @tparam T - The type of the results.
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+template <typename T>
+class ResultStream
+{
+private:
+    /******************************************************************************
+     * @brief One fixed-size block of results. nPublished only ever grows, and
+     *      everything below it is safe to read.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    struct Chunk
+    {
+    public:
+        // Declare public member variables.
+        std::unique_ptr<T[]> pData;
+        std::atomic<size_t> nPublished = 0;
+        std::atomic<Chunk *> pNext = nullptr;
+    };
+
+public:
+    /******************************************************************************
+     * @brief A reader's position in the stream. Every cursor sees every chunk once,
+     *      in the order it was pushed, so several consumers can subscribe to the
+     *      same stream independently.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    class Cursor
+    {
+    public:
+        /******************************************************************************
+         * @brief Returns the next published results this cursor hasn't seen yet.
+         *      Never blocks.
+         *
+         * @return std::span<const T> - The new results, at most one chunk. Empty if nothing new is published.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        std::span<const T> Next()
+        {
+            // Move on to the next chunk once this one is used up.
+            if (m_nOffset == m_pStream->m_nChunkSize)
+            {
+                Chunk *pNext = m_pChunk->pNext.load(std::memory_order_acquire);
+                if (pNext == nullptr)
+                {
+                    return {};
+                }
+                m_pChunk = pNext;
+                m_nOffset = 0;
+            }
+
+            // Hand out whatever has been published past our offset.
+            size_t nPublished = m_pChunk->nPublished.load(std::memory_order_acquire);
+            std::span<const T> spResults(m_pChunk->pData.get() + m_nOffset, nPublished - m_nOffset);
+            m_nOffset = nPublished;
+
+            return spResults;
+        }
+
+        /******************************************************************************
+         * @brief Blocks until new results are published or the stream is closed.
+         *
+         * @return std::span<const T> - The new results. Empty only once the stream is closed and fully read.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        std::span<const T> WaitNext()
+        {
+            while (true)
+            {
+                // Read the generation first so a publish between the check and the wait isn't missed.
+                uint64_t nGeneration = m_pStream->m_nGeneration.load(std::memory_order_acquire);
+                std::span<const T> spResults = this->Next();
+                if (!spResults.empty() || this->IsFinished())
+                {
+                    return spResults;
+                }
+                m_pStream->m_nGeneration.wait(nGeneration, std::memory_order_acquire);
+            }
+        }
+
+        /******************************************************************************
+         * @brief Accessor for the Finished status.
+         *
+         * @return true - The stream is closed and this cursor has read everything.
+         * @return false - More results may still come.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        bool IsFinished() const
+        {
+            // Check closed first, the publish of the last chunk happens before it.
+            if (!m_pStream->m_bClosed.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            return m_nOffset == m_pChunk->nPublished.load(std::memory_order_acquire) && m_pChunk->pNext.load(std::memory_order_acquire) == nullptr;
+        }
+
+    private:
+        // Declare private member variables.
+        const ResultStream<T> *m_pStream;
+        Chunk *m_pChunk;
+        size_t m_nOffset = 0;
+
+        /******************************************************************************
+         * @brief Construct a new Cursor object at the start of a stream.
+         *
+         * @param pStream - The stream to read.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        Cursor(const ResultStream<T> *pStream) : m_pStream(pStream), m_pChunk(pStream->m_pHead.get()) {}
+
+        // Only the stream creates cursors.
+        friend class ResultStream<T>;
+    };
+
+    /////////////////////////////////////////
+    // Declare and define public class methods.
+    /////////////////////////////////////////
+
+    /******************************************************************************
+     * @brief Construct a new Result Stream object.
+     *
+     * @param nChunkSize - The number of results per chunk. Readers see results in units of this.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ResultStream(const size_t nChunkSize = 4096) : m_nChunkSize(nChunkSize) { this->Clear(); }
+
+    /******************************************************************************
+     * @brief Destroy the Result Stream object.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ~ResultStream() { this->FreeChunks(); }
+
+    // The chunks are owned by the stream and cursors point at it.
+    ResultStream(const ResultStream &) = delete;
+    ResultStream &operator=(const ResultStream &) = delete;
+
+    /******************************************************************************
+     * @brief Appends a result. Publishes the current chunk when it fills up.
+     *
+     * @param tResult - The result to append.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Push(const T &tResult)
+    {
+        // Start a new chunk when the current one is full.
+        if (m_nTailSize == m_nChunkSize)
+        {
+            this->AddChunk();
+        }
+
+        // Write the result and publish the chunk if it is now full.
+        m_pTail->pData[m_nTailSize++] = tResult;
+        ++m_nSize;
+        if (m_nTailSize == m_nChunkSize)
+        {
+            this->Publish();
+        }
+    }
+
+    /******************************************************************************
+     * @brief Appends a range of results with one copy per chunk. Publishes every
+     *      chunk that fills up along the way.
+     *
+     * @param spResults - The results to append, in order.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void PushRange(std::span<const T> spResults)
+    {
+        // Fill the tail chunk, then as many new chunks as needed.
+        size_t nDone = 0;
+        while (nDone < spResults.size())
+        {
+            // Start a new chunk when the current one is full.
+            if (m_nTailSize == m_nChunkSize)
+            {
+                this->AddChunk();
+            }
+
+            // Copy as much as fits.
+            size_t nCopy = std::min(m_nChunkSize - m_nTailSize, spResults.size() - nDone);
+            std::copy_n(spResults.begin() + nDone, nCopy, m_pTail->pData.get() + m_nTailSize);
+            m_nTailSize += nCopy;
+            m_nSize += nCopy;
+            nDone += nCopy;
+            if (m_nTailSize == m_nChunkSize)
+            {
+                this->Publish();
+            }
+        }
+    }
+
+    /******************************************************************************
+     * @brief Publishes the last partial chunk and marks the stream finished.
+     *      Pushing after this is allowed again only after Clear().
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Close()
+    {
+        // Publish the remainder, then close.
+        m_pTail->nPublished.store(m_nTailSize, std::memory_order_release);
+        m_nPublishedSize.store(m_nSize, std::memory_order_release);
+        m_bClosed.store(true, std::memory_order_release);
+        // Wake any waiting cursors.
+        m_nGeneration.fetch_add(1, std::memory_order_release);
+        m_nGeneration.notify_all();
+    }
+
+    /******************************************************************************
+     * @brief Throws away every result and reopens the stream. Invalidates all
+     *      cursors and spans, so only call this when nobody is reading.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Clear()
+    {
+        // Free everything and start over with one empty chunk.
+        this->FreeChunks();
+        m_pHead.reset(new Chunk());
+        m_pHead->pData = std::make_unique<T[]>(m_nChunkSize);
+        m_pTail = m_pHead.get();
+        m_nTailSize = 0;
+        m_nSize = 0;
+        m_nPublishedSize.store(0, std::memory_order_release);
+        m_bClosed.store(false, std::memory_order_release);
+    }
+
+    /******************************************************************************
+     * @brief Creates a cursor at the start of the stream.
+     *
+     * @return Cursor - A cursor that will see every result pushed since the last Clear().
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    Cursor Subscribe() const { return Cursor(this); }
+
+    /******************************************************************************
+     * @brief Calls a function with a read-only span of every published chunk, in
+     *      order. Safe to call while the producer is pushing, results published
+     *      after the call started may or may not be visited.
+     *
+     * @tparam F - The function type.
+     * @param fnVisitor - Called with a std::span<const T> for each chunk.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    template <typename F>
+    void ForEachChunk(F &&fnVisitor) const
+    {
+        Cursor stCursor = this->Subscribe();
+        for (std::span<const T> spChunk = stCursor.Next(); !spChunk.empty(); spChunk = stCursor.Next())
+        {
+            fnVisitor(spChunk);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Copies the published results into a vector.
+     *
+     * @return std::vector<T> - The results readers can currently see.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    std::vector<T> ToVector() const
+    {
+        std::vector<T> vResults;
+        vResults.reserve(this->GetPublishedSize());
+        this->ForEachChunk([&vResults](std::span<const T> spChunk) { vResults.insert(vResults.end(), spChunk.begin(), spChunk.end()); });
+
+        return vResults;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the Size private member. Producer side only.
+     *
+     * @return size_t - The number of results pushed, published or not.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetSize() const { return m_nSize; }
+
+    /******************************************************************************
+     * @brief Accessor for the Published Size private member. Safe from any thread.
+     *
+     * @return size_t - The number of results readers can see.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetPublishedSize() const { return m_nPublishedSize.load(std::memory_order_acquire); }
+
+    /******************************************************************************
+     * @brief Accessor for the Closed private member.
+     *
+     * @return true - Every result has been published.
+     * @return false - The producer may still push.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsClosed() const { return m_bClosed.load(std::memory_order_acquire); }
+
+    /******************************************************************************
+     * @brief Accessor for the Chunk Size private member.
+     *
+     * @return size_t - The number of results per chunk.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetChunkSize() const { return m_nChunkSize; }
+
+private:
+    // Declare private member variables.
+    size_t m_nChunkSize;
+    std::unique_ptr<Chunk> m_pHead;
+    // Producer only.
+    Chunk *m_pTail = nullptr;
+    size_t m_nTailSize = 0;
+    size_t m_nSize = 0;
+    // Read by cursors, keep them off the producer's line.
+    alignas(cachealign::nDestructiveSize) std::atomic<size_t> m_nPublishedSize = 0;
+    std::atomic_bool m_bClosed = false;
+    std::atomic<uint64_t> m_nGeneration = 0;
+
+    /******************************************************************************
+     * @brief Links a new empty chunk after the full tail chunk.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void AddChunk()
+    {
+        Chunk *pChunk = new Chunk();
+        pChunk->pData = std::make_unique<T[]>(m_nChunkSize);
+        m_pTail->pNext.store(pChunk, std::memory_order_release);
+        m_pTail = pChunk;
+        m_nTailSize = 0;
+    }
+
+    /******************************************************************************
+     * @brief Publishes the tail chunk and wakes waiting cursors.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Publish()
+    {
+        m_pTail->nPublished.store(m_nTailSize, std::memory_order_release);
+        m_nPublishedSize.store(m_nSize, std::memory_order_release);
+        // notify_all() only makes a syscall when somebody is actually waiting.
+        m_nGeneration.fetch_add(1, std::memory_order_release);
+        m_nGeneration.notify_all();
+    }
+
+    /******************************************************************************
+     * @brief Frees every chunk after the head, and the head.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void FreeChunks()
+    {
+        // Walk the list so long streams don't recurse through unique_ptr destructors.
+        if (m_pHead)
+        {
+            Chunk *pChunk = m_pHead->pNext.load(std::memory_order_relaxed);
+            while (pChunk != nullptr)
+            {
+                Chunk *pNext = pChunk->pNext.load(std::memory_order_relaxed);
+                delete pChunk;
+                pChunk = pNext;
+            }
+            m_pHead.reset();
+        }
+    }
+};
+
+#endif
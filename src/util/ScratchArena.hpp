@@ -0,0 +1,282 @@
+/******************************************************************************
+ * @brief Defines and implements a per thread bump allocator for scratch memory
+ *      that only lives for one main loop iteration or one pooled task.
+ *
+ * @file ScratchArena.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef SCRATCH_ARENA_HPP
+#define SCRATCH_ARENA_HPP
+
+/// \cond
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief A bump allocator usable as a std::pmr::memory_resource. Allocating
+ *      moves a pointer forward in the current chunk, deallocating does nothing,
+ *      and Reset() rewinds to the start. When a chunk runs out a bigger one is
+ *      taken from the upstream resource. Reset() merges every chunk into one that
+ *      fits the whole iteration, so after the first few iterations the arena never
+ *      touches malloc again.
+ *
+ *      Each thread gets its own arena from ThreadLocal(), so nothing is shared and
+ *      nothing is locked. Memory from an arena must not be used after its Reset()
+ *      or on another thread after the owning task ends.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class ScratchArena : public std::pmr::memory_resource
+{
+public:
+    /******************************************************************************
+     * @brief Resets an arena when it goes out of scope, but only if it was empty
+     *      when the guard was made. A task run inline by a thread that is already
+     *      using its arena leaves its memory for that thread's own reset instead of
+     *      freeing memory it doesn't own.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    class ResetGuard
+    {
+    public:
+        explicit ResetGuard(ScratchArena &stArena) : m_stArena(stArena), m_bOwnsArena(stArena.GetBytesInUse() == 0) {}
+        ResetGuard(const ResetGuard &) = delete;
+        ResetGuard &operator=(const ResetGuard &) = delete;
+        ~ResetGuard()
+        {
+            if (m_bOwnsArena)
+            {
+                m_stArena.Reset();
+            }
+        }
+
+    private:
+        ScratchArena &m_stArena;
+        bool m_bOwnsArena;
+    };
+
+    /******************************************************************************
+     * @brief Construct a new Scratch Arena object. No memory is taken until the
+     *      first allocation.
+     *
+     * @param nInitialChunkSize - Size of the first chunk in bytes.
+     * @param pUpstream - Where chunks come from.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    explicit ScratchArena(size_t nInitialChunkSize = 64 * 1024, std::pmr::memory_resource *pUpstream = std::pmr::new_delete_resource())
+        : m_nNextChunkSize(nInitialChunkSize), m_pUpstream(pUpstream)
+    {}
+
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena &operator=(const ScratchArena &) = delete;
+
+    /******************************************************************************
+     * @brief Destroy the Scratch Arena object and return every chunk upstream.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ~ScratchArena() override { this->Release(); }
+
+    /******************************************************************************
+     * @brief Accessor for the calling thread's arena.
+     *
+     * @return ScratchArena& - The arena owned by the calling thread.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static ScratchArena &ThreadLocal()
+    {
+        thread_local ScratchArena stArena;
+        return stArena;
+    }
+
+    /******************************************************************************
+     * @brief Frees everything allocated since the last reset. If the allocations
+     *      spilled into more than one chunk, the chunks are replaced by one chunk
+     *      large enough for all of them.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Reset()
+    {
+        // Merge chunks so the next iteration fits in one.
+        if (m_vChunks.size() > 1)
+        {
+            size_t nTotal = 0;
+            for (const Chunk &stChunk : m_vChunks)
+            {
+                nTotal += stChunk.nSize;
+            }
+            this->Release();
+            m_nNextChunkSize = std::max(m_nNextChunkSize, nTotal);
+            this->AddChunk(0);
+        }
+
+        // Rewind.
+        m_nUsed = 0;
+        m_pCursor = m_vChunks.empty() ? nullptr : m_vChunks.back().pData;
+        m_pEnd = m_vChunks.empty() ? nullptr : m_vChunks.back().pData + m_vChunks.back().nSize;
+    }
+
+    /******************************************************************************
+     * @brief Returns every chunk upstream.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Release()
+    {
+        // Free chunks.
+        for (const Chunk &stChunk : m_vChunks)
+        {
+            m_pUpstream->deallocate(stChunk.pData, stChunk.nSize, alignof(std::max_align_t));
+        }
+        m_vChunks.clear();
+        m_pCursor = nullptr;
+        m_pEnd = nullptr;
+        m_nUsed = 0;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the bytes handed out since the last reset.
+     *
+     * @return size_t - Bytes in use, including alignment padding.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetBytesInUse() const { return m_nUsed; }
+
+    /******************************************************************************
+     * @brief Accessor for the most bytes in use at once.
+     *
+     * @return size_t - Peak bytes in use since construction.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetPeakBytes() const { return m_nPeak; }
+
+    /******************************************************************************
+     * @brief Accessor for the number of chunks taken from upstream.
+     *
+     * @return uint64_t - Upstream allocations since construction.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    uint64_t GetUpstreamAllocations() const { return m_nUpstreamAllocations; }
+
+private:
+    // Declare private structs.
+    struct Chunk
+    {
+        std::byte *pData;
+        size_t nSize;
+    };
+
+    // Declare private member variables.
+    std::vector<Chunk> m_vChunks;
+    std::byte *m_pCursor = nullptr;
+    std::byte *m_pEnd = nullptr;
+    size_t m_nNextChunkSize;
+    size_t m_nUsed = 0;
+    size_t m_nPeak = 0;
+    uint64_t m_nUpstreamAllocations = 0;
+    std::pmr::memory_resource *m_pUpstream;
+
+    /******************************************************************************
+     * @brief Takes a new chunk from upstream and makes it current. Chunks double in
+     *      size so a growing iteration only needs a few of them.
+     *
+     * @param nMinimumSize - The chunk must hold at least this many bytes.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void AddChunk(size_t nMinimumSize)
+    {
+        // Allocate the chunk.
+        size_t nSize = std::max(m_nNextChunkSize, nMinimumSize);
+        m_vChunks.push_back({static_cast<std::byte *>(m_pUpstream->allocate(nSize, alignof(std::max_align_t))), nSize});
+        ++m_nUpstreamAllocations;
+        m_nNextChunkSize = nSize * 2;
+
+        // Make it current.
+        m_pCursor = m_vChunks.back().pData;
+        m_pEnd = m_pCursor + nSize;
+    }
+
+    /******************************************************************************
+     * @brief Bumps the cursor, taking a new chunk if the current one is full.
+     *
+     * @param nBytes - The number of bytes.
+     * @param nAlignment - The alignment, a power of two.
+     * @return void* - The memory.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void *do_allocate(size_t nBytes, size_t nAlignment) override
+    {
+        // Align the cursor.
+        size_t nPadding = (nAlignment - reinterpret_cast<uintptr_t>(m_pCursor) % nAlignment) % nAlignment;
+        if (m_pCursor == nullptr || size_t(m_pEnd - m_pCursor) < nPadding + nBytes)
+        {
+            // Chunks are aligned to max_align_t, larger alignments may need padding.
+            this->AddChunk(nBytes + (nAlignment > alignof(std::max_align_t) ? nAlignment : 0));
+            nPadding = (nAlignment - reinterpret_cast<uintptr_t>(m_pCursor) % nAlignment) % nAlignment;
+        }
+
+        // Bump.
+        std::byte *pMemory = m_pCursor + nPadding;
+        m_pCursor = pMemory + nBytes;
+        m_nUsed += nPadding + nBytes;
+        m_nPeak = std::max(m_nPeak, m_nUsed);
+
+        return pMemory;
+    }
+
+    /******************************************************************************
+     * @brief Does nothing, memory is freed all at once by Reset().
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void do_deallocate(void *, size_t, size_t) override {}
+
+    /******************************************************************************
+     * @brief Memory from one arena can only be freed by the same arena.
+     *
+     * @param stOther - The resource to compare with.
+     * @return true - It is this arena.
+     * @return false - It is something else.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool do_is_equal(const std::pmr::memory_resource &stOther) const noexcept override { return this == &stOther; }
+};
+
+#endif
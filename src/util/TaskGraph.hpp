@@ -0,0 +1,360 @@
+/******************************************************************************
+ * @brief Defines and implements a reusable graph of dependent tasks that
+ *      releases each task to a thread pool as soon as its predecessors finish.
+ *
+ * @file TaskGraph.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef TASK_GRAPH_HPP
+#define TASK_GRAPH_HPP
+
+/// \cond
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief A directed acyclic graph of tasks. Tasks and dependencies are declared
+ *      once, then the graph can be run any number of times. Each run only resets
+ *      one counter per task, nothing is allocated. When a task finishes it
+ *      decrements the pending count of each successor. The first successor that
+ *      becomes ready runs on the same thread, the others are submitted to the pool,
+ *      so a chain of stages never waits in the pool queue.
+ *
+ *      Tasks may run on any pool thread and in any order the dependencies allow.
+ *      If a task throws, the tasks that haven't started yet are skipped and Run()
+ *      rethrows the first exception once everything in flight is done. Declaring
+ *      tasks while the graph is running is not allowed, and a graph must not be run
+ *      from one of its own pool threads.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class TaskGraph
+{
+public:
+    // Declare and define public methods and variables.
+    TaskGraph() = default;
+    TaskGraph(const TaskGraph &) = delete;
+    TaskGraph &operator=(const TaskGraph &) = delete;
+
+    /******************************************************************************
+     * @brief Adds a task to the graph.
+     *
+     * @param fnTask - The code to run. Takes no arguments and returns nothing.
+     * @return size_t - The ID of the task, used to declare dependencies.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t AddTask(std::function<void()> fnTask)
+    {
+        // Add task and invalidate the built tables.
+        m_vTasks.push_back(std::move(fnTask));
+        m_bFinalized = false;
+        return m_vTasks.size() - 1;
+    }
+
+    /******************************************************************************
+     * @brief Declares that one task must finish before another starts.
+     *
+     * @param nBefore - The ID of the task that runs first.
+     * @param nAfter - The ID of the task that waits for it.
+     * @return true - The dependency was added.
+     * @return false - One of the IDs doesn't exist or they are the same task.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool AddDependency(size_t nBefore, size_t nAfter)
+    {
+        // Check the IDs.
+        if (nBefore >= m_vTasks.size() || nAfter >= m_vTasks.size() || nBefore == nAfter)
+        {
+            return false;
+        }
+
+        // Store edge and invalidate the built tables.
+        m_vEdges.emplace_back(uint32_t(nBefore), uint32_t(nAfter));
+        m_bFinalized = false;
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Builds the successor lists and per task counters used by Run(). Called
+     *      by Run() if the graph changed, call it directly to allocate up front or to
+     *      check for cycles.
+     *
+     * @return true - The graph is acyclic and ready to run.
+     * @return false - The dependencies contain a cycle.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Finalize()
+    {
+        // Create instance variables.
+        const size_t nTasks = m_vTasks.size();
+
+        // Count successors and predecessors of each task.
+        m_vSuccessorStart.assign(nTasks + 1, 0);
+        m_vPredecessorCount.assign(nTasks, 0);
+        for (const std::pair<uint32_t, uint32_t> &stEdge : m_vEdges)
+        {
+            ++m_vSuccessorStart[stEdge.first + 1];
+            ++m_vPredecessorCount[stEdge.second];
+        }
+        // Lay out every successor list back to back.
+        for (size_t nTask = 0; nTask < nTasks; ++nTask)
+        {
+            m_vSuccessorStart[nTask + 1] += m_vSuccessorStart[nTask];
+        }
+        m_vSuccessors.resize(m_vEdges.size());
+        std::vector<uint32_t> vFill(m_vSuccessorStart.begin(), m_vSuccessorStart.end() - 1);
+        for (const std::pair<uint32_t, uint32_t> &stEdge : m_vEdges)
+        {
+            m_vSuccessors[vFill[stEdge.first]++] = stEdge.second;
+        }
+        // Tasks with no predecessors start each run.
+        m_vRoots.clear();
+        for (size_t nTask = 0; nTask < nTasks; ++nTask)
+        {
+            if (m_vPredecessorCount[nTask] == 0)
+            {
+                m_vRoots.push_back(uint32_t(nTask));
+            }
+        }
+
+        // Check for cycles by removing ready tasks until none are left.
+        std::vector<uint32_t> vPending(m_vPredecessorCount);
+        std::vector<uint32_t> vReady(m_vRoots);
+        size_t nVisited = 0;
+        while (!vReady.empty())
+        {
+            uint32_t nTask = vReady.back();
+            vReady.pop_back();
+            ++nVisited;
+            for (uint32_t nEdge = m_vSuccessorStart[nTask]; nEdge < m_vSuccessorStart[nTask + 1]; ++nEdge)
+            {
+                if (--vPending[m_vSuccessors[nEdge]] == 0)
+                {
+                    vReady.push_back(m_vSuccessors[nEdge]);
+                }
+            }
+        }
+        if (nVisited != nTasks)
+        {
+            return false;
+        }
+
+        // Allocate the run counters once.
+        m_pPending = std::make_unique<std::atomic<uint32_t>[]>(nTasks);
+        m_bFinalized = true;
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Runs every task once, respecting dependencies, and blocks until they
+     *      are all done.
+     *
+     * @param fnSubmit - Queues a std::function<void()> in a thread pool. Called for the
+     *          roots and for every task released while another successor runs inline.
+     * @return true - Every task ran.
+     * @return false - The graph contains a cycle, nothing ran.
+     *
+     * @note Rethrows the first exception thrown by a task.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Run(std::function<void(std::function<void()> &&)> fnSubmit)
+    {
+        // Build the tables if the graph changed.
+        if (!m_bFinalized && !this->Finalize())
+        {
+            return false;
+        }
+        if (m_vTasks.empty())
+        {
+            return true;
+        }
+
+        // Reset the counters for this run.
+        for (size_t nTask = 0; nTask < m_vTasks.size(); ++nTask)
+        {
+            m_pPending[nTask].store(m_vPredecessorCount[nTask], std::memory_order_relaxed);
+        }
+        m_nRemaining.store(m_vTasks.size(), std::memory_order_relaxed);
+        m_bFailed.store(false, std::memory_order_relaxed);
+        m_exFirstException = nullptr;
+        m_bDone = false;
+        m_fnSubmit = std::move(fnSubmit);
+
+        // Release the roots.
+        for (uint32_t nRoot : m_vRoots)
+        {
+            this->Submit(nRoot);
+        }
+
+        // Wait for the last task to finish.
+        std::unique_lock<std::mutex> lkDoneLock(m_muDoneMutex);
+        m_cvDone.wait(lkDoneLock, [this]() { return m_bDone; });
+        m_fnSubmit = nullptr;
+        if (m_exFirstException)
+        {
+            std::rethrow_exception(m_exFirstException);
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the number of tasks.
+     *
+     * @return size_t - The number of tasks in the graph.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetTaskCount() const { return m_vTasks.size(); }
+
+    /******************************************************************************
+     * @brief Accessor for the number of dependencies.
+     *
+     * @return size_t - The number of dependencies in the graph.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    size_t GetDependencyCount() const { return m_vEdges.size(); }
+
+    /******************************************************************************
+     * @brief Removes every task and dependency.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Clear()
+    {
+        // Clear the graph.
+        m_vTasks.clear();
+        m_vEdges.clear();
+        m_bFinalized = false;
+    }
+
+private:
+    // Declare private member variables.
+    std::vector<std::function<void()>> m_vTasks;
+    std::vector<std::pair<uint32_t, uint32_t>> m_vEdges;
+    bool m_bFinalized = false;
+    // Built by Finalize().
+    std::vector<uint32_t> m_vSuccessorStart;
+    std::vector<uint32_t> m_vSuccessors;
+    std::vector<uint32_t> m_vPredecessorCount;
+    std::vector<uint32_t> m_vRoots;
+    std::unique_ptr<std::atomic<uint32_t>[]> m_pPending;
+    // Per run state.
+    std::function<void(std::function<void()> &&)> m_fnSubmit;
+    std::atomic<size_t> m_nRemaining = 0;
+    std::atomic_bool m_bFailed = false;
+    std::exception_ptr m_exFirstException;
+    std::mutex m_muDoneMutex;
+    std::condition_variable m_cvDone;
+    bool m_bDone = false;
+
+    /******************************************************************************
+     * @brief Queues a ready task in the pool. The wrapper only holds two words so it
+     *      fits in std::function without an allocation.
+     *
+     * @param nTask - The ID of the ready task.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Submit(uint32_t nTask)
+    {
+        m_fnSubmit([this, nTask]() { this->Execute(nTask); });
+    }
+
+    /******************************************************************************
+     * @brief Runs a task, releases its successors, and keeps going on the first
+     *      successor that became ready.
+     *
+     * @param nTask - The ID of the ready task.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Execute(uint32_t nTask)
+    {
+        // Follow the chain of ready successors.
+        while (true)
+        {
+            // Run user code unless an earlier task failed.
+            if (!m_bFailed.load(std::memory_order_relaxed))
+            {
+                try
+                {
+                    m_vTasks[nTask]();
+                }
+                catch (...)
+                {
+                    // Keep the first exception.
+                    std::lock_guard<std::mutex> lkDoneLock(m_muDoneMutex);
+                    if (!m_exFirstException)
+                    {
+                        m_exFirstException = std::current_exception();
+                    }
+                    m_bFailed.store(true, std::memory_order_relaxed);
+                }
+            }
+
+            // Release successors, keeping the first ready one for this thread.
+            int64_t nNextTask = -1;
+            for (uint32_t nEdge = m_vSuccessorStart[nTask]; nEdge < m_vSuccessorStart[nTask + 1]; ++nEdge)
+            {
+                uint32_t nSuccessor = m_vSuccessors[nEdge];
+                if (m_pPending[nSuccessor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    if (nNextTask < 0)
+                    {
+                        nNextTask = nSuccessor;
+                    }
+                    else
+                    {
+                        this->Submit(nSuccessor);
+                    }
+                }
+            }
+
+            // The last task wakes Run(). The graph can't be touched after this.
+            if (m_nRemaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                std::lock_guard<std::mutex> lkDoneLock(m_muDoneMutex);
+                m_bDone = true;
+                m_cvDone.notify_all();
+                return;
+            }
+            if (nNextTask < 0)
+            {
+                return;
+            }
+            nTask = uint32_t(nNextTask);
+        }
+    }
+};
+
+#endif
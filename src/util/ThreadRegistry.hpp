@@ -0,0 +1,678 @@
+/******************************************************************************
+ * @brief Defines and implements a process-wide registry of AutonomyThreads that
+ *      publishes each thread's telemetry into a fixed table, optionally placed in
+ *      POSIX shared memory so another process can watch it live.
+ *
+ * @file ThreadRegistry.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef THREAD_REGISTRY_HPP
+#define THREAD_REGISTRY_HPP
+
+#include "CacheAlignment.hpp"
+
+/// \cond
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief A plain copy of one thread's telemetry, as returned to readers.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct ThreadTelemetrySnapshot
+{
+public:
+    // Declare public member variables.
+    std::string szName;
+    int nSlot = -1;
+    int nState = 0;                     // AutonomyThread::AutonomyThreadState.
+    int nIPSLimit = 0;
+    int nPoolThreads = 0;
+    int nPoolQueueLength = 0;
+    double dCurrentIPS = 0.0;
+    double dAverageIPS = 0.0;
+    double d1PercentLow = 0.0;
+    uint64_t nOverrunCount = 0;
+    uint64_t nWorstOverrunMicroseconds = 0;
+    std::array<uint64_t, 8> aBudgetHistogram = {};
+    uint64_t nPublishCount = 0;
+    int64_t nUpdateTimeNanoseconds = 0;    // CLOCK_MONOTONIC, comparable across processes on the same machine.
+    bool bTorn = false;                    // Never read between two writes, the writer may have died mid-update.
+};
+
+/******************************************************************************
+ * @brief One thread's entry in the telemetry table. Every field is a lock-free
+ *      atomic so the table can live in shared memory and be read by another
+ *      process. The owning thread is the only writer. It brackets each update
+ *      with a sequence counter that is odd while writing, and readers retry until
+ *      they copy the slot without the counter changing, or give up and mark the
+ *      copy as torn.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct alignas(cachealign::nDestructiveSize) ThreadTelemetrySlot
+{
+public:
+    // Declare public constants.
+    static constexpr uint32_t nFree = 0;
+    static constexpr uint32_t nClaimed = 1;
+    static constexpr uint32_t nActive = 2;
+    static constexpr size_t nMaxNameLength = 47;
+
+    // Declare public member variables.
+    std::atomic<uint32_t> nSequence;
+    std::atomic<uint32_t> nStatus;
+    std::array<std::atomic<char>, nMaxNameLength + 1> aName;
+    std::atomic<int32_t> nState;
+    std::atomic<int32_t> nIPSLimit;
+    std::atomic<int32_t> nPoolThreads;
+    std::atomic<int32_t> nPoolQueueLength;
+    std::atomic<double> dCurrentIPS;
+    std::atomic<double> dAverageIPS;
+    std::atomic<double> d1PercentLow;
+    std::atomic<uint64_t> nOverrunCount;
+    std::atomic<uint64_t> nWorstOverrunMicroseconds;
+    std::array<std::atomic<uint64_t>, 8> aBudgetHistogram;
+    std::atomic<uint64_t> nPublishCount;
+    std::atomic<int64_t> nUpdateTimeNanoseconds;
+};
+
+static_assert(std::atomic<double>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free, "Telemetry slots must be lock-free to be shared between processes.");
+
+/******************************************************************************
+ * @brief The header at the start of the telemetry table.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+struct alignas(cachealign::nDestructiveSize) ThreadTelemetryHeader
+{
+public:
+    // Declare public member variables.
+    uint64_t nMagic;         // Always ThreadRegistry::nMagic.
+    uint32_t nVersion;       // Table format version.
+    uint32_t nSlotCount;     // Number of slots after the header.
+    uint32_t nSlotSize;      // sizeof(ThreadTelemetrySlot) in the writing process.
+    int32_t nProcessID;      // The process that owns the table.
+};
+
+/******************************************************************************
+ * @brief Process-wide table of registered AutonomyThreads. Threads claim a slot
+ *      once and then publish into it with plain atomic stores, so publishing
+ *      never takes a lock or makes a syscall. The table lives on the heap unless
+ *      OpenSharedMemory() is called before the first registration, in which case
+ *      it is a POSIX shared memory segment that ThreadTelemetryReader can map
+ *      from another process.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class ThreadRegistry
+{
+public:
+    // Declare public constants.
+    static constexpr uint64_t nMagic = 0x594d454c45544854;    // "THTELEMY" read little endian.
+    static constexpr uint32_t nVersion = 1;
+    static constexpr uint32_t nDefaultSlotCount = 256;
+    static constexpr uint32_t nMaxReadAttempts = 1000;
+
+    /******************************************************************************
+     * @brief Accessor for the process-wide registry.
+     *
+     * @return ThreadRegistry& - The registry.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static ThreadRegistry &Instance()
+    {
+        static ThreadRegistry stRegistry;
+        return stRegistry;
+    }
+
+    ThreadRegistry(const ThreadRegistry &) = delete;
+    ThreadRegistry &operator=(const ThreadRegistry &) = delete;
+    ~ThreadRegistry() { this->Close(); }
+
+    /******************************************************************************
+     * @brief Places the table in a POSIX shared memory segment. Must be called
+     *      before any thread registers. The segment is removed again when the
+     *      registry closes. An existing segment with the same name is never resized,
+     *      another process may have it mapped and would fault on the lost pages.
+     *
+     * @param szName - The segment name, starting with a slash.
+     * @param nSlotCount - The max number of registered threads.
+     * @param bTakeOwnership - Unlink an existing segment with the same name first, for
+     *          one left behind by a crashed process. Readers that still map it keep the
+     *          old pages and have to reopen to see the new table.
+     * @return true - The segment was created and mapped.
+     * @return false - Threads already registered, the name is in use or the segment couldn't be created.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool OpenSharedMemory(const std::string &szName = "/AutonomyThreadTelemetry", uint32_t nSlotCount = nDefaultSlotCount, bool bTakeOwnership = false)
+    {
+        // The table can't move once threads hold slots in it.
+        std::lock_guard<std::mutex> lkRegistryLock(m_muRegistryMutex);
+        if (m_pTable != nullptr)
+        {
+            return false;
+        }
+
+        // Only size a segment this process created, never one someone else may be using.
+        if (bTakeOwnership)
+        {
+            ::shm_unlink(szName.c_str());
+        }
+        size_t nSize = TableSize(nSlotCount);
+        int nFileDescriptor = ::shm_open(szName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+        if (nFileDescriptor < 0)
+        {
+            return false;
+        }
+        void *pMapping = MAP_FAILED;
+        if (::ftruncate(nFileDescriptor, off_t(nSize)) == 0)
+        {
+            pMapping = ::mmap(nullptr, nSize, PROT_READ | PROT_WRITE, MAP_SHARED, nFileDescriptor, 0);
+        }
+        ::close(nFileDescriptor);
+        if (pMapping == MAP_FAILED)
+        {
+            ::shm_unlink(szName.c_str());
+            return false;
+        }
+
+        // Lay the table out in the segment.
+        m_szSharedMemoryName = szName;
+        m_nTableSize = nSize;
+        this->InitializeTable(pMapping, nSlotCount);
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Claims a slot for a thread.
+     *
+     * @param szName - The name shown to readers. Truncated to 47 characters.
+     * @return int - The slot index, or -1 if the table is full.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    int Register(const std::string &szName)
+    {
+        // Fall back to a table on the heap if nobody asked for shared memory.
+        ThreadTelemetrySlot *pSlots = this->GetOrCreateSlots();
+
+        // Claim the first free slot.
+        for (uint32_t nSlot = 0; nSlot < m_nSlotCount; ++nSlot)
+        {
+            uint32_t nExpected = ThreadTelemetrySlot::nFree;
+            if (pSlots[nSlot].nStatus.compare_exchange_strong(nExpected, ThreadTelemetrySlot::nClaimed, std::memory_order_acquire))
+            {
+                // Clear the slot under the sequence counter, then make it visible to readers.
+                ThreadTelemetrySlot &stSlot = pSlots[nSlot];
+                uint32_t nSequence = stSlot.nSequence.load(std::memory_order_relaxed);
+                stSlot.nSequence.store(nSequence + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                for (size_t nIter = 0; nIter < stSlot.aName.size(); ++nIter)
+                {
+                    stSlot.aName[nIter].store(nIter < std::min(szName.size(), ThreadTelemetrySlot::nMaxNameLength) ? szName[nIter] : '\0', std::memory_order_relaxed);
+                }
+                stSlot.nState.store(0, std::memory_order_relaxed);
+                stSlot.nIPSLimit.store(0, std::memory_order_relaxed);
+                stSlot.nPoolThreads.store(0, std::memory_order_relaxed);
+                stSlot.nPoolQueueLength.store(0, std::memory_order_relaxed);
+                stSlot.dCurrentIPS.store(0.0, std::memory_order_relaxed);
+                stSlot.dAverageIPS.store(0.0, std::memory_order_relaxed);
+                stSlot.d1PercentLow.store(0.0, std::memory_order_relaxed);
+                stSlot.nOverrunCount.store(0, std::memory_order_relaxed);
+                stSlot.nWorstOverrunMicroseconds.store(0, std::memory_order_relaxed);
+                for (std::atomic<uint64_t> &nBucket : stSlot.aBudgetHistogram)
+                {
+                    nBucket.store(0, std::memory_order_relaxed);
+                }
+                stSlot.nPublishCount.store(0, std::memory_order_relaxed);
+                stSlot.nUpdateTimeNanoseconds.store(0, std::memory_order_relaxed);
+                stSlot.nSequence.store(nSequence + 2, std::memory_order_release);
+                stSlot.nStatus.store(ThreadTelemetrySlot::nActive, std::memory_order_release);
+
+                return int(nSlot);
+            }
+        }
+
+        // Table is full.
+        return -1;
+    }
+
+    /******************************************************************************
+     * @brief Releases a slot. Readers stop seeing it immediately.
+     *
+     * @param nSlot - The slot index returned by Register().
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Unregister(int nSlot)
+    {
+        ThreadTelemetrySlot *pSlots = m_pSlotsReady.load(std::memory_order_acquire);
+        if (pSlots != nullptr && nSlot >= 0 && uint32_t(nSlot) < m_nSlotCount)
+        {
+            pSlots[nSlot].nStatus.store(ThreadTelemetrySlot::nFree, std::memory_order_release);
+        }
+    }
+
+    /******************************************************************************
+     * @brief Accessor for a slot, for the owning thread to publish into with
+     *      BeginWrite() and EndWrite().
+     *
+     * @param nSlot - The slot index returned by Register().
+     * @return ThreadTelemetrySlot& - The slot.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ThreadTelemetrySlot &GetSlot(int nSlot) { return m_pSlotsReady.load(std::memory_order_acquire)[nSlot]; }
+
+    /******************************************************************************
+     * @brief Marks a slot as being written. Readers retry until EndWrite().
+     *
+     * @param stSlot - The slot, only ever written by its owning thread.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static void BeginWrite(ThreadTelemetrySlot &stSlot)
+    {
+        stSlot.nSequence.store(stSlot.nSequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    /******************************************************************************
+     * @brief Publishes the writes made since BeginWrite().
+     *
+     * @param stSlot - The slot, only ever written by its owning thread.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static void EndWrite(ThreadTelemetrySlot &stSlot)
+    {
+        stSlot.nPublishCount.store(stSlot.nPublishCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        stSlot.nSequence.store(stSlot.nSequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /******************************************************************************
+     * @brief Copies every active slot. Used in process, the same as
+     *      ThreadTelemetryReader does from another process.
+     *
+     * @return std::vector<ThreadTelemetrySnapshot> - One snapshot per registered thread.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    std::vector<ThreadTelemetrySnapshot> ReadAll() const
+    {
+        ThreadTelemetrySlot *pSlots = m_pSlotsReady.load(std::memory_order_acquire);
+        return ReadSlots(pSlots, pSlots == nullptr ? 0 : m_nSlotCount);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for whether the table is in shared memory.
+     *
+     * @return true - The table is in a shared memory segment.
+     * @return false - The table is on the heap or not created yet.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool IsShared() const { return !m_szSharedMemoryName.empty(); }
+
+    /******************************************************************************
+     * @brief Copies every active slot out of a table. Each slot is retried until
+     *      it is read between two writes. A slot that is still changing after
+     *      nMaxReadAttempts tries, like one whose writer died mid-update, is copied
+     *      as is and marked torn instead of blocking the reader forever.
+     *
+     * @param pSlots - The first slot of the table.
+     * @param nSlotCount - The number of slots.
+     * @return std::vector<ThreadTelemetrySnapshot> - One snapshot per active slot.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static std::vector<ThreadTelemetrySnapshot> ReadSlots(const ThreadTelemetrySlot *pSlots, uint32_t nSlotCount)
+    {
+        // Create instance variables.
+        std::vector<ThreadTelemetrySnapshot> vSnapshots;
+
+        // Loop through every slot.
+        for (uint32_t nSlot = 0; pSlots != nullptr && nSlot < nSlotCount; ++nSlot)
+        {
+            const ThreadTelemetrySlot &stSlot = pSlots[nSlot];
+            ThreadTelemetrySnapshot stSnapshot;
+            bool bActive = false;
+            uint32_t nBefore = 0;
+            uint32_t nAfter = 0;
+            for (uint32_t nAttempt = 1; nAttempt <= nMaxReadAttempts; ++nAttempt)
+            {
+                // Wait out a write in progress, unless this is the last try.
+                nBefore = stSlot.nSequence.load(std::memory_order_acquire);
+                if ((nBefore & 1) && nAttempt < nMaxReadAttempts)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                // Copy the slot.
+                bActive = stSlot.nStatus.load(std::memory_order_relaxed) == ThreadTelemetrySlot::nActive;
+                char aName[ThreadTelemetrySlot::nMaxNameLength + 1];
+                for (size_t nIter = 0; nIter < stSlot.aName.size(); ++nIter)
+                {
+                    aName[nIter] = stSlot.aName[nIter].load(std::memory_order_relaxed);
+                }
+                aName[ThreadTelemetrySlot::nMaxNameLength] = '\0';
+                stSnapshot.szName = aName;
+                stSnapshot.nSlot = int(nSlot);
+                stSnapshot.nState = stSlot.nState.load(std::memory_order_relaxed);
+                stSnapshot.nIPSLimit = stSlot.nIPSLimit.load(std::memory_order_relaxed);
+                stSnapshot.nPoolThreads = stSlot.nPoolThreads.load(std::memory_order_relaxed);
+                stSnapshot.nPoolQueueLength = stSlot.nPoolQueueLength.load(std::memory_order_relaxed);
+                stSnapshot.dCurrentIPS = stSlot.dCurrentIPS.load(std::memory_order_relaxed);
+                stSnapshot.dAverageIPS = stSlot.dAverageIPS.load(std::memory_order_relaxed);
+                stSnapshot.d1PercentLow = stSlot.d1PercentLow.load(std::memory_order_relaxed);
+                stSnapshot.nOverrunCount = stSlot.nOverrunCount.load(std::memory_order_relaxed);
+                stSnapshot.nWorstOverrunMicroseconds = stSlot.nWorstOverrunMicroseconds.load(std::memory_order_relaxed);
+                for (size_t nIter = 0; nIter < stSnapshot.aBudgetHistogram.size(); ++nIter)
+                {
+                    stSnapshot.aBudgetHistogram[nIter] = stSlot.aBudgetHistogram[nIter].load(std::memory_order_relaxed);
+                }
+                stSnapshot.nPublishCount = stSlot.nPublishCount.load(std::memory_order_relaxed);
+                stSnapshot.nUpdateTimeNanoseconds = stSlot.nUpdateTimeNanoseconds.load(std::memory_order_relaxed);
+
+                // Make sure nothing was written while copying.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                nAfter = stSlot.nSequence.load(std::memory_order_relaxed);
+                if (!(nBefore & 1) && nBefore == nAfter)
+                {
+                    break;
+                }
+                std::this_thread::yield();
+            }
+            stSnapshot.bTorn = (nBefore & 1) || nBefore != nAfter;
+
+            // Keep active slots.
+            if (bActive)
+            {
+                vSnapshots.push_back(std::move(stSnapshot));
+            }
+        }
+
+        return vSnapshots;
+    }
+
+    /******************************************************************************
+     * @brief Size of a table with the given number of slots.
+     *
+     * @param nSlotCount - The number of slots.
+     * @return size_t - The number of bytes, header included.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    static size_t TableSize(uint32_t nSlotCount) { return sizeof(ThreadTelemetryHeader) + size_t(nSlotCount) * sizeof(ThreadTelemetrySlot); }
+
+private:
+    // Declare private member variables.
+    std::mutex m_muRegistryMutex;
+    std::atomic<ThreadTelemetrySlot *> m_pSlotsReady = nullptr;
+    void *m_pTable = nullptr;
+    ThreadTelemetrySlot *m_pSlots = nullptr;
+    uint32_t m_nSlotCount = 0;
+    size_t m_nTableSize = 0;
+    std::string m_szSharedMemoryName;
+    std::unique_ptr<ThreadTelemetrySlot[]> m_pHeapSlots;
+
+    ThreadRegistry() = default;
+
+    /******************************************************************************
+     * @brief Accessor for the slots, creating a heap table the first time if
+     *      shared memory wasn't opened.
+     *
+     * @return ThreadTelemetrySlot* - The first slot.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    ThreadTelemetrySlot *GetOrCreateSlots()
+    {
+        // Fast path once the table exists.
+        ThreadTelemetrySlot *pSlots = m_pSlotsReady.load(std::memory_order_acquire);
+        if (pSlots != nullptr)
+        {
+            return pSlots;
+        }
+
+        // Create the heap table.
+        std::lock_guard<std::mutex> lkRegistryLock(m_muRegistryMutex);
+        if (m_pTable == nullptr)
+        {
+            m_pHeapSlots = std::make_unique<ThreadTelemetrySlot[]>(nDefaultSlotCount);
+            m_pTable = m_pHeapSlots.get();
+            m_pSlots = m_pHeapSlots.get();
+            m_nSlotCount = nDefaultSlotCount;
+            for (uint32_t nSlot = 0; nSlot < m_nSlotCount; ++nSlot)
+            {
+                m_pSlots[nSlot].nSequence.store(0, std::memory_order_relaxed);
+                m_pSlots[nSlot].nStatus.store(ThreadTelemetrySlot::nFree, std::memory_order_relaxed);
+            }
+            m_pSlotsReady.store(m_pSlots, std::memory_order_release);
+        }
+
+        return m_pSlots;
+    }
+
+    /******************************************************************************
+     * @brief Writes the header and constructs empty slots in a mapped segment.
+     *
+     * @param pMapping - The start of the segment.
+     * @param nSlotCount - The number of slots.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void InitializeTable(void *pMapping, uint32_t nSlotCount)
+    {
+        // Construct the slots, then publish the header last so readers never see a half built table.
+        ThreadTelemetryHeader *pHeader = static_cast<ThreadTelemetryHeader *>(pMapping);
+        ThreadTelemetrySlot *pSlots = reinterpret_cast<ThreadTelemetrySlot *>(static_cast<uint8_t *>(pMapping) + sizeof(ThreadTelemetryHeader));
+        for (uint32_t nSlot = 0; nSlot < nSlotCount; ++nSlot)
+        {
+            ThreadTelemetrySlot *pSlot = new (&pSlots[nSlot]) ThreadTelemetrySlot();
+            pSlot->nSequence.store(0, std::memory_order_relaxed);
+            pSlot->nStatus.store(ThreadTelemetrySlot::nFree, std::memory_order_relaxed);
+        }
+        pHeader->nVersion = nVersion;
+        pHeader->nSlotCount = nSlotCount;
+        pHeader->nSlotSize = uint32_t(sizeof(ThreadTelemetrySlot));
+        pHeader->nProcessID = int32_t(::getpid());
+        std::atomic_thread_fence(std::memory_order_release);
+        pHeader->nMagic = nMagic;
+
+        m_pTable = pMapping;
+        m_pSlots = pSlots;
+        m_nSlotCount = nSlotCount;
+        m_pSlotsReady.store(pSlots, std::memory_order_release);
+    }
+
+    /******************************************************************************
+     * @brief Unmaps and removes the shared memory segment or frees the heap table.
+     *      Only called at exit, when no thread is registered any more.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Close()
+    {
+        if (!m_szSharedMemoryName.empty())
+        {
+            ::munmap(m_pTable, m_nTableSize);
+            ::shm_unlink(m_szSharedMemoryName.c_str());
+            m_szSharedMemoryName.clear();
+        }
+        m_pSlotsReady.store(nullptr, std::memory_order_release);
+        m_pHeapSlots.reset();
+        m_pTable = nullptr;
+        m_pSlots = nullptr;
+        m_nSlotCount = 0;
+    }
+};
+
+/******************************************************************************
+ * @brief Maps another process's telemetry table read only. Reading only touches
+ *      the mapping, so a monitor can poll as often as it likes without slowing
+ *      the threads it watches.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+class ThreadTelemetryReader
+{
+public:
+    // Declare and define public class methods.
+    ThreadTelemetryReader() = default;
+    ~ThreadTelemetryReader() { this->Close(); }
+    ThreadTelemetryReader(const ThreadTelemetryReader &) = delete;
+    ThreadTelemetryReader &operator=(const ThreadTelemetryReader &) = delete;
+
+    /******************************************************************************
+     * @brief Maps a telemetry segment.
+     *
+     * @param szName - The segment name given to ThreadRegistry::OpenSharedMemory().
+     * @return true - The segment was mapped and its header is valid.
+     * @return false - The segment doesn't exist yet or isn't a telemetry table.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    bool Open(const std::string &szName = "/AutonomyThreadTelemetry")
+    {
+        // Close anything already open.
+        this->Close();
+
+        // Map the whole segment.
+        int nFileDescriptor = ::shm_open(szName.c_str(), O_RDONLY, 0);
+        if (nFileDescriptor < 0)
+        {
+            return false;
+        }
+        struct stat stFileInfo;
+        void *pMapping = MAP_FAILED;
+        if (::fstat(nFileDescriptor, &stFileInfo) == 0 && size_t(stFileInfo.st_size) >= sizeof(ThreadTelemetryHeader))
+        {
+            pMapping = ::mmap(nullptr, size_t(stFileInfo.st_size), PROT_READ, MAP_SHARED, nFileDescriptor, 0);
+        }
+        ::close(nFileDescriptor);
+        if (pMapping == MAP_FAILED)
+        {
+            return false;
+        }
+        m_pMapping = pMapping;
+        m_nMappedSize = size_t(stFileInfo.st_size);
+
+        // Check the table was written by a compatible process.
+        const ThreadTelemetryHeader *pHeader = static_cast<const ThreadTelemetryHeader *>(m_pMapping);
+        if (pHeader->nMagic != ThreadRegistry::nMagic || pHeader->nVersion != ThreadRegistry::nVersion || pHeader->nSlotSize != sizeof(ThreadTelemetrySlot) ||
+            ThreadRegistry::TableSize(pHeader->nSlotCount) > m_nMappedSize)
+        {
+            this->Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    /******************************************************************************
+     * @brief Unmaps the segment.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    void Close()
+    {
+        if (m_pMapping != nullptr)
+        {
+            ::munmap(m_pMapping, m_nMappedSize);
+            m_pMapping = nullptr;
+            m_nMappedSize = 0;
+        }
+    }
+
+    /******************************************************************************
+     * @brief Copies every registered thread's telemetry.
+     *
+     * @return std::vector<ThreadTelemetrySnapshot> - One snapshot per registered thread.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    std::vector<ThreadTelemetrySnapshot> ReadAll() const
+    {
+        if (m_pMapping == nullptr)
+        {
+            return {};
+        }
+        const ThreadTelemetryHeader *pHeader = static_cast<const ThreadTelemetryHeader *>(m_pMapping);
+        const ThreadTelemetrySlot *pSlots =
+            reinterpret_cast<const ThreadTelemetrySlot *>(static_cast<const uint8_t *>(m_pMapping) + sizeof(ThreadTelemetryHeader));
+        return ThreadRegistry::ReadSlots(pSlots, pHeader->nSlotCount);
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the process that owns the table.
+     *
+     * @return int - The process ID, or -1 if nothing is open.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    int GetProcessID() const { return m_pMapping == nullptr ? -1 : static_cast<const ThreadTelemetryHeader *>(m_pMapping)->nProcessID; }
+
+private:
+    // Declare private member variables.
+    void *m_pMapping = nullptr;
+    size_t m_nMappedSize = 0;
+};
+
+#endif
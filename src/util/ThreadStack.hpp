@@ -0,0 +1,240 @@
+/******************************************************************************
+ * @brief Defines and implements helpers for choosing the stack size of the
+ *      threads we create.
+ *
+ * @file ThreadStack.hpp
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+
+#ifndef THREAD_STACK_HPP
+#define THREAD_STACK_HPP
+
+/// \cond
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <pthread.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+/// \endcond
+
+/******************************************************************************
+ * @brief Namespace containing functions that set the stack size of new threads.
+ *      std::thread has no way to pass a stack size, so threads that need one use
+ *      StackSizedThread, which passes the size to that one thread only and leaves
+ *      the process default alone.
+ *
+ *
+ * @author clayjay3 (claytonraycowen@gmail.com)
+ * @date 2026-10-19
+ ******************************************************************************/
+namespace threadstack
+{
+    /******************************************************************************
+     * @brief Rounds a stack size up to what pthreads accepts, a whole number of
+     *      pages and at least PTHREAD_STACK_MIN.
+     *
+     * @param nBytes - The requested stack size.
+     * @return size_t - The stack size that will be used.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline size_t RoundStackSize(size_t nBytes)
+    {
+        // Create instance variables.
+        size_t nPageSize = size_t(sysconf(_SC_PAGESIZE));
+        size_t nMinimum = size_t(PTHREAD_STACK_MIN);
+
+        nBytes = nBytes < nMinimum ? nMinimum : nBytes;
+        return (nBytes + nPageSize - 1) / nPageSize * nPageSize;
+    }
+
+    /******************************************************************************
+     * @brief Accessor for the stack size new threads get when nothing is set.
+     *
+     * @return size_t - The default stack size in bytes, or 0 if it can't be read.
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    inline size_t GetDefaultStackSize()
+    {
+        // Create instance variables.
+        size_t nBytes = 0;
+
+#if defined(__GLIBC__)
+        pthread_attr_t stAttributes;
+        if (pthread_getattr_default_np(&stAttributes) == 0)
+        {
+            pthread_attr_getstacksize(&stAttributes, &nBytes);
+            pthread_attr_destroy(&stAttributes);
+        }
+#endif
+
+        return nBytes;
+    }
+
+    /******************************************************************************
+     * @brief A move-only thread like std::thread, but created with its own stack
+     *      size through pthread attributes, so no other thread is affected.
+     *
+     *
+     * @author clayjay3 (claytonraycowen@gmail.com)
+     * @date 2026-10-19
+     ******************************************************************************/
+    class StackSizedThread
+    {
+    public:
+        StackSizedThread() = default;
+
+        /******************************************************************************
+         * @brief Construct a new Stack Sized Thread object and start the thread.
+         *
+         * @tparam F - The type of the callable.
+         * @param nBytes - The stack size of the thread. Rounded up by RoundStackSize(), 0 uses the system default.
+         * @param fnEntry - The callable the thread runs. An exception leaving it terminates, like std::thread.
+         *
+         * @throws std::system_error - The thread couldn't be created.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        template <typename F>
+        StackSizedThread(size_t nBytes, F &&fnEntry)
+        {
+            // The thread owns the callable once it starts.
+            std::unique_ptr<std::function<void()>> pEntry = std::make_unique<std::function<void()>>(std::forward<F>(fnEntry));
+
+            // Only this thread gets the stack size.
+            pthread_attr_t stAttributes;
+            pthread_attr_init(&stAttributes);
+            if (nBytes > 0)
+            {
+                pthread_attr_setstacksize(&stAttributes, RoundStackSize(nBytes));
+            }
+            int nError = pthread_create(&m_thHandle, &stAttributes, &StackSizedThread::Entry, pEntry.get());
+            pthread_attr_destroy(&stAttributes);
+            if (nError != 0)
+            {
+                throw std::system_error(nError, std::generic_category(), "pthread_create failed");
+            }
+            pEntry.release();
+            m_bJoinable = true;
+        }
+
+        StackSizedThread(const StackSizedThread &) = delete;
+        StackSizedThread &operator=(const StackSizedThread &) = delete;
+
+        /******************************************************************************
+         * @brief Move constructor. The other object no longer owns the thread.
+         *
+         * @param stOther - The thread to take over.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        StackSizedThread(StackSizedThread &&stOther) noexcept : m_thHandle(stOther.m_thHandle), m_bJoinable(std::exchange(stOther.m_bJoinable, false)) {}
+
+        /******************************************************************************
+         * @brief Move assignment. Terminates if this object still owns a thread, like std::thread.
+         *
+         * @param stOther - The thread to take over.
+         * @return StackSizedThread& - This object.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        StackSizedThread &operator=(StackSizedThread &&stOther) noexcept
+        {
+            if (m_bJoinable)
+            {
+                std::terminate();
+            }
+            m_thHandle = stOther.m_thHandle;
+            m_bJoinable = std::exchange(stOther.m_bJoinable, false);
+            return *this;
+        }
+
+        /******************************************************************************
+         * @brief Destroy the Stack Sized Thread object. Terminates if the thread was
+         *      never joined, like std::thread.
+         *
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        ~StackSizedThread()
+        {
+            if (m_bJoinable)
+            {
+                std::terminate();
+            }
+        }
+
+        /******************************************************************************
+         * @brief Waits for the thread to return.
+         *
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        void Join()
+        {
+            if (m_bJoinable)
+            {
+                pthread_join(m_thHandle, nullptr);
+                m_bJoinable = false;
+            }
+        }
+
+        /******************************************************************************
+         * @brief Checks if this object owns a thread that hasn't been joined.
+         *
+         * @return true - The thread can be joined.
+         * @return false - No thread, or it was already joined.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        bool IsJoinable() const { return m_bJoinable; }
+
+        /******************************************************************************
+         * @brief Checks if the calling thread is the one this object owns.
+         *
+         * @return true - Called from this thread.
+         * @return false - Called from any other thread.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        bool IsCurrentThread() const { return m_bJoinable && pthread_equal(m_thHandle, pthread_self()) != 0; }
+
+    private:
+        // Declare private member variables.
+        pthread_t m_thHandle = {};
+        bool m_bJoinable = false;
+
+        /******************************************************************************
+         * @brief The pthread start routine. Runs the callable and frees it.
+         *
+         * @param pArgument - The std::function<void()> the constructor allocated.
+         * @return void* - Always nullptr.
+         *
+         * @author clayjay3 (claytonraycowen@gmail.com)
+         * @date 2026-10-19
+         ******************************************************************************/
+        static void *Entry(void *pArgument) noexcept
+        {
+            std::unique_ptr<std::function<void()>> pEntry(static_cast<std::function<void()> *>(pArgument));
+            (*pEntry)();
+            return nullptr;
+        }
+    };
+}    // namespace threadstack
+
+#endif